@@ -74,3 +74,10 @@ table.justify_columns[6] = 'right'
 print("")
 print(table.table)
 print("")
+
+if 'throughput' in old_data['summary'] and 'throughput' in new_data['summary']:
+	old_queries_per_hour = float(old_data['summary']['throughput']['queries_per_hour'])
+	new_queries_per_hour = float(new_data['summary']['throughput']['queries_per_hour'])
+	diff = new_queries_per_hour / old_queries_per_hour - 1 if old_queries_per_hour > 0.0 else float('nan')
+	print("Throughput: " + "{0:.0f}".format(old_queries_per_hour) + " -> " + "{0:.0f}".format(new_queries_per_hour) + " queries/hour (" + format_diff(diff) + ")")
+	print("")
@@ -0,0 +1,103 @@
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cache/cache.hpp"
+#include "cache/gdfs_cache.hpp"
+#include "cache/sampled_lfu_cache.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using PlanCache = Cache<std::shared_ptr<std::string>, std::string>;
+
+constexpr auto CACHE_CAPACITY = DefaultCacheCapacity;
+
+// Number of distinct statements, of which some do not fit into the cache
+constexpr auto KEY_COUNT = size_t{1'200};
+
+// Resembles a plan cache key, i.e., a normalized SQL statement
+std::string generate_key(const size_t key_idx) {
+  return "[int, string] SELECT c_custkey, c_name, SUM(l_extendedprice) FROM customer, orders, lineitem WHERE "
+         "c_custkey = o_custkey AND l_orderkey = o_orderkey AND o_orderdate > ? AND c_mktsegment = ? AND "
+         "l_quantity < " +
+         std::to_string(key_idx);
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Looks up plans in the cache from multiple threads, as the sessions of the server do. The statements are Zipf-like
+ * distributed, i.e., few of them are executed most of the time. On a miss, the plan is inserted.
+ * The first argument selects the eviction strategy (0: SampledLFU, 1: GDFS), the second one whether the cache is
+ * sharded (1) or a single shard behind one lock (0).
+ */
+class CacheBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    if (state.thread_index != 0) return;
+
+    if (_keys.empty()) {
+      for (auto key_idx = size_t{0}; key_idx < KEY_COUNT; ++key_idx) {
+        _keys.emplace_back(generate_key(key_idx));
+      }
+    }
+
+    const auto shard_count = state.range(1) ? std::nullopt : std::optional<size_t>{1};
+    _cache = std::make_unique<PlanCache>(CACHE_CAPACITY);
+    if (state.range(0) == 0) {
+      _cache->replace_cache_impl<SampledLFUCache<std::string, std::shared_ptr<std::string>>>(CACHE_CAPACITY,
+                                                                                              shard_count);
+    } else {
+      _cache->replace_cache_impl<GDFSCache<std::string, std::shared_ptr<std::string>>>(CACHE_CAPACITY, shard_count);
+    }
+    const auto policy_name = std::string{state.range(0) == 0 ? "SampledLFU" : "GDFS"};
+    state.SetLabel(policy_name + (state.range(1) ? ", sharded" : ""));
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    if (state.thread_index == 0) _cache.reset();
+  }
+
+ protected:
+  inline static std::vector<std::string> _keys;
+  inline static std::unique_ptr<PlanCache> _cache;
+};
+
+BENCHMARK_DEFINE_F(CacheBenchmarkFixture, BM_CacheContention)(benchmark::State& state) {
+  auto generator = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  // Approximates a Zipf distribution: the lower the index, the more likely it is drawn
+  auto key_distribution = std::exponential_distribution<double>{8.0 / KEY_COUNT};
+  const auto plan = std::make_shared<std::string>("plan");
+
+  auto hit_count = size_t{0};
+  for (auto _ : state) {
+    const auto key_idx = static_cast<size_t>(key_distribution(generator)) % KEY_COUNT;
+    const auto& key = _keys[key_idx];
+    if (_cache->try_get(key)) {
+      ++hit_count;
+    } else {
+      _cache->set(key, plan);
+    }
+  }
+
+  state.counters["hit_rate"] = benchmark::Counter(static_cast<double>(hit_count) / state.iterations(),
+                                                  benchmark::Counter::kAvgThreads);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK_REGISTER_F(CacheBenchmarkFixture, BM_CacheContention)
+    ->Args({0, 0})
+    ->Args({0, 1})
+    ->Args({1, 0})
+    ->Args({1, 1})
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+}  // namespace opossum
@@ -2,8 +2,10 @@
 
 #include <boost/algorithm/string.hpp>
 #include <cxxopts.hpp>
+#include <fstream>
 
 #include "benchmark_runner.hpp"
+#include "cardinality_estimation_report.hpp"
 #include "cli_config_parser.hpp"
 #include "file_based_query_generator.hpp"
 #include "file_based_table_generator.hpp"
@@ -37,7 +39,8 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
   ("table_path", "Directory containing the Tables", cxxopts::value<std::string>()->default_value(DEFAULT_TABLE_PATH)) // NOLINT
   ("query_path", "Directory/file containing the queries", cxxopts::value<std::string>()->default_value(DEFAULT_QUERY_PATH)) // NOLINT
-  ("queries", "Subset of queries to run as a comma separated list", cxxopts::value<std::string>()->default_value("all")); // NOLINT
+  ("queries", "Subset of queries to run as a comma separated list", cxxopts::value<std::string>()->default_value("all")) // NOLINT
+  ("cardinality_report", "File to write the estimated and actual cardinalities of the operators of each query to after the benchmark (JSON). Don't specify to skip the report", cxxopts::value<std::string>()->default_value("")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> benchmark_config;
@@ -45,6 +48,7 @@ int main(int argc, char* argv[]) {
   std::string table_path;
   // Comma-separated query names or "all"
   std::string queries_str;
+  std::string cardinality_report_path;
 
   if (CLIConfigParser::cli_has_json_config(argc, argv)) {
     // JSON config file was passed in
@@ -52,6 +56,7 @@ int main(int argc, char* argv[]) {
     table_path = json_config.value("table_path", DEFAULT_TABLE_PATH);
     query_path = json_config.value("query_path", DEFAULT_QUERY_PATH);
     queries_str = json_config.value("queries", "all");
+    cardinality_report_path = json_config.value("cardinality_report", "");
 
     benchmark_config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
 
@@ -64,6 +69,7 @@ int main(int argc, char* argv[]) {
     query_path = cli_parse_result["query_path"].as<std::string>();
     table_path = cli_parse_result["table_path"].as<std::string>();
     queries_str = cli_parse_result["queries"].as<std::string>();
+    cardinality_report_path = cli_parse_result["cardinality_report"].as<std::string>();
 
     benchmark_config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
   }
@@ -114,4 +120,23 @@ int main(int argc, char* argv[]) {
       std::make_unique<FileBasedQueryGenerator>(*benchmark_config, query_path, non_query_file_names, query_subset);
 
   BenchmarkRunner{*benchmark_config, std::move(query_generator), std::move(table_generator), context}.run();
+
+  // Execute each query once more to compare the estimated cardinalities with the actual ones. The tables are still
+  // loaded from the benchmark run.
+  if (!cardinality_report_path.empty()) {
+    std::cout << "- Creating cardinality estimation report" << std::endl;
+
+    auto report_query_generator =
+        FileBasedQueryGenerator{*benchmark_config, query_path, non_query_file_names, query_subset};
+    auto cardinality_report = CardinalityEstimationReport{};
+    for (const auto& query_id : report_query_generator.selected_queries()) {
+      cardinality_report.add_query(report_query_generator.query_name(query_id),
+                                   report_query_generator.build_query(query_id));
+    }
+
+    auto report_file = std::ofstream{cardinality_report_path};
+    cardinality_report.write_json(report_file);
+    cardinality_report.print_summary(std::cout);
+    std::cout << "- Cardinality estimation report written to " << cardinality_report_path << std::endl;
+  }
 }
@@ -1,4 +1,9 @@
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 #include "operators/join_hash.hpp"
@@ -10,6 +15,8 @@
 #include "storage/chunk.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "table_generator.hpp"
 
 namespace {
@@ -20,6 +27,9 @@ constexpr auto NUMBER_OF_CHUNKS = size_t{50};
 constexpr auto TABLE_SIZE_SMALL = size_t{1'000};
 constexpr auto TABLE_SIZE_MEDIUM = size_t{100'000};
 constexpr auto TABLE_SIZE_BIG = size_t{10'000'000};
+
+// Chunk size of the tables of the JoinHash sweeps, which generate their values directly
+constexpr auto SWEEP_CHUNK_SIZE = size_t{100'000};
 }  // namespace
 
 namespace opossum {
@@ -100,6 +110,66 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+std::shared_ptr<TableWrapper> generate_table_from_values(const std::vector<int32_t>& values) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  for (auto chunk_begin = size_t{0}; chunk_begin < values.size(); chunk_begin += SWEEP_CHUNK_SIZE) {
+    const auto chunk_end = std::min(chunk_begin + SWEEP_CHUNK_SIZE, values.size());
+    auto chunk_values = std::vector<int32_t>(values.begin() + chunk_begin, values.begin() + chunk_end);
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(chunk_values))});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+/**
+ * Joins a build relation of @param build_size unique keys with a probe relation of as many keys that are drawn
+ * uniformly from the build keys. Without @param radix_bits, JoinHash chooses the radix bits itself. The radix bits and
+ * partitioning passes that were used are reported as counters.
+ */
+void bm_join_hash_sweep(benchmark::State& state, const size_t build_size, const std::optional<size_t>& radix_bits) {
+  auto random_engine = std::mt19937{42};
+
+  auto build_values = std::vector<int32_t>(build_size);
+  std::iota(build_values.begin(), build_values.end(), 0);
+  std::shuffle(build_values.begin(), build_values.end(), random_engine);
+
+  auto probe_values = std::vector<int32_t>(build_size);
+  auto distribution = std::uniform_int_distribution<int32_t>(0, static_cast<int32_t>(build_size) - 1);
+  std::generate(probe_values.begin(), probe_values.end(), [&]() { return distribution(random_engine); });
+
+  const auto table_wrapper_build = generate_table_from_values(build_values);
+  const auto table_wrapper_probe = generate_table_from_values(probe_values);
+
+  auto performance_data = JoinHash::PerformanceData{};
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(table_wrapper_build, table_wrapper_probe, JoinMode::Inner,
+                                           ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                           radix_bits);
+    join->execute();
+    const auto& join_performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+    performance_data.radix_bits = join_performance_data.radix_bits;
+    performance_data.radix_passes = join_performance_data.radix_passes;
+  }
+
+  state.counters["radix_bits"] = static_cast<double>(performance_data.radix_bits);
+  state.counters["radix_passes"] = static_cast<double>(performance_data.radix_passes);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 2 * build_size));
+}
+
+// Build sizes from 4K to 16M rows with the radix bits that JoinHash chooses
+void BM_JoinHash_BuildSizes(benchmark::State& state) {  // NOLINT
+  bm_join_hash_sweep(state, static_cast<size_t>(state.range(0)), std::nullopt);
+}
+BENCHMARK(BM_JoinHash_BuildSizes)->RangeMultiplier(4)->Range(1 << 12, 1 << 24);
+
+// A build size of 4M rows with fixed radix bits, to compare the choice of JoinHash with its alternatives
+void BM_JoinHash_RadixBits(benchmark::State& state) {  // NOLINT
+  bm_join_hash_sweep(state, size_t{1} << 22, static_cast<size_t>(state.range(0)));
+}
+BENCHMARK(BM_JoinHash_RadixBits)->DenseRange(0, 16, 2);
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -0,0 +1,151 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "expression/evaluation/like_matcher.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Words used by the TPC-H generator for p_name and o_comment (a subset of each)
+const auto P_NAME_WORDS = std::vector<std::string>{
+    "almond", "antique", "aquamarine", "azure", "beige", "bisque", "black", "blanched", "blue", "blush",
+    "brown", "burlywood", "chartreuse", "coral", "cornflower", "cream", "cyan", "dark", "forest", "frosted",
+    "green", "honeydew", "indian", "ivory", "khaki", "lace", "lemon", "linen", "magenta", "maroon"};
+const auto O_COMMENT_WORDS = std::vector<std::string>{
+    "furiously", "special", "requests", "deposits", "packages", "ironic", "carefully", "blithely", "final", "pending",
+    "express", "regular", "accounts", "foxes", "pinto", "beans", "sleep", "haggle", "nag", "wake", "boost", "among",
+    "the", "above", "quickly", "slyly", "bold", "even", "unusual", "theodolites"};
+
+// The first eight patterns are handled by the special cases of the LikeMatcher, the others by its GeneralPattern
+const auto PATTERNS = std::vector<std::pair<ColumnID, std::string>>{{ColumnID{0}, "%green%"},
+                                                                    {ColumnID{0}, "forest%"},
+                                                                    {ColumnID{0}, "%blush"},
+                                                                    {ColumnID{0}, "%almond%blue%"},
+                                                                    {ColumnID{1}, "%special%requests%"},
+                                                                    {ColumnID{1}, "%deposits%"},
+                                                                    {ColumnID{1}, "ironic%"},
+                                                                    {ColumnID{1}, "%beans"},
+                                                                    {ColumnID{0}, "%gr_en%"},
+                                                                    {ColumnID{0}, "f_r%st%"},
+                                                                    {ColumnID{1}, "%special%re_uests"},
+                                                                    {ColumnID{1}, "_____ %deposits%s"}};
+
+constexpr auto ROW_COUNT = size_t{1'000'000};
+constexpr auto CHUNK_SIZE = ChunkOffset{100'000};
+
+pmr_string generate_words(std::mt19937& generator, const std::vector<std::string>& words, const size_t word_count) {
+  auto word_distribution = std::uniform_int_distribution<size_t>{0, words.size() - 1};
+  auto string = pmr_string{};
+  for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+    if (word_idx > 0) string += ' ';
+    string += words[word_distribution(generator)];
+  }
+  return string;
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Runs the LIKE patterns of TPC-H (e.g., Q9's `p_name LIKE '%green%'` and Q13's `o_comment NOT LIKE
+ * '%special%requests%'`) and variations with '_' on generated columns that resemble p_name (five words) and o_comment
+ * (six to twelve words).
+ */
+class LikeBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& /*state*/) override {
+    // The data is generated once and shared by all benchmarks
+    if (!_values.empty()) return;
+
+    auto generator = std::mt19937{};
+    auto o_comment_length_distribution = std::uniform_int_distribution<size_t>{6, 12};
+
+    _values = std::vector<std::vector<pmr_string>>(2);
+    _values[0].reserve(ROW_COUNT);
+    _values[1].reserve(ROW_COUNT);
+
+    const auto column_definitions =
+        TableColumnDefinitions{{"p_name", DataType::String, false}, {"o_comment", DataType::String, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, CHUNK_SIZE);
+    const auto dictionary_table = std::make_shared<Table>(column_definitions, TableType::Data, CHUNK_SIZE);
+
+    for (auto row_idx = size_t{0}; row_idx < ROW_COUNT; ++row_idx) {
+      _values[0].emplace_back(generate_words(generator, P_NAME_WORDS, 5));
+      _values[1].emplace_back(generate_words(generator, O_COMMENT_WORDS, o_comment_length_distribution(generator)));
+      table->append({_values[0].back(), _values[1].back()});
+      dictionary_table->append({_values[0].back(), _values[1].back()});
+    }
+
+    ChunkEncoder::encode_all_chunks(dictionary_table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+    _dictionary_table_wrapper = std::make_shared<TableWrapper>(dictionary_table);
+    _dictionary_table_wrapper->execute();
+  }
+
+ protected:
+  void _benchmark_table_scan(benchmark::State& state, const std::shared_ptr<const AbstractOperator>& in) {
+    const auto& [column_id, pattern] = PATTERNS[state.range(0)];
+    state.SetLabel(pattern);
+
+    const auto column = pqp_column_(column_id, DataType::String, false, "");
+    const auto predicate = like_(column, value_(pmr_string{pattern}));
+
+    for (auto _ : state) {
+      const auto table_scan = std::make_shared<TableScan>(in, predicate);
+      table_scan->execute();
+    }
+  }
+
+  inline static std::vector<std::vector<pmr_string>> _values;
+  inline static std::shared_ptr<TableWrapper> _table_wrapper;
+  inline static std::shared_ptr<TableWrapper> _dictionary_table_wrapper;
+};
+
+BENCHMARK_DEFINE_F(LikeBenchmarkFixture, BM_LikeMatcher)(benchmark::State& state) {
+  const auto& [column_id, pattern] = PATTERNS[state.range(0)];
+  state.SetLabel(pattern);
+
+  const auto& values = _values[column_id];
+  const auto matcher = LikeMatcher{pmr_string{pattern}};
+
+  for (auto _ : state) {
+    auto match_count = size_t{0};
+    matcher.resolve(false, [&](const auto& resolved_matcher) {
+      for (const auto& value : values) {
+        match_count += resolved_matcher(value);
+      }
+    });
+    benchmark::DoNotOptimize(match_count);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * values.size()));
+}
+
+BENCHMARK_DEFINE_F(LikeBenchmarkFixture, BM_TableScanLike)(benchmark::State& state) {
+  _benchmark_table_scan(state, _table_wrapper);
+}
+
+BENCHMARK_DEFINE_F(LikeBenchmarkFixture, BM_TableScanLike_OnDict)(benchmark::State& state) {
+  _benchmark_table_scan(state, _dictionary_table_wrapper);
+}
+
+BENCHMARK_REGISTER_F(LikeBenchmarkFixture, BM_LikeMatcher)->DenseRange(0, PATTERNS.size() - 1);
+BENCHMARK_REGISTER_F(LikeBenchmarkFixture, BM_TableScanLike)->DenseRange(0, PATTERNS.size() - 1);
+BENCHMARK_REGISTER_F(LikeBenchmarkFixture, BM_TableScanLike_OnDict)->DenseRange(0, PATTERNS.size() - 1);
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "operators/join_hash/join_hash_steps.hpp"
+#include "types.hpp"
+#include "utils/radix_partition_writer.hpp"
+
+namespace {
+
+// Large enough for the output to exceed the last level cache, as is the case when partitioning pays off
+constexpr auto ELEMENT_COUNT = size_t{1} << 25;
+
+using Element = opossum::PartitionedElement<int32_t>;
+
+const std::vector<Element>& input_elements() {
+  static const auto elements = [] {
+    auto random_engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int32_t>{};
+
+    auto elements = std::vector<Element>(ELEMENT_COUNT);
+    for (auto element_idx = size_t{0}; element_idx < ELEMENT_COUNT; ++element_idx) {
+      const auto row_id = opossum::RowID{opossum::ChunkID{0}, static_cast<opossum::ChunkOffset>(element_idx)};
+      elements[element_idx] = Element{row_id, distribution(random_engine)};
+    }
+    return elements;
+  }();
+  return elements;
+}
+
+// Arguments: {radix bits, write-combining}
+void partitioning_arguments(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"radix_bits", "write_combining"});
+  for (auto radix_bits = 2; radix_bits <= 16; radix_bits += 2) {
+    benchmark->Args({radix_bits, 0})->Args({radix_bits, 1});
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Scatters the elements into 2^radix_bits partitions by their hash, as the partitioning of JoinHash does, either with
+ * direct writes or with software write-combining (see RadixPartitionWriter). The histogram is computed outside of the
+ * measurement. The throughput is reported as items (i.e., tuples) per second.
+ */
+void BM_RadixPartitioning(::benchmark::State& state) {  // NOLINT
+  const auto partition_count = size_t{1} << state.range(0);
+  const auto mode = state.range(1) ? RadixPartitionWriteMode::WriteCombining : RadixPartitionWriteMode::Direct;
+  const auto mask = partition_count - 1;
+  const auto hash_function = std::hash<int32_t>{};
+
+  const auto& elements = input_elements();
+
+  auto histogram = std::vector<size_t>(partition_count);
+  for (const auto& element : elements) {
+    ++histogram[hash_function(element.value) & mask];
+  }
+
+  auto output_offsets = std::vector<size_t>(partition_count);
+  auto offset = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    output_offsets[partition_id] = offset;
+    offset += histogram[partition_id];
+  }
+
+  auto output = std::vector<Element>(elements.size());
+
+  for (auto _ : state) {
+    auto writer = RadixPartitionWriter<Element>{output.data(), output_offsets, mode};
+    for (const auto& element : elements) {
+      writer.write(hash_function(element.value) & mask, element);
+    }
+    writer.flush();
+    benchmark::DoNotOptimize(output.data());
+  }
+
+  // Whether RadixPartitionWriter::choose_mode() would use write-combining for this fan-out
+  const auto chosen_mode = RadixPartitionWriter<Element>::choose_mode(partition_count, elements.size());
+  state.counters["chosen_write_combining"] = chosen_mode == RadixPartitionWriteMode::WriteCombining ? 1.0 : 0.0;
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * elements.size()));
+}
+BENCHMARK(BM_RadixPartitioning)->Apply(partitioning_arguments);
+
+}  // namespace opossum
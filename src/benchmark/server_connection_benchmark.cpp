@@ -0,0 +1,192 @@
+#include <json.hpp>
+#include <pqxx/pqxx>
+
+#include <boost/algorithm/string.hpp>
+#include <cxxopts.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "server/server.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+/**
+ * Measures how the throughput and latency of the server scale with the number of concurrent connections. Similar to
+ * `pgbench --select-only`, each client runs point queries on a small table as fast as it can. The table is small, so
+ * that the costs of the network I/O and of the sessions dominate. The server runs in the same process, so it is not
+ * affected by the network stack of a remote machine, but the client threads compete with it for the cores.
+ */
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+struct ClientCountResult {
+  size_t client_count;
+  size_t query_count;
+  double queries_per_second;
+  double average_latency_us;
+  double p95_latency_us;
+  double p99_latency_us;
+};
+
+// Runs point queries on a connection until the deadline and returns the latency of each query in microseconds
+std::vector<double> run_client(const std::string& connection_string, const size_t row_count,
+                               const std::chrono::steady_clock::time_point deadline, const unsigned int seed) {
+  auto latencies = std::vector<double>{};
+
+  pqxx::connection connection{connection_string};
+  // We use nontransactions because the regular transactions use SQL that we don't support. Nontransactions auto commit.
+  pqxx::nontransaction transaction{connection};
+
+  auto random_engine = std::mt19937{seed};
+  auto key_distribution = std::uniform_int_distribution<size_t>{0, row_count - 1};
+
+  while (std::chrono::steady_clock::now() < deadline) {
+    const auto sql = "SELECT b FROM connection_benchmark WHERE a = " + std::to_string(key_distribution(random_engine));
+
+    const auto begin = std::chrono::steady_clock::now();
+    transaction.exec(sql);
+    const auto end = std::chrono::steady_clock::now();
+
+    latencies.emplace_back(std::chrono::duration<double, std::micro>(end - begin).count());
+  }
+
+  return latencies;
+}
+
+ClientCountResult run_client_count(const std::string& connection_string, const size_t row_count,
+                                   const size_t client_count, const std::chrono::seconds duration) {
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+
+  auto client_latencies = std::vector<std::vector<double>>(client_count);
+  auto clients = std::vector<std::thread>{};
+  clients.reserve(client_count);
+  for (auto client_id = size_t{0}; client_id < client_count; ++client_id) {
+    clients.emplace_back([&, client_id]() {
+      client_latencies[client_id] =
+          run_client(connection_string, row_count, deadline, static_cast<unsigned int>(client_id));
+    });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+
+  auto latencies = std::vector<double>{};
+  for (const auto& latencies_of_client : client_latencies) {
+    latencies.insert(latencies.end(), latencies_of_client.cbegin(), latencies_of_client.cend());
+  }
+  if (latencies.empty()) return {client_count, 0, 0.0, 0.0, 0.0, 0.0};
+
+  std::sort(latencies.begin(), latencies.end());
+  const auto percentile = [&](const double share) {
+    const auto index = static_cast<size_t>(share * static_cast<double>(latencies.size()));
+    return latencies[std::min(index, latencies.size() - 1)];
+  };
+  const auto average_latency = std::accumulate(latencies.cbegin(), latencies.cend(), 0.0) / latencies.size();
+
+  return {client_count,
+          latencies.size(),
+          static_cast<double>(latencies.size()) / static_cast<double>(duration.count()),
+          average_latency,
+          percentile(0.95),
+          percentile(0.99)};
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"Hyrise Server Connection Benchmark"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print a summary of CLI options")
+    ("clients", "Comma separated list of the numbers of concurrent connections", cxxopts::value<std::string>()->default_value("1,2,4,8,16,32,64,128,256")) // NOLINT
+    ("io_threads", "Number of I/O threads of the server. 0 runs all sessions on one thread", cxxopts::value<size_t>()->default_value(std::to_string(std::thread::hardware_concurrency()))) // NOLINT
+    ("t,time", "Seconds that each number of connections is run", cxxopts::value<size_t>()->default_value("10")) // NOLINT
+    ("rows", "Number of rows of the queried table", cxxopts::value<size_t>()->default_value("10000")) // NOLINT
+    ("o,output", "File to output results to, don't specify for stdout", cxxopts::value<std::string>()->default_value("")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto io_thread_count = cli_parse_result["io_threads"].as<size_t>();
+  const auto duration = std::chrono::seconds{cli_parse_result["time"].as<size_t>()};
+  const auto row_count = cli_parse_result["rows"].as<size_t>();
+  const auto output_path = cli_parse_result["output"].as<std::string>();
+
+  auto client_count_strings = std::vector<std::string>{};
+  boost::algorithm::split(client_count_strings, cli_parse_result["clients"].as<std::string>(), boost::is_any_of(","));
+  auto client_counts = std::vector<size_t>{};
+  for (const auto& client_count_string : client_count_strings) {
+    client_counts.emplace_back(std::stoul(boost::trim_copy(client_count_string)));
+  }
+
+  std::cout << "- Creating table with " << row_count << " rows" << std::endl;
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                       TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    table->append({static_cast<int32_t>(row_id), static_cast<int32_t>(row_id % 100)});
+  }
+  StorageManager::get().add_table("connection_benchmark", table);
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::cout << "- Starting server with " << io_thread_count << " I/O threads" << std::endl;
+  auto io_service = boost::asio::io_service{};
+  // Run on port 0 so the server can pick a free one
+  auto server = std::make_unique<Server>(io_service, 0, io_thread_count);
+  const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(server->get_port_number());
+  auto server_thread = std::thread{[&]() { io_service.run(); }};
+
+  auto results = nlohmann::json::array();
+  for (const auto client_count : client_counts) {
+    std::cout << "- Running " << client_count << " connections" << std::endl;
+    const auto result = run_client_count(connection_string, row_count, client_count, duration);
+    std::cout << "  -> " << result.queries_per_second << " queries per second, latency: average "
+              << result.average_latency_us << " us, 95th percentile " << result.p95_latency_us
+              << " us, 99th percentile " << result.p99_latency_us << " us" << std::endl;
+
+    results.push_back(nlohmann::json{{"clients", result.client_count},
+                                     {"queries", result.query_count},
+                                     {"queries_per_second", result.queries_per_second},
+                                     {"average_latency_us", result.average_latency_us},
+                                     {"p95_latency_us", result.p95_latency_us},
+                                     {"p99_latency_us", result.p99_latency_us}});
+  }
+
+  io_service.stop();
+  server_thread.join();
+  server.reset();
+  CurrentScheduler::get()->finish();
+
+  const auto report =
+      nlohmann::json{{"io_threads", io_thread_count}, {"rows", row_count}, {"duration_s", duration.count()},
+                     {"results", results}};
+  if (output_path.empty()) {
+    std::cout << std::setw(2) << report << std::endl;
+  } else {
+    auto output_file = std::ofstream{output_path};
+    output_file << std::setw(2) << report << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_gather.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace {
+
+constexpr auto REFERENCED_CHUNK_COUNT = opossum::ChunkID{32};
+constexpr auto REFERENCED_CHUNK_SIZE = opossum::ChunkOffset{100'000};
+constexpr auto POS_LIST_SIZE = size_t{100'000};
+
+// Creates a table with a single int column of REFERENCED_CHUNK_COUNT chunks, encoded with the given encoding
+std::shared_ptr<opossum::Table> create_referenced_table(const opossum::EncodingType encoding_type) {
+  auto table = std::make_shared<opossum::Table>(
+      opossum::TableColumnDefinitions{{"a", opossum::DataType::Int}}, opossum::TableType::Data);
+
+  for (auto chunk_id = opossum::ChunkID{0}; chunk_id < REFERENCED_CHUNK_COUNT; ++chunk_id) {
+    auto values = std::vector<int32_t>(REFERENCED_CHUNK_SIZE);
+    std::iota(values.begin(), values.end(), static_cast<int32_t>(chunk_id * REFERENCED_CHUNK_SIZE));
+    table->append_chunk(opossum::Segments{std::make_shared<opossum::ValueSegment<int32_t>>(std::move(values))});
+  }
+
+  if (encoding_type != opossum::EncodingType::Unencoded) {
+    opossum::ChunkEncoder::encode_all_chunks(table, opossum::SegmentEncodingSpec{encoding_type});
+  }
+  return table;
+}
+
+/**
+ * Random: the positions are spread uniformly over all chunks of the referenced table, as in the output of a hash join
+ * Clustered: the positions are sorted, as in the output of a table scan over multiple chunks
+ */
+std::shared_ptr<opossum::PosList> create_pos_list(const bool clustered) {
+  auto random_engine = std::default_random_engine{};
+  auto chunk_id_distribution =
+      std::uniform_int_distribution<opossum::ChunkID::base_type>{0, REFERENCED_CHUNK_COUNT - 1};
+  auto chunk_offset_distribution = std::uniform_int_distribution<opossum::ChunkOffset>{0, REFERENCED_CHUNK_SIZE - 1};
+
+  auto pos_list = std::make_shared<opossum::PosList>(POS_LIST_SIZE);
+  for (auto& row_id : *pos_list) {
+    row_id = opossum::RowID{opossum::ChunkID{chunk_id_distribution(random_engine)},
+                            chunk_offset_distribution(random_engine)};
+  }
+
+  if (clustered) std::sort(pos_list->begin(), pos_list->end());
+  return pos_list;
+}
+
+std::shared_ptr<opossum::ReferenceSegment> create_reference_segment(const ::benchmark::State& state) {
+  const auto encoding_type = state.range(0) ? opossum::EncodingType::Dictionary : opossum::EncodingType::Unencoded;
+  const auto clustered = static_cast<bool>(state.range(1));
+  return std::make_shared<opossum::ReferenceSegment>(create_referenced_table(encoding_type), opossum::ColumnID{0},
+                                                     create_pos_list(clustered));
+}
+
+// Arguments: {dictionary encoded, clustered PosList}
+void gather_arguments(::benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"dictionary", "clustered"})->Args({0, 0})->Args({0, 1})->Args({1, 0})->Args({1, 1});
+}
+
+}  // namespace
+
+namespace opossum {
+
+void BM_ReferenceSegmentAccessor(::benchmark::State& state) {  // NOLINT
+  const auto reference_segment = create_reference_segment(state);
+  auto values = std::vector<std::optional<int32_t>>(reference_segment->size());
+
+  for (auto _ : state) {
+    const auto accessor = create_segment_accessor<int32_t>(reference_segment);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < reference_segment->size(); ++chunk_offset) {
+      values[chunk_offset] = accessor->access(chunk_offset);
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+}
+BENCHMARK(BM_ReferenceSegmentAccessor)->Apply(gather_arguments);
+
+void BM_ReferenceSegmentGather(::benchmark::State& state) {  // NOLINT
+  const auto reference_segment = create_reference_segment(state);
+  auto values = std::vector<std::optional<int32_t>>(reference_segment->size());
+
+  for (auto _ : state) {
+    auto gather = ReferenceSegmentGather<int32_t>{*reference_segment};
+    gather.gather(ChunkOffset{0}, static_cast<ChunkOffset>(reference_segment->size()), values.data());
+    benchmark::DoNotOptimize(values.data());
+  }
+}
+BENCHMARK(BM_ReferenceSegmentGather)->Apply(gather_arguments);
+
+}  // namespace opossum
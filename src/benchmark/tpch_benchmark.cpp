@@ -22,6 +22,7 @@
 #include "storage/storage_manager.hpp"
 #include "tpch/tpch_queries.hpp"
 #include "tpch/tpch_query_generator.hpp"
+#include "tpch/tpch_refresh_functions.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/assert.hpp"
 #include "visualization/lqp_visualizer.hpp"
@@ -32,10 +33,11 @@ using namespace opossum;  // NOLINT
 /**
  * This benchmark measures Hyrise's performance executing the TPC-H *queries*, it doesn't (yet) support running the
  * TPC-H *benchmark* exactly as it is specified.
- * (Among other things, the TPC-H requires performing data refreshes and has strict requirements for the number of
- * sessions running in parallel. See http://www.tpc.org/tpch/default.asp for more info)
- * The benchmark offers a wide range of options (scale_factor, chunk_size, ...) but most notably it offers two modes:
- * IndividualQueries and PermutedQuerySets. See docs on BenchmarkMode for details.
+ * (Among other things, the TPC-H has strict requirements for the number of sessions running in parallel and for the
+ * refresh functions. See http://www.tpc.org/tpch/default.asp for more info)
+ * The benchmark offers a wide range of options (scale_factor, chunk_size, ...) but most notably it offers three modes:
+ * IndividualQueries, PermutedQuerySets, and Throughput. See docs on BenchmarkMode for details. In Throughput mode,
+ * --refresh runs the refresh functions RF1 and RF2 (see TpchRefreshFunctions) alongside the query streams.
  * The benchmark will stop issuing new queries if either enough iterations have taken place or enough time has passed.
  *
  * main() is mostly concerned with parsing the CLI options while BenchmarkRunner.run() performs the actual benchmark
@@ -49,13 +51,15 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     ("s,scale", "Database scale factor (1.0 ~ 1GB)", cxxopts::value<float>()->default_value("1"))
     ("q,queries", "Specify queries to run (comma-separated query ids, e.g. \"--queries 1,3,19\"), default is all", cxxopts::value<std::string>()) // NOLINT
-    ("use_prepared_statements", "Use prepared statements instead of random SQL strings", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("use_prepared_statements", "Use prepared statements instead of random SQL strings", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("refresh", "Run the refresh functions alongside the query streams (Throughput mode only, requires --mvcc)", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   std::shared_ptr<opossum::BenchmarkConfig> config;
   std::string comma_separated_queries;
   float scale_factor;
   bool use_prepared_statements;
+  bool refresh;
 
   if (opossum::CLIConfigParser::cli_has_json_config(argc, argv)) {
     // JSON config file was passed in
@@ -67,6 +71,7 @@ int main(int argc, char* argv[]) {
         opossum::CLIConfigParser::parse_basic_options_json_config(json_config));
 
     use_prepared_statements = json_config.value("use_prepared_statements", false);
+    refresh = json_config.value("refresh", false);
   } else {
     // Parse regular command line args
     const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -83,6 +88,7 @@ int main(int argc, char* argv[]) {
         std::make_shared<opossum::BenchmarkConfig>(opossum::CLIConfigParser::parse_basic_cli_options(cli_parse_result));
 
     use_prepared_statements = cli_parse_result["use_prepared_statements"].as<bool>();
+    refresh = cli_parse_result["refresh"].as<bool>();
   }
 
   std::vector<opossum::QueryID> query_ids;
@@ -112,7 +118,8 @@ int main(int argc, char* argv[]) {
   std::cout << "]" << std::endl;
 
   // TODO(leander): Enable support for queries that contain multiple statements requiring execution
-  if (config->enable_scheduler) {
+  if (config->enable_scheduler && config->benchmark_mode != BenchmarkMode::Throughput) {
+    // The query streams of the Throughput mode execute the queries synchronously, which also works for Q15
     // QueryID{14} represents TPC-H query 15 because we use 0 indexing
     Assert(std::find(query_ids.begin(), query_ids.end(), opossum::QueryID{14}) == query_ids.end(),
            "TPC-H query 15 is not supported for multithreaded benchmarking.");
@@ -121,6 +128,9 @@ int main(int argc, char* argv[]) {
   auto context = opossum::BenchmarkRunner::create_context(*config);
 
   Assert(!use_prepared_statements || !config->verify, "SQLite validation does not work with prepared statements");
+  Assert(!refresh || config->benchmark_mode == BenchmarkMode::Throughput,
+         "The refresh functions can only be run in Throughput mode");
+  Assert(!refresh || config->use_mvcc == UseMvcc::Yes, "The refresh functions require MVCC");
 
   if (config->verify) {
     // Hack: We cannot verify TPC-H Q15, thus we remove it from the list of queries
@@ -137,10 +147,19 @@ int main(int argc, char* argv[]) {
   // Add TPCH-specific information
   context.emplace("scale_factor", scale_factor);
   context.emplace("use_prepared_statements", use_prepared_statements);
+  context.emplace("refresh", refresh);
 
   // Run the benchmark
-  opossum::BenchmarkRunner(
+  auto benchmark_runner = opossum::BenchmarkRunner(
       *config, std::make_unique<opossum::TPCHQueryGenerator>(use_prepared_statements, scale_factor, query_ids),
-      std::make_unique<TpchTableGenerator>(scale_factor, config), context)
-      .run();
+      std::make_unique<TpchTableGenerator>(scale_factor, config), context);
+
+  if (refresh) {
+    std::cout << "- Generating the orders for the refresh functions" << std::endl;
+    const auto refresh_functions = std::make_shared<TpchRefreshFunctions>(scale_factor, config->chunk_size);
+    benchmark_runner.set_refresh_functions({{"RF1", [refresh_functions]() { refresh_functions->rf1(); }},
+                                            {"RF2", [refresh_functions]() { refresh_functions->rf2(); }}});
+  }
+
+  benchmark_runner.run();
 }
@@ -10,8 +10,10 @@ namespace opossum {
 /**
  * IndividualQueries runs each query a number of times and then the next one
  * PermutedQuerySet runs the queries as set permuting their order after each run (this exercises caches)
+ * Throughput runs one query stream per client, each executing the query set in its own permutation, for a fixed
+ *   duration and optionally alongside a stream of refresh functions (similar to the TPC-H throughput test)
  */
-enum class BenchmarkMode { IndividualQueries, PermutedQuerySet };
+enum class BenchmarkMode { IndividualQueries, PermutedQuerySet, Throughput };
 
 using Duration = std::chrono::high_resolution_clock::duration;
 using TimePoint = std::chrono::high_resolution_clock::time_point;
@@ -24,7 +26,7 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables);
+                  const bool cache_binary_tables, const bool enable_performance_counters);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +44,7 @@ class BenchmarkConfig {
   bool enable_visualization = false;
   bool verify = false;
   bool cache_binary_tables = false;
+  bool enable_performance_counters = false;
 
   static const char* description;
 
@@ -1,7 +1,10 @@
 #include <json.hpp>
 
 #include <boost/range/adaptors.hpp>
+#include <mutex>
 #include <random>
+#include <thread>
+#include <unordered_set>
 
 #include "cxxopts.hpp"
 
@@ -24,6 +27,34 @@
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Sums the hardware performance counters of all operators of the plans. Operators that are the input of multiple
+// operators are only counted once. Subqueries are not visited, as they are executed by (and counted in) the operators
+// that use them.
+PerformanceCounterValues sum_performance_counters(const std::vector<std::shared_ptr<AbstractOperator>>& pqps) {
+  auto sum = PerformanceCounterValues{};
+  if (!PerformanceCounters::is_enabled()) return sum;
+
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{pqps.cbegin(), pqps.cend()};
+  while (!operators.empty()) {
+    const auto op = operators.back();
+    operators.pop_back();
+    if (!op || !visited_operators.emplace(op).second) continue;
+
+    sum += op->performance_data().performance_counters;
+    operators.emplace_back(op->input_left());
+    operators.emplace_back(op->input_right());
+  }
+
+  return sum;
+}
+
+}  // namespace
+
 namespace opossum {
 
 BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
@@ -32,10 +63,20 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<
       _query_generator(std::move(query_generator)),
       _table_generator(std::move(table_generator)),
       _context(context) {
+  if (config.enable_performance_counters) {
+    PerformanceCounters::set_enabled(true);
+    if (!PerformanceCounters::is_available()) {
+      std::cout << "- Hardware performance counters are not available (see /proc/sys/kernel/perf_event_paranoid), "
+                << "only the time is measured" << std::endl;
+    }
+  }
+
   // Initialise the scheduler if the benchmark was requested to run multi-threaded
   if (config.enable_scheduler) {
     // If we wanted to, we could probably implement this, but right now, it does not seem to be worth the effort
     Assert(!config.verify, "Cannot use verification with enabled scheduler");
+    // The counters only count the thread that executes an operator, not its jobs (see PerformanceCounters)
+    Assert(!config.enable_performance_counters, "Cannot sample performance counters with enabled scheduler");
 
     Topology::use_default_topology(config.cores);
     std::cout << "- Multi-threaded Topology:" << std::endl;
@@ -59,6 +100,10 @@ BenchmarkRunner::~BenchmarkRunner() {
   }
 }
 
+void BenchmarkRunner::set_refresh_functions(const std::vector<RefreshFunction>& refresh_functions) {
+  _refresh_functions = refresh_functions;
+}
+
 void BenchmarkRunner::run() {
   _table_generator->generate_and_store();
 
@@ -109,6 +154,10 @@ void BenchmarkRunner::run() {
       _benchmark_permuted_query_set();
       break;
     }
+    case BenchmarkMode::Throughput: {
+      _benchmark_throughput();
+      break;
+    }
   }
 
   auto benchmark_end = std::chrono::steady_clock::now();
@@ -193,7 +242,8 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
         auto on_query_done = [query_run_begin, query_id, number_of_queries, &currently_running_clients,
-                              &finished_query_set_runs, &finished_queries_total, &state, this]() {
+                              &finished_query_set_runs, &finished_queries_total, &state,
+                              this](const PerformanceCounterValues& performance_counters) {
           if (finished_queries_total++ % number_of_queries == 0) {
             currently_running_clients--;
             finished_query_set_runs++;
@@ -204,6 +254,8 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
             auto& result = _query_results[query_id];
             result.duration += duration;
             result.iteration_durations.push_back(duration);
+            result.latency_histogram.record(duration);
+            if (!performance_counters.empty()) result.iteration_performance_counters.push_back(performance_counters);
             result.num_iterations++;
           }
         };
@@ -247,12 +299,15 @@ void BenchmarkRunner::_benchmark_individual_queries() {
         // The on_query_done callback will be appended to the last Task of the query,
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
-        auto on_query_done = [query_run_begin, &currently_running_clients, &result, &state]() {
+        auto on_query_done = [query_run_begin, &currently_running_clients, &result,
+                              &state](const PerformanceCounterValues& performance_counters) {
           currently_running_clients--;
           if (!state.is_done()) {  // To prevent queries to add their results after the time is up
             const auto query_run_end = std::chrono::steady_clock::now();
             result.num_iterations++;
             result.iteration_durations.push_back(query_run_end - query_run_begin);
+            result.latency_histogram.record(query_run_end - query_run_begin);
+            if (!performance_counters.empty()) result.iteration_performance_counters.push_back(performance_counters);
           }
         };
 
@@ -280,6 +335,128 @@ void BenchmarkRunner::_benchmark_individual_queries() {
   }
 }
 
+void BenchmarkRunner::_benchmark_throughput() {
+  // The query streams execute the queries on their own threads, so that each stream only issues its next query once
+  // the previous one is finished. Verifying the results is not supported for these concurrently executed queries.
+  Assert(!_config.verify, "Cannot use verification in Throughput mode");
+  Assert(_refresh_functions.empty() || _config.use_mvcc == UseMvcc::Yes, "Refresh functions require MVCC");
+
+  const auto query_ids = _query_generator->selected_queries();
+  for (const auto& query_id : query_ids) {
+    _warmup_query(query_id);
+  }
+
+  _refresh_function_results.resize(_refresh_functions.size());
+
+  // Neither the query generator nor the storing of plans is thread-safe
+  auto query_generator_mutex = std::mutex{};
+  auto completed_query_sets = std::atomic_size_t{0};
+
+  const auto benchmark_begin = std::chrono::steady_clock::now();
+  const auto deadline = benchmark_begin + _config.max_duration;
+
+  const auto run_query_stream = [&](const size_t stream_id) {
+    // Seeding with the stream id gives each stream a different, but reproducible, sequence of permutations
+    auto random_generator = std::mt19937{static_cast<std::mt19937::result_type>(stream_id)};
+    auto stream_query_ids = query_ids;
+
+    for (auto query_set_run = size_t{0}; query_set_run < _config.max_num_query_runs; ++query_set_run) {
+      std::shuffle(stream_query_ids.begin(), stream_query_ids.end(), random_generator);
+
+      for (const auto& query_id : stream_query_ids) {
+        if (std::chrono::steady_clock::now() >= deadline) return;
+
+        auto sql = std::string{};
+        {
+          const auto lock = std::lock_guard<std::mutex>{query_generator_mutex};
+          sql = _query_generator->build_query(query_id);
+        }
+
+        const auto query_run_begin = std::chrono::steady_clock::now();
+        auto pipeline_builder = SQLPipelineBuilder{sql}.with_mvcc(_config.use_mvcc);
+        if (_config.enable_visualization) pipeline_builder.dont_cleanup_temporaries();
+        auto pipeline = pipeline_builder.create_pipeline();
+        pipeline.get_result_table();
+        const auto query_run_end = std::chrono::steady_clock::now();
+
+        // Queries that did not finish in time do not count toward the results
+        if (query_run_end >= deadline) return;
+
+        auto& result = _query_results[query_id];
+        result.iteration_durations.push_back(query_run_end - query_run_begin);
+        result.latency_histogram.record(query_run_end - query_run_begin);
+        const auto performance_counters = sum_performance_counters(pipeline.get_physical_plans());
+        if (!performance_counters.empty()) result.iteration_performance_counters.push_back(performance_counters);
+        result.num_iterations++;
+
+        if (_config.enable_visualization) {
+          const auto lock = std::lock_guard<std::mutex>{query_generator_mutex};
+          _store_plan(query_id, pipeline);
+        }
+      }
+
+      completed_query_sets++;
+    }
+  };
+
+  const auto run_refresh_stream = [&]() {
+    // The refresh functions are always executed as a whole (e.g., RF2 deletes what RF1 inserted), even if the
+    // deadline passes in between
+    while (std::chrono::steady_clock::now() < deadline) {
+      for (auto refresh_function_id = size_t{0}; refresh_function_id < _refresh_functions.size();
+           ++refresh_function_id) {
+        const auto run_begin = std::chrono::steady_clock::now();
+        _refresh_functions[refresh_function_id].function();
+        const auto run_end = std::chrono::steady_clock::now();
+
+        if (run_end >= deadline) continue;
+
+        auto& result = _refresh_function_results[refresh_function_id];
+        result.iteration_durations.push_back(run_end - run_begin);
+        result.latency_histogram.record(run_end - run_begin);
+        result.num_iterations++;
+      }
+    }
+  };
+
+  std::cout << "- Running " << _config.clients << " query streams"
+            << (_refresh_functions.empty() ? "" : " and a refresh stream") << std::endl;
+
+  auto streams = std::vector<std::thread>{};
+  streams.reserve(_config.clients + 1);
+  for (auto stream_id = size_t{0}; stream_id < _config.clients; ++stream_id) {
+    streams.emplace_back(run_query_stream, stream_id);
+  }
+  if (!_refresh_functions.empty()) {
+    streams.emplace_back(run_refresh_stream);
+  }
+  for (auto& stream : streams) {
+    stream.join();
+  }
+
+  // Queries that finished after the deadline were not recorded, so the throughput refers to the benchmarked duration
+  // unless all streams ran out of query sets before
+  const auto duration = std::min(std::chrono::steady_clock::now(), deadline) - benchmark_begin;
+  for (auto& result : _query_results) {
+    result.duration = duration;
+  }
+  for (auto& result : _refresh_function_results) {
+    result.duration = duration;
+  }
+  _completed_query_sets = completed_query_sets;
+
+  auto executed_queries = size_t{0};
+  for (const auto& query_id : query_ids) {
+    executed_queries += _query_results[query_id].num_iterations;
+  }
+  const auto duration_seconds =
+      static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / 1'000'000'000;
+
+  std::cout << "  -> Executed " << executed_queries << " queries (" << _completed_query_sets
+            << " complete query sets) in " << duration_seconds << " seconds ("
+            << static_cast<float>(executed_queries) * 3'600 / duration_seconds << " queries/hour)" << std::endl;
+}
+
 void BenchmarkRunner::_warmup_query(const QueryID query_id) {
   if (_config.warmup_duration == Duration{0}) {
     return;
@@ -302,7 +479,9 @@ void BenchmarkRunner::_warmup_query(const QueryID query_id) {
 
       // The on_query_done callback will be appended to the last Task of the query,
       // to signal that the query was finished
-      auto on_query_done = [&currently_running_clients]() { currently_running_clients--; };
+      auto on_query_done = [&currently_running_clients](const PerformanceCounterValues&) {
+        currently_running_clients--;
+      };
 
       auto query_tasks = _schedule_or_execute_query(query_id, on_query_done);
       tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
@@ -320,7 +499,7 @@ void BenchmarkRunner::_warmup_query(const QueryID query_id) {
 }
 
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute_query(
-    const QueryID query_id, const std::function<void()>& done_callback) {
+    const QueryID query_id, const QueryDoneCallback& done_callback) {
   // Some queries (like TPC-H 15) require execution before we can call get_tasks() on the pipeline.
   // These queries can't be scheduled yet, therefore we fall back to "just" executing the query
   // when we don't use the scheduler anyway, so that they can be executed.
@@ -332,7 +511,7 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute
 }
 
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
-    const QueryID query_id, const std::function<void()>& done_callback) {
+    const QueryID query_id, const QueryDoneCallback& done_callback) {
   auto sql = _query_generator->build_query(query_id);
 
   auto query_tasks = std::vector<std::shared_ptr<AbstractTask>>();
@@ -342,7 +521,10 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
   auto pipeline = pipeline_builder.create_pipeline();
 
   auto tasks_per_statement = pipeline.get_tasks();
-  tasks_per_statement.back().back()->set_done_callback(done_callback);
+  // The physical plans are kept alive until the query is done, so that the counters of their operators can be summed
+  tasks_per_statement.back().back()->set_done_callback([done_callback, pqps = pipeline.get_physical_plans()]() {
+    done_callback(sum_performance_counters(pqps));
+  });
 
   for (auto tasks : tasks_per_statement) {
     CurrentScheduler::schedule_tasks(tasks);
@@ -355,7 +537,7 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
   return query_tasks;
 }
 
-void BenchmarkRunner::_execute_query(const QueryID query_id, const std::function<void()>& done_callback) {
+void BenchmarkRunner::_execute_query(const QueryID query_id, const QueryDoneCallback& done_callback) {
   auto sql = _query_generator->build_query(query_id);
 
   auto pipeline_builder = SQLPipelineBuilder{sql}.with_mvcc(_config.use_mvcc);
@@ -401,7 +583,7 @@ void BenchmarkRunner::_execute_query(const QueryID query_id, const std::function
     }
   }
 
-  if (done_callback) done_callback();
+  if (done_callback) done_callback(sum_performance_counters(pipeline.get_physical_plans()));
 
   // If necessary, keep plans for visualization
   _store_plan(query_id, pipeline);
@@ -417,11 +599,7 @@ void BenchmarkRunner::_store_plan(const QueryID query_id, SQLPipeline& pipeline)
 }
 
 void BenchmarkRunner::_create_report(std::ostream& stream) const {
-  nlohmann::json benchmarks;
-
-  for (const auto& query_id : _query_generator->selected_queries()) {
-    const auto& name = _query_generator->query_name(query_id);
-    const auto& query_result = _query_results[query_id];
+  const auto to_json = [](const std::string& name, const QueryBenchmarkResult& query_result) {
     Assert(query_result.iteration_durations.size() == query_result.num_iterations,
            "number of iterations and number of iteration durations does not match");
 
@@ -439,12 +617,52 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                      return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
                    });
 
-    nlohmann::json benchmark{{"name", name},
-                             {"iterations", query_result.num_iterations.load()},
-                             {"iteration_durations", iteration_durations},
-                             {"avg_real_time_per_iteration", time_per_query},
-                             {"items_per_second", items_per_second},
-                             {"time_unit", "ns"}};
+    const auto latency_at_percentile = [&](const double percentile) {
+      const auto latency = query_result.latency_histogram.value_at_percentile(percentile);
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+    };
+
+    auto benchmark = nlohmann::json{{"name", name},
+                                    {"iterations", query_result.num_iterations.load()},
+                                    {"iteration_durations", iteration_durations},
+                                    {"avg_real_time_per_iteration", time_per_query},
+                                    {"items_per_second", items_per_second},
+                                    {"latency_percentiles",
+                                     {{"p50", latency_at_percentile(50.0)},
+                                      {"p90", latency_at_percentile(90.0)},
+                                      {"p99", latency_at_percentile(99.0)},
+                                      {"p999", latency_at_percentile(99.9)}}},
+                                    {"time_unit", "ns"}};
+
+    // Counters that are not available are omitted
+    if (!query_result.iteration_performance_counters.empty()) {
+      auto performance_counter_sum = PerformanceCounterValues{};
+      for (const auto& performance_counters : query_result.iteration_performance_counters) {
+        performance_counter_sum += performance_counters;
+      }
+
+      auto performance_counters_per_iteration = nlohmann::json::object();
+      const auto add_counter = [&](const std::string& counter_name, const std::optional<uint64_t>& count) {
+        if (!count) return;
+        performance_counters_per_iteration[counter_name] =
+            static_cast<double>(*count) / static_cast<double>(query_result.iteration_performance_counters.size());
+      };
+      add_counter("cycles", performance_counter_sum.cycles);
+      add_counter("instructions", performance_counter_sum.instructions);
+      add_counter("llc_misses", performance_counter_sum.llc_misses);
+      add_counter("branch_misses", performance_counter_sum.branch_misses);
+      add_counter("dtlb_misses", performance_counter_sum.dtlb_misses);
+      benchmark["performance_counters_per_iteration"] = performance_counters_per_iteration;
+    }
+
+    return benchmark;
+  };
+
+  nlohmann::json benchmarks;
+
+  for (const auto& query_id : _query_generator->selected_queries()) {
+    const auto& query_result = _query_results[query_id];
+    auto benchmark = to_json(_query_generator->query_name(query_id), query_result);
 
     if (_config.verify) {
       Assert(query_result.verification_passed, "Verification should have been performed");
@@ -454,6 +672,12 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     benchmarks.push_back(benchmark);
   }
 
+  for (auto refresh_function_id = size_t{0}; refresh_function_id < _refresh_function_results.size();
+       ++refresh_function_id) {
+    benchmarks.push_back(
+        to_json(_refresh_functions[refresh_function_id].name, _refresh_function_results[refresh_function_id]));
+  }
+
   // Gather information on the (estimated) table size
   auto table_size = 0ull;
   for (const auto& table_pair : StorageManager::get().tables()) {
@@ -464,6 +688,22 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
 
   nlohmann::json summary{{"table_size_in_bytes", table_size}, {"total_run_duration_in_s", total_run_duration_seconds}};
 
+  if (_config.benchmark_mode == BenchmarkMode::Throughput) {
+    auto executed_queries = size_t{0};
+    auto duration = Duration{};
+    for (const auto& query_id : _query_generator->selected_queries()) {
+      executed_queries += _query_results[query_id].num_iterations;
+      duration = _query_results[query_id].duration;
+    }
+    const auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    const auto queries_per_hour = static_cast<double>(executed_queries) * 3'600'000'000'000 / duration_ns;
+
+    summary["throughput"] = nlohmann::json{{"query_streams", _config.clients},
+                                           {"completed_query_sets", _completed_query_sets},
+                                           {"executed_queries", executed_queries},
+                                           {"queries_per_hour", queries_per_hour}};
+  }
+
   nlohmann::json report{{"context", _context}, {"benchmarks", benchmarks}, {"summary", summary}};
 
   stream << std::setw(2) << report << std::endl;
@@ -489,16 +729,17 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("t,time", "Maximum seconds that a query (set) is run", cxxopts::value<size_t>()->default_value("60")) // NOLINT
     ("w,warmup", "Number of seconds that each query is run for warm up", cxxopts::value<size_t>()->default_value("0")) // NOLINT
     ("o,output", "File to output results to, don't specify for stdout", cxxopts::value<std::string>()->default_value("")) // NOLINT
-    ("m,mode", "IndividualQueries or PermutedQuerySet, default is IndividualQueries", cxxopts::value<std::string>()->default_value("IndividualQueries")) // NOLINT
+    ("m,mode", "IndividualQueries, PermutedQuerySet, or Throughput, default is IndividualQueries", cxxopts::value<std::string>()->default_value("IndividualQueries")) // NOLINT
     ("e,encoding", "Specify Chunk encoding as a string or as a JSON config file (for more detailed configuration, see --full_help). String options: " + encoding_strings_option, cxxopts::value<std::string>()->default_value("Dictionary"))  // NOLINT
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint>()->default_value("0")) // NOLINT
-    ("clients", "Specify how many queries should run in parallel if the scheduler is active", cxxopts::value<uint>()->default_value("1")) // NOLINT
+    ("clients", "Specify how many queries should run in parallel if the scheduler is active, or the number of query streams in Throughput mode", cxxopts::value<uint>()->default_value("1")) // NOLINT
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("perf_counters", "Sample hardware performance counters (cycles, instructions, cache, branch, and TLB misses) of the operators. Not supported with the scheduler", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -522,14 +763,26 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
   #endif
   // clang-format on
 
+  auto benchmark_mode = std::string{};
+  switch (config.benchmark_mode) {
+    case BenchmarkMode::IndividualQueries:
+      benchmark_mode = "IndividualQueries";
+      break;
+    case BenchmarkMode::PermutedQuerySet:
+      benchmark_mode = "PermutedQuerySet";
+      break;
+    case BenchmarkMode::Throughput:
+      benchmark_mode = "Throughput";
+      break;
+  }
+
   return nlohmann::json{
       {"date", timestamp_stream.str()},
       {"chunk_size", config.chunk_size},
       {"compiler", compiler.str()},
       {"build_type", HYRISE_DEBUG ? "debug" : "release"},
       {"encoding", config.encoding_config.to_json()},
-      {"benchmark_mode",
-       config.benchmark_mode == BenchmarkMode::IndividualQueries ? "IndividualQueries" : "PermutedQuerySet"},
+      {"benchmark_mode", benchmark_mode},
       {"max_runs", config.max_num_query_runs},
       {"max_duration_in_s", std::chrono::duration_cast<std::chrono::seconds>(config.max_duration).count()},
       {"warmup_duration_in_s", std::chrono::duration_cast<std::chrono::seconds>(config.warmup_duration).count()},
@@ -539,6 +792,7 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
+      {"using_performance_counters", config.enable_performance_counters},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
 
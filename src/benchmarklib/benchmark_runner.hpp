@@ -4,6 +4,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <optional>
 #include <unordered_map>
@@ -20,6 +21,7 @@
 #include "scheduler/topology.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
+#include "utils/performance_counters.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
@@ -29,12 +31,25 @@ class SQLiteWrapper;
 
 class BenchmarkRunner {
  public:
+  // A function that modifies the data while the queries run, e.g., the TPC-H refresh functions. It is executed in a
+  // separate stream in BenchmarkMode::Throughput and benchmarked like a query.
+  // Called when a query is finished, with the sum of the hardware performance counters of its operators
+  using QueryDoneCallback = std::function<void(const PerformanceCounterValues&)>;
+
+  struct RefreshFunction {
+    std::string name;
+    std::function<void()> function;
+  };
+
   BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
                   std::unique_ptr<AbstractTableGenerator> table_generator, const nlohmann::json& context);
   ~BenchmarkRunner();
 
   void run();
 
+  // Sets the refresh functions that are executed in a loop alongside the query streams in BenchmarkMode::Throughput
+  void set_refresh_functions(const std::vector<RefreshFunction>& refresh_functions);
+
   static cxxopts::Options get_basic_cli_options(const std::string& benchmark_name);
 
   static nlohmann::json create_context(const BenchmarkConfig& config);
@@ -46,19 +61,22 @@ class BenchmarkRunner {
   // Run benchmark in BenchmarkMode::IndividualQueries mode
   void _benchmark_individual_queries();
 
+  // Run benchmark in BenchmarkMode::Throughput mode
+  void _benchmark_throughput();
+
   // Execute warmup run of a query
   void _warmup_query(const QueryID query_id);
 
   // Calls _schedule_query if the scheduler is active, otherwise calls _execute_query and returns no tasks
   std::vector<std::shared_ptr<AbstractTask>> _schedule_or_execute_query(const QueryID query_id,
-                                                                        const std::function<void()>& done_callback);
+                                                                        const QueryDoneCallback& done_callback);
 
   // Schedule and return all tasks for named_query
   std::vector<std::shared_ptr<AbstractTask>> _schedule_query(const QueryID query_id,
-                                                             const std::function<void()>& done_callback);
+                                                             const QueryDoneCallback& done_callback);
 
   // Execute named_query
-  void _execute_query(const QueryID query_id, const std::function<void()>& done_callback);
+  void _execute_query(const QueryID query_id, const QueryDoneCallback& done_callback);
 
   // If visualization is enabled, stores an executed plan
   void _store_plan(const QueryID query_id, SQLPipeline& pipeline);
@@ -84,6 +102,14 @@ class BenchmarkRunner {
   // Stores the results of the query executions. Its length is defined by the number of available queries.
   std::vector<QueryBenchmarkResult> _query_results;
 
+  // In BenchmarkMode::Throughput, the refresh functions run alongside the queries, and their results are reported like
+  // those of the queries
+  std::vector<RefreshFunction> _refresh_functions;
+  std::vector<QueryBenchmarkResult> _refresh_function_results;
+
+  // The number of query sets that the query streams completed in BenchmarkMode::Throughput
+  size_t _completed_query_sets{0};
+
   nlohmann::json _context;
 
   std::optional<PerformanceWarningDisabler> _performance_warning_disabler;
@@ -3,6 +3,8 @@
 #include <memory>
 #include <string>
 
+#include "storage/chunk_encoder.hpp"
+
 namespace opossum {
 
 class EncodingConfig;
@@ -15,6 +17,11 @@ class BenchmarkTableEncoder {
   //              false, if the @param table was already encoded as required by @param encoding_config
   static bool encode(const std::string& table_name, const std::shared_ptr<Table>& table,
                      const EncodingConfig& encoding_config);
+
+  // @return      the ChunkEncodingSpec that @param encoding_config requests for the columns of @param table. Table
+  //              generators use this to encode chunks right after generating them.
+  static ChunkEncodingSpec create_chunk_encoding_spec(const std::string& table_name, const Table& table,
+                                                      const EncodingConfig& encoding_config);
 };
 
 }  // namespace opossum
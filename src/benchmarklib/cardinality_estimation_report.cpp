@@ -0,0 +1,96 @@
+#include "cardinality_estimation_report.hpp"
+
+#include <json.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/estimate_operator_statistics.hpp"
+
+namespace opossum {
+
+void CardinalityEstimationReport::add_query(const std::string& query_name, const std::string& sql) {
+  auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  pipeline.get_result_tables();
+
+  auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  for (const auto& pqp : pipeline.get_physical_plans()) {
+    _collect_operators(pqp, operators);
+  }
+
+  auto query_cardinalities = QueryCardinalities{query_name, {}};
+  for (const auto& op : operators) {
+    const auto estimated_row_count = estimate_output_row_count(*op);
+    if (!estimated_row_count) continue;
+
+    const auto actual_row_count = op->performance_data().output_row_count;
+    const auto clamped_estimated_row_count = std::max(*estimated_row_count, 1.0f);
+    const auto clamped_actual_row_count = std::max(static_cast<float>(actual_row_count), 1.0f);
+    const auto q_error = std::max(clamped_estimated_row_count / clamped_actual_row_count,
+                                  clamped_actual_row_count / clamped_estimated_row_count);
+
+    query_cardinalities.operators.emplace_back(OperatorCardinality{
+        op->name(), op->description(DescriptionMode::SingleLine), *estimated_row_count, actual_row_count, q_error});
+  }
+
+  _queries.emplace_back(std::move(query_cardinalities));
+}
+
+void CardinalityEstimationReport::write_json(std::ostream& stream) const {
+  auto queries = nlohmann::json::array();
+  for (const auto& query : _queries) {
+    auto operators = nlohmann::json::array();
+    for (const auto& op : query.operators) {
+      operators.push_back(nlohmann::json{{"name", op.name},
+                                         {"description", op.description},
+                                         {"estimated_row_count", op.estimated_row_count},
+                                         {"actual_row_count", op.actual_row_count},
+                                         {"q_error", op.q_error}});
+    }
+    queries.push_back(nlohmann::json{{"name", query.name}, {"operators", operators}});
+  }
+
+  stream << std::setw(2) << nlohmann::json{{"queries", queries}} << std::endl;
+}
+
+void CardinalityEstimationReport::print_summary(std::ostream& stream) const {
+  auto q_errors = std::vector<float>{};
+
+  stream << "- Cardinality estimation (maximum q-error per query):" << std::endl;
+  for (const auto& query : _queries) {
+    auto max_q_error = 1.0f;
+    for (const auto& op : query.operators) {
+      max_q_error = std::max(max_q_error, op.q_error);
+      q_errors.emplace_back(op.q_error);
+    }
+    stream << "  " << query.name << ": " << max_q_error << std::endl;
+  }
+
+  if (q_errors.empty()) return;
+
+  std::sort(q_errors.begin(), q_errors.end());
+  const auto percentile = [&](const double share) {
+    return q_errors[std::min(static_cast<size_t>(share * static_cast<double>(q_errors.size())), q_errors.size() - 1)];
+  };
+
+  stream << "- q-errors of " << q_errors.size() << " operators: median " << percentile(0.5) << ", 90th percentile "
+         << percentile(0.9) << ", 95th percentile " << percentile(0.95) << ", maximum " << q_errors.back()
+         << std::endl;
+}
+
+void CardinalityEstimationReport::_collect_operators(const std::shared_ptr<const AbstractOperator>& op,
+                                                     std::vector<std::shared_ptr<const AbstractOperator>>& operators) {
+  // Operators that are the input of multiple operators are only considered once
+  if (!op || std::find(operators.cbegin(), operators.cend(), op) != operators.cend()) return;
+
+  operators.emplace_back(op);
+  _collect_operators(op->input_left(), operators);
+  _collect_operators(op->input_right(), operators);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Compares the output cardinalities that the optimizer estimated for the operators of queries with the actual ones.
+ * The quality of an estimation is measured by its q-error, i.e., max(estimated / actual, actual / estimated), where
+ * both cardinalities are clamped to at least one row. A q-error of 1 is a perfect estimation. Only operators for which
+ * the optimizer provides an estimation (see estimate_output_row_count()) are considered.
+ *
+ * The join order benchmark uses this to quantify how well the TableStatistics estimate the cardinalities of its
+ * (heavily skewed) joins.
+ */
+class CardinalityEstimationReport {
+ public:
+  // Executes the query and records the cardinalities of all of its operators
+  void add_query(const std::string& query_name, const std::string& sql);
+
+  // Writes all recorded cardinalities and their q-errors as JSON
+  void write_json(std::ostream& stream) const;
+
+  // Prints the maximum q-error of each query and the distribution of the q-errors of all operators
+  void print_summary(std::ostream& stream) const;
+
+ protected:
+  struct OperatorCardinality {
+    std::string name;
+    std::string description;
+    float estimated_row_count;
+    size_t actual_row_count;
+    float q_error;
+  };
+
+  struct QueryCardinalities {
+    std::string name;
+    std::vector<OperatorCardinality> operators;
+  };
+
+  static void _collect_operators(const std::shared_ptr<const AbstractOperator>& op,
+                                 std::vector<std::shared_ptr<const AbstractOperator>>& operators);
+
+  std::vector<QueryCardinalities> _queries;
+};
+
+}  // namespace opossum
@@ -56,15 +56,6 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
   std::cout << "- Running in " + std::string(enable_scheduler ? "multi" : "single") + "-threaded mode" << core_info
             << std::endl;
 
-  const auto clients = json_config.value("clients", default_config.clients);
-  std::cout << "- " + std::to_string(clients) + " simulated clients are scheduling queries in parallel" << std::endl;
-
-  if (cores != default_config.cores || clients != default_config.clients) {
-    if (!enable_scheduler) {
-      PerformanceWarning("'--cores' or '--clients' specified but ignored, because '--scheduler' is false")
-    }
-  }
-
   // Determine benchmark and display it
   const auto benchmark_mode_str = json_config.value("mode", "IndividualQueries");
   auto benchmark_mode = BenchmarkMode::IndividualQueries;  // Just to init it deterministically
@@ -72,11 +63,28 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     benchmark_mode = BenchmarkMode::IndividualQueries;
   } else if (benchmark_mode_str == "PermutedQuerySet") {
     benchmark_mode = BenchmarkMode::PermutedQuerySet;
+  } else if (benchmark_mode_str == "Throughput") {
+    benchmark_mode = BenchmarkMode::Throughput;
   } else {
     throw std::runtime_error("Invalid benchmark mode: '" + benchmark_mode_str + "'");
   }
   std::cout << "- Running benchmark in '" << benchmark_mode_str << "' mode" << std::endl;
 
+  const auto clients = json_config.value("clients", default_config.clients);
+  if (benchmark_mode == BenchmarkMode::Throughput) {
+    // Each query stream runs on its own thread, so the streams run in parallel even without the scheduler
+    std::cout << "- " + std::to_string(clients) + " query streams are running in parallel" << std::endl;
+  } else {
+    std::cout << "- " + std::to_string(clients) + " simulated clients are scheduling queries in parallel" << std::endl;
+  }
+
+  if (cores != default_config.cores ||
+      (clients != default_config.clients && benchmark_mode != BenchmarkMode::Throughput)) {
+    if (!enable_scheduler) {
+      PerformanceWarning("'--cores' or '--clients' specified but ignored, because '--scheduler' is false")
+    }
+  }
+
   const auto enable_visualization = json_config.value("visualize", default_config.enable_visualization);
   std::cout << "- Visualization is " << (enable_visualization ? "on" : "off") << std::endl;
 
@@ -130,10 +138,27 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Not caching tables as binary files" << std::endl;
   }
 
-  return BenchmarkConfig{
-      benchmark_mode, chunk_size,         *encoding_config, max_runs, timeout_duration, warmup_duration,
-      use_mvcc,       output_file_path,   enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables};
+  const auto enable_performance_counters =
+      json_config.value("perf_counters", default_config.enable_performance_counters);
+  if (enable_performance_counters) {
+    std::cout << "- Sampling hardware performance counters of the operators" << std::endl;
+  }
+
+  return BenchmarkConfig{benchmark_mode,
+                         chunk_size,
+                         *encoding_config,
+                         max_runs,
+                         timeout_duration,
+                         warmup_duration,
+                         use_mvcc,
+                         output_file_path,
+                         enable_scheduler,
+                         cores,
+                         clients,
+                         enable_visualization,
+                         verify,
+                         cache_binary_tables,
+                         enable_performance_counters};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -158,6 +183,7 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("perf_counters", parse_result["perf_counters"].as<bool>());
 
   return json_config;
 }
@@ -59,14 +59,14 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
 
   /**
    * 2. Check for "out of date" binary files, i.e., whether both a binary and textual file exists AND the
-   *    binary file is older than the textual file.
+   *    binary file is older than the textual file or was written in an older version of the binary format.
    */
   for (auto& [table_name, table_info] : table_info_by_name) {
     if (table_info.binary_file_path && table_info.text_file_path) {
       const auto last_binary_write = std::filesystem::last_write_time(*table_info.binary_file_path);
       const auto last_text_write = std::filesystem::last_write_time(*table_info.text_file_path);
 
-      if (last_binary_write < last_text_write) {
+      if (last_binary_write < last_text_write || !ImportBinary::has_current_format(*table_info.binary_file_path)) {
         std::cout << "-  Binary file '" << (*table_info.binary_file_path)
                   << "' is out of date and needs to be re-exported" << std::endl;
         table_info.binary_file_out_of_date = true;
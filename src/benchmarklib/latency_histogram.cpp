@@ -0,0 +1,79 @@
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LatencyHistogram::LatencyHistogram() {
+  for (auto& count : _counts) {
+    count.store(0, std::memory_order_relaxed);
+  }
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& other) { *this = other; }
+
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other) {
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    _counts[bucket_index].store(other._counts[bucket_index].load(std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+  }
+  return *this;
+}
+
+void LatencyHistogram::record(const Duration duration) {
+  const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  const auto value = static_cast<uint64_t>(std::max(nanoseconds, decltype(nanoseconds){0}));
+  _counts[_bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::count() const {
+  auto count = uint64_t{0};
+  for (const auto& bucket_count : _counts) {
+    count += bucket_count.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+Duration LatencyHistogram::value_at_percentile(const double percentile) const {
+  Assert(percentile >= 0.0 && percentile <= 100.0, "Percentile has to be in [0, 100]");
+
+  const auto total_count = count();
+  if (total_count == 0) return Duration{0};
+
+  // The number of values that are smaller than or equal to the value at the percentile
+  const auto rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(percentile / 100.0 * total_count)));
+
+  auto cumulative_count = uint64_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    cumulative_count += _counts[bucket_index].load(std::memory_order_relaxed);
+    if (cumulative_count >= rank) {
+      const auto value = std::min(_highest_equivalent_value(bucket_index), uint64_t{INT64_MAX});
+      return std::chrono::duration_cast<Duration>(std::chrono::nanoseconds{static_cast<int64_t>(value)});
+    }
+  }
+
+  // The counts only grow, so the buckets hold at least total_count values
+  Fail("Could not find the value at the percentile");
+}
+
+size_t LatencyHistogram::_bucket_index(const uint64_t value) {
+  if (value < SUB_BUCKET_COUNT) return value;
+
+  // Values in [2^msb, 2^(msb + 1)) are split into SUB_BUCKET_COUNT / 2 sub-buckets of width 2^exponent
+  const auto msb = uint64_t{63} - __builtin_clzll(value);
+  const auto exponent = msb - SUB_BUCKET_BITS + 1;
+  return exponent * (SUB_BUCKET_COUNT / 2) + (value >> exponent);
+}
+
+uint64_t LatencyHistogram::_highest_equivalent_value(const size_t bucket_index) {
+  if (bucket_index < SUB_BUCKET_COUNT) return bucket_index;
+
+  const auto exponent = bucket_index / (SUB_BUCKET_COUNT / 2) - 1;
+  const auto sub_bucket = bucket_index % (SUB_BUCKET_COUNT / 2) + SUB_BUCKET_COUNT / 2;
+  return ((sub_bucket + 1) << exponent) - 1;
+}
+
+}  // namespace opossum
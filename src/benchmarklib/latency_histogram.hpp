@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include "benchmark_config.hpp"
+
+namespace opossum {
+
+/**
+ * Histogram of latencies in the style of HdrHistogram. The range of values is split into buckets with a logarithmic
+ * width: values below SUB_BUCKET_COUNT nanoseconds each get their own bucket, larger values are recorded in one of
+ * SUB_BUCKET_COUNT / 2 linear sub-buckets of their power of two. Thus, the value at a percentile is exact up to a
+ * relative error of 2 / SUB_BUCKET_COUNT (i.e., < 2%), independently of its magnitude, while the histogram has a
+ * fixed size.
+ *
+ * record() is lock-free and can be called by multiple threads concurrently.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr auto SUB_BUCKET_BITS = uint64_t{7};
+  static constexpr auto SUB_BUCKET_COUNT = uint64_t{1} << SUB_BUCKET_BITS;
+  static constexpr auto BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 2) * (SUB_BUCKET_COUNT / 2);
+
+  LatencyHistogram();
+  LatencyHistogram(const LatencyHistogram& other);
+  LatencyHistogram& operator=(const LatencyHistogram& other);
+
+  void record(const Duration duration);
+
+  uint64_t count() const;
+
+  // @return  the highest latency that is equivalent (i.e., in the same bucket) to the latency at @param percentile,
+  //          which is in [0, 100]. Zero if nothing was recorded.
+  Duration value_at_percentile(const double percentile) const;
+
+ protected:
+  static size_t _bucket_index(const uint64_t value);
+  static uint64_t _highest_equivalent_value(const size_t bucket_index);
+
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> _counts;
+};
+
+}  // namespace opossum
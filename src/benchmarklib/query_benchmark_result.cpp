@@ -8,6 +8,8 @@ QueryBenchmarkResult::QueryBenchmarkResult(QueryBenchmarkResult&& other) noexcep
   num_iterations.store(other.num_iterations);
   duration = other.duration;
   iteration_durations = other.iteration_durations;
+  latency_histogram = other.latency_histogram;
+  iteration_performance_counters = other.iteration_performance_counters;
 }
 
 }  // namespace opossum
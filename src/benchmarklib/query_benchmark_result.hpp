@@ -3,6 +3,8 @@
 #include <atomic>
 
 #include "benchmark_config.hpp"
+#include "latency_histogram.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
@@ -16,6 +18,10 @@ struct QueryBenchmarkResult : public Noncopyable {
   std::atomic<size_t> num_iterations = 0;
   Duration duration = Duration{};
   tbb::concurrent_vector<Duration> iteration_durations;
+  LatencyHistogram latency_histogram;
+
+  // The sum of the hardware performance counters of the operators of each iteration, if counters are enabled
+  tbb::concurrent_vector<PerformanceCounterValues> iteration_performance_counters;
 
   std::optional<bool> verification_passed;
 };
@@ -0,0 +1,90 @@
+#include "tpch_refresh_functions.hpp"
+
+#include <algorithm>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch_table_generator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+using namespace opossum::expression_functional;  // NOLINT
+
+TpchRefreshFunctions::TpchRefreshFunctions(float scale_factor, ChunkOffset chunk_size) {
+  // The TPC-H specification has each refresh function modify SF * 1500 orders (and their lineitems)
+  const auto order_count = std::max(size_t{1}, static_cast<size_t>(scale_factor * 1'500));
+
+  std::tie(_new_orders, _new_lineitems) =
+      TpchTableGenerator{scale_factor, chunk_size}.generate_refresh_orders(order_count);
+  _first_new_orderkey = _new_orders->get_value<int32_t>(ColumnID{0}, 0);
+}
+
+void TpchRefreshFunctions::rf1() {
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  if (_insert("orders", _new_orders, transaction_context) &&
+      _insert("lineitem", _new_lineitems, transaction_context)) {
+    transaction_context->commit();
+  } else {
+    transaction_context->rollback();
+  }
+}
+
+void TpchRefreshFunctions::rf2() {
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  if (_delete_new_orders("lineitem", "l_orderkey", transaction_context) &&
+      _delete_new_orders("orders", "o_orderkey", transaction_context)) {
+    transaction_context->commit();
+  } else {
+    transaction_context->rollback();
+  }
+}
+
+bool TpchRefreshFunctions::_insert(const std::string& table_name, const std::shared_ptr<Table>& values,
+                                   const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+
+  table_wrapper->execute();
+  insert->execute();
+
+  return !insert->execute_failed();
+}
+
+bool TpchRefreshFunctions::_delete_new_orders(const std::string& table_name, const std::string& orderkey_column_name,
+                                              const std::shared_ptr<TransactionContext>& transaction_context) const {
+  const auto& table = StorageManager::get().get_table(table_name);
+  Assert(table->has_mvcc() == UseMvcc::Yes, "TPC-H refresh functions require MVCC");
+
+  const auto orderkey_column_id = table->column_id_by_name(orderkey_column_name);
+  const auto orderkey_column = pqp_column_(orderkey_column_id, DataType::Int, false, orderkey_column_name);
+
+  const auto get_table = std::make_shared<GetTable>(table_name);
+  const auto validate = std::make_shared<Validate>(get_table);
+  const auto table_scan =
+      std::make_shared<TableScan>(validate, greater_than_equals_(orderkey_column, _first_new_orderkey));
+  const auto delete_op = std::make_shared<Delete>(table_scan);
+  validate->set_transaction_context(transaction_context);
+  delete_op->set_transaction_context(transaction_context);
+
+  get_table->execute();
+  validate->execute();
+  table_scan->execute();
+  delete_op->execute();
+
+  return !delete_op->execute_failed();
+}
+
+}  // namespace opossum
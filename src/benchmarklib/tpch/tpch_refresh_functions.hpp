@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+/**
+ * The refresh functions of TPC-H (see the TPC-H specification, 2.5), which modify orders and lineitem concurrently to
+ * the query streams of BenchmarkMode::Throughput:
+ *  - RF1 inserts SF * 1500 new orders and their lineitems using the Insert operator
+ *  - RF2 deletes these orders and their lineitems using the Delete operator
+ *
+ * The new orders are generated by dbgen once, as if the orders table had more rows, so that their keys are larger
+ * than all existing ones. Unlike the specification, where RF2 deletes old orders, RF2 deletes the orders inserted by
+ * RF1. This way, the size of the tables does not change and any number of refresh pairs can be run. Each refresh
+ * function runs in a transaction, so the tables need to have MVCC enabled.
+ */
+class TpchRefreshFunctions {
+ public:
+  TpchRefreshFunctions(float scale_factor, ChunkOffset chunk_size);
+
+  void rf1();
+  void rf2();
+
+ private:
+  static bool _insert(const std::string& table_name, const std::shared_ptr<Table>& values,
+                      const std::shared_ptr<TransactionContext>& transaction_context);
+
+  // Deletes the rows of @param table_name whose @param orderkey_column_name is one of the new orders
+  bool _delete_new_orders(const std::string& table_name, const std::string& orderkey_column_name,
+                          const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  std::shared_ptr<Table> _new_orders;
+  std::shared_ptr<Table> _new_lineitems;
+  int32_t _first_new_orderkey{};
+};
+
+}  // namespace opossum
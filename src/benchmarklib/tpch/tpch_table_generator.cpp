@@ -4,17 +4,40 @@ extern "C" {
 #include <dss.h>
 #include <dsstypes.h>
 #include <rnd.h>
+
+// Seed skipping functions of dbgen (speed_seed.c), which advance the random number streams of a table by a number of
+// rows
+long sd_cust(int child, DSS_HUGE skip_count);  // NOLINT(runtime/int)
+long sd_line(int child, DSS_HUGE skip_count);  // NOLINT(runtime/int)
+long sd_order(int child, DSS_HUGE skip_count);  // NOLINT(runtime/int)
+long sd_part(int child, DSS_HUGE skip_count);  // NOLINT(runtime/int)
+long sd_psupp(int child, DSS_HUGE skip_count);  // NOLINT(runtime/int)
+long sd_supp(int child, DSS_HUGE skip_count);  // NOLINT(runtime/int)
 }
 
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <utility>
 
 #include "boost/hana/for_each.hpp"
 #include "boost/hana/integral_constant.hpp"
+#include "boost/hana/range.hpp"
 #include "boost/hana/zip_with.hpp"
 
 #include "benchmark_config.hpp"
+#include "benchmark_table_encoder.hpp"
+#include "operators/import_binary.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/mvcc_data.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
 
 extern char** asc_date;
 extern seed_t seed[];
@@ -54,9 +77,11 @@ const auto region_column_names = boost::hana::make_tuple("r_regionkey", "r_name"
 // clang-format on
 
 /**
- * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. Keeps a vector
- * for each column and appends values to them in append_row(). Automatically creates chunks in accordance with the
- * specified chunk size.
+ * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. The rows are
+ * generated in independent ranges (see TpchTableGenerator::generate()). For each range, a vector per column is kept
+ * that append_row() adds values to. Once a range is complete, finish_range() cuts all chunks of the specified chunk size
+ * whose rows exist by now, encodes them right away and releases the values of the ranges they were cut from. Thus, only
+ * the rows of unfinished chunks are held unencoded. finish_table() appends the encoded chunks to the table in order.
  *
  * No real need to tie this to TPCH, but atm it is only used here so that's where it resides.
  */
@@ -65,8 +90,14 @@ class TableBuilder {
  public:
   template <typename... Strings>
   TableBuilder(size_t chunk_size, const boost::hana::tuple<DataTypes...>& column_types,
-               const boost::hana::tuple<Strings...>& column_names, opossum::UseMvcc use_mvcc, size_t estimated_rows = 0)
-      : _use_mvcc(use_mvcc), _estimated_rows_per_chunk(estimated_rows < chunk_size ? estimated_rows : chunk_size) {
+               const boost::hana::tuple<Strings...>& column_names, opossum::UseMvcc use_mvcc, size_t range_count,
+               size_t estimated_rows_per_range, const std::string& table_name,
+               const opossum::EncodingConfig& encoding_config)
+      : _ranges(range_count),
+        _estimated_rows_per_range(estimated_rows_per_range),
+        _range_row_counts(range_count),
+        _range_begins(range_count + 1),
+        _range_reader_counts(range_count) {
     /**
      * Create a tuple ((column_name0, column_type0), (column_name1, column_type1), ...) so we can iterate over the
      * columns.
@@ -88,58 +119,179 @@ class TableBuilder {
                              return definitions;
                            });
     _table = std::make_shared<opossum::Table>(column_definitions, opossum::TableType::Data, chunk_size, use_mvcc);
-
-    // Reserve some space in the vectors
-    boost::hana::for_each(_data_vectors, [&](auto&& vector) { vector.reserve(_estimated_rows_per_chunk); });
+    _chunk_encoding_spec =
+        opossum::BenchmarkTableEncoder::create_chunk_encoding_spec(table_name, *_table, encoding_config);
   }
 
-  std::shared_ptr<opossum::Table> finish_table() {
-    if (_current_chunk_row_count() > 0) {
-      _emit_chunk();
+  // Adds a row to the range @param range_idx. Rows can be added to different ranges concurrently.
+  void append_row(size_t range_idx, DataTypes&&... column_values) {
+    auto& range = _ranges[range_idx];
+    if (_row_count(range) == 0) {
+      boost::hana::for_each(range, [&](auto& vector) { vector.reserve(_estimated_rows_per_range); });
     }
 
-    return _table;
-  }
-
-  void append_row(DataTypes&&... column_values) {
     // Create a tuple ([&data_vector0, value0], ...)
     auto vectors_and_values = boost::hana::zip_with(
         [](auto& vector, auto&& value) {
           return boost::hana::make_tuple(std::reference_wrapper(vector), std::forward<decltype(value)>(value));
         },
-        _data_vectors, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
+        range, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
 
     // Add the values to their respective data vector
     boost::hana::for_each(vectors_and_values, [](auto&& vector_and_value) {
       vector_and_value[boost::hana::llong_c<0>].get().emplace_back(
           std::move(vector_and_value[boost::hana::llong_c<1>]));
     });
+  }
+
+  // Has to be called once all rows of the range @param range_idx were appended. Builds and encodes the chunks that are
+  // complete now. Different ranges can be finished concurrently.
+  void finish_range(size_t range_idx) {
+    auto pending_chunks = std::vector<PendingChunk>{};
+
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      _range_row_counts[range_idx] = _row_count(_ranges[range_idx]);
+
+      // The offsets of the ranges within the table are known for the ranges up to the first unfinished one
+      while (_finished_range_count < _ranges.size() && _range_row_counts[_finished_range_count]) {
+        _range_begins[_finished_range_count + 1] =
+            _range_begins[_finished_range_count] + *_range_row_counts[_finished_range_count];
+        ++_finished_range_count;
+      }
+
+      const auto range_begins_end = _range_begins.cbegin() + _finished_range_count + 1;
+      const auto finished_row_count = _range_begins[_finished_range_count];
+      const auto all_ranges_finished = _finished_range_count == _ranges.size();
+      const auto chunk_size = size_t{_table->max_chunk_size()};
+
+      // Only the last chunk of the table may be shorter than the chunk size
+      while (_cut_row_count + chunk_size <= finished_row_count ||
+             (all_ranges_finished && _cut_row_count < finished_row_count)) {
+        auto& pending_chunk = pending_chunks.emplace_back();
+        pending_chunk.chunk_idx = _chunks.size();
+        pending_chunk.chunk_begin = _cut_row_count;
+        pending_chunk.chunk_end = std::min(_cut_row_count + chunk_size, finished_row_count);
+
+        // The last range that begins at or before the chunk (empty ranges are skipped this way) and the first range
+        // that begins at or after its end
+        pending_chunk.first_range_idx = static_cast<size_t>(
+            std::upper_bound(_range_begins.cbegin(), range_begins_end, pending_chunk.chunk_begin) -
+            _range_begins.cbegin() - 1);
+        pending_chunk.end_range_idx = static_cast<size_t>(
+            std::lower_bound(_range_begins.cbegin(), range_begins_end, pending_chunk.chunk_end) -
+            _range_begins.cbegin());
+
+        for (auto reader_idx = pending_chunk.first_range_idx; reader_idx < pending_chunk.end_range_idx; ++reader_idx) {
+          ++_range_reader_counts[reader_idx];
+        }
+
+        _chunks.emplace_back();
+        _cut_row_count = pending_chunk.chunk_end;
+      }
+    }
+
+    for (const auto& pending_chunk : pending_chunks) {
+      const auto chunk = _build_chunk(pending_chunk);
+
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      _chunks[pending_chunk.chunk_idx] = chunk;
+
+      // Release the values of ranges that no other chunk is cut from anymore
+      for (auto reader_idx = pending_chunk.first_range_idx; reader_idx < pending_chunk.end_range_idx; ++reader_idx) {
+        --_range_reader_counts[reader_idx];
+        if (_range_reader_counts[reader_idx] == 0 && _range_begins[reader_idx + 1] <= _cut_row_count) {
+          _ranges[reader_idx] = Range{};
+        }
+      }
+    }
+  }
+
+  // Expects all ranges to be finished
+  std::shared_ptr<opossum::Table> finish_table() {
+    Assert(_finished_range_count == _ranges.size(), "All ranges need to be finished before the table");
 
-    if (_current_chunk_row_count() >= _table->max_chunk_size()) {
-      _emit_chunk();
+    for (const auto& chunk : _chunks) {
+      _table->append_chunk(chunk);
     }
+    _chunks.clear();
+
+    return _table;
   }
 
  private:
-  std::shared_ptr<opossum::Table> _table;
-  opossum::UseMvcc _use_mvcc;
-  boost::hana::tuple<std::vector<DataTypes>...> _data_vectors;
-  size_t _estimated_rows_per_chunk;
+  using Range = boost::hana::tuple<std::vector<DataTypes>...>;
 
-  size_t _current_chunk_row_count() const { return _data_vectors[boost::hana::llong_c<0>].size(); }
+  // A chunk that is cut from the ranges [first_range_idx, end_range_idx)
+  struct PendingChunk {
+    size_t chunk_idx;
+    size_t chunk_begin;
+    size_t chunk_end;
+    size_t first_range_idx;
+    size_t end_range_idx;
+  };
 
-  void _emit_chunk() {
-    opossum::Segments segments;
+  static constexpr auto _column_ids =
+      boost::hana::make_range(boost::hana::size_c<0>, boost::hana::size_c<sizeof...(DataTypes)>);
 
-    // Create a segment from each data vector and add it to the Chunk, then re-initialize the vector
-    boost::hana::for_each(_data_vectors, [&](auto&& vector) {
-      using T = typename std::decay_t<decltype(vector)>::value_type;
-      // reason for nolint: clang-tidy wants this to be a forward, but that doesn't work
-      segments.push_back(std::make_shared<opossum::ValueSegment<T>>(std::move(vector)));  // NOLINT
-      vector = std::decay_t<decltype(vector)>();
-      vector.reserve(_estimated_rows_per_chunk);
+  std::shared_ptr<opossum::Table> _table;
+  opossum::ChunkEncodingSpec _chunk_encoding_spec;
+  std::vector<Range> _ranges;
+  size_t _estimated_rows_per_range;
+
+  // Guards all members below as well as releasing the values of a range
+  std::mutex _mutex;
+  std::vector<std::optional<size_t>> _range_row_counts;
+  // _range_begins[range_idx] is the offset of the first row of a range within the table. It is only set for ranges
+  // up to _finished_range_count, i.e., once all ranges before them are finished.
+  std::vector<size_t> _range_begins;
+  size_t _finished_range_count{0};
+  // Number of chunks that are currently cut from a range
+  std::vector<size_t> _range_reader_counts;
+  // Number of rows that were assigned to chunks
+  size_t _cut_row_count{0};
+  std::vector<std::shared_ptr<opossum::Chunk>> _chunks;
+
+  static size_t _row_count(const Range& range) { return range[boost::hana::llong_c<0>].size(); }
+
+  // Reads only finished ranges, so no lock is needed
+  std::shared_ptr<opossum::Chunk> _build_chunk(const PendingChunk& pending_chunk) {
+    const auto chunk_begin = pending_chunk.chunk_begin;
+    const auto chunk_end = pending_chunk.chunk_end;
+    auto range_idx = pending_chunk.first_range_idx;
+
+    auto chunk_values = Range{};
+    if (_range_begins[range_idx] == chunk_begin && _range_begins[range_idx + 1] == chunk_end) {
+      // The chunk consists of exactly one range, which no other chunk reads from
+      chunk_values = std::move(_ranges[range_idx]);
+    } else {
+      boost::hana::for_each(chunk_values, [&](auto& values) { values.reserve(chunk_end - chunk_begin); });
+      for (; range_idx < pending_chunk.end_range_idx; ++range_idx) {
+        const auto slice_begin = std::max(chunk_begin, _range_begins[range_idx]) - _range_begins[range_idx];
+        const auto slice_end = std::min(chunk_end, _range_begins[range_idx + 1]) - _range_begins[range_idx];
+
+        boost::hana::for_each(_column_ids, [&](const auto column_id) {
+          const auto& range_values = _ranges[range_idx][column_id];
+          chunk_values[column_id].insert(chunk_values[column_id].end(), range_values.cbegin() + slice_begin,
+                                         range_values.cbegin() + slice_end);
+        });
+      }
+    }
+
+    opossum::Segments segments;
+    boost::hana::for_each(chunk_values, [&](auto& values) {
+      using T = typename std::decay_t<decltype(values)>::value_type;
+      segments.push_back(std::make_shared<opossum::ValueSegment<T>>(std::move(values)));
     });
-    _table->append_chunk(segments);
+
+    auto mvcc_data = std::shared_ptr<opossum::MvccData>{};
+    if (_table->has_mvcc() == opossum::UseMvcc::Yes) {
+      mvcc_data = std::make_shared<opossum::MvccData>(chunk_end - chunk_begin);
+    }
+
+    const auto chunk = std::make_shared<opossum::Chunk>(segments, mvcc_data);
+    opossum::ChunkEncoder::encode_chunk(chunk, _table->column_data_types(), _chunk_encoding_spec);
+    return chunk;
   }
 };
 
@@ -173,6 +325,38 @@ float convert_money(DSS_HUGE cents) {
   return dollars + (static_cast<float>(cents)) / 100.0f;
 }
 
+/**
+ * Generates the orders [first_order_idx, end_order_idx) and their lineitems into the range @param range_idx of the
+ * builders and finishes that range. Expects dbgen's random number streams to be reset.
+ */
+template <typename OrderBuilder, typename LineitemBuilder>
+void generate_orders(const size_t range_idx, const size_t first_order_idx, const size_t end_order_idx,
+                     const float scale_factor, OrderBuilder& order_builder, LineitemBuilder& lineitem_builder) {
+  sd_order(0, first_order_idx);
+  sd_line(0, first_order_idx);
+
+  for (auto order_idx = first_order_idx; order_idx < end_order_idx; ++order_idx) {
+    const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, scale_factor);
+
+    order_builder.append_row(range_idx, order.okey, order.custkey, pmr_string(1, order.orderstatus),
+                             convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
+                             order.spriority, order.comment);
+
+    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
+      const auto& lineitem = order.l[line_idx];
+
+      lineitem_builder.append_row(range_idx, lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt,
+                                  lineitem.quantity, convert_money(lineitem.eprice), convert_money(lineitem.discount),
+                                  convert_money(lineitem.tax), pmr_string(1, lineitem.rflag[0]),
+                                  pmr_string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
+                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
+    }
+  }
+
+  order_builder.finish_range(range_idx);
+  lineitem_builder.finish_range(range_idx);
+}
+
 /**
  * Call this after using dbgen to avoid memory leaks
  */
@@ -196,6 +380,18 @@ void dbgen_cleanup() {
   asc_date = nullptr;
 }
 
+// Upper bound for the number of rows that a single JobTask generates, so that tables are generated in parallel even if
+// they are stored in very large chunks
+constexpr auto MAX_ROWS_PER_RANGE = size_t{100'000};
+
+// Directory that the binary files of the tables are cached in if BenchmarkConfig::cache_binary_tables is set. As
+// the generated data only depends on the scale factor and the chunk size, these are part of the path.
+std::filesystem::path binary_cache_directory(float scale_factor, ChunkOffset chunk_size) {
+  auto directory_name = std::stringstream{};
+  directory_name << "sf-" << scale_factor << "-chunk-" << chunk_size;
+  return std::filesystem::path("tpch_cached_tables") / directory_name.str();
+}
+
 std::shared_ptr<BenchmarkConfig> create_benchmark_config_with_chunk_size(uint32_t chunk_size) {
   auto config = BenchmarkConfig::get_default_config();
   config.chunk_size = chunk_size;
@@ -218,7 +414,36 @@ TpchTableGenerator::TpchTableGenerator(float scale_factor, const std::shared_ptr
     : AbstractTableGenerator(benchmark_config), _scale_factor(scale_factor) {}
 
 std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate() {
-  Assert(!_benchmark_config->cache_binary_tables, "Caching binary Tables not supported by TpchTableGenerator, yet");
+  const auto chunk_size = _benchmark_config->chunk_size;
+  const auto cache_directory = binary_cache_directory(_scale_factor, chunk_size);
+
+  /**
+   * If the tables were cached by a previous run, load them from their binary files instead of generating them.
+   * Caches that were written in an older version of the binary format are regenerated.
+   */
+  if (_benchmark_config->cache_binary_tables) {
+    const auto all_tables_cached =
+        std::all_of(tpch_table_names.cbegin(), tpch_table_names.cend(), [&](const auto& table_and_name) {
+          return ImportBinary::has_current_format(cache_directory / (table_and_name.second + ".bin"));
+        });
+
+    if (all_tables_cached) {
+      std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
+      for (const auto& [tpch_table, table_name] : tpch_table_names) {
+        Timer timer;
+        auto& table_info = table_info_by_name[table_name];
+        table_info.binary_file_path = cache_directory / (table_name + ".bin");
+
+        std::cout << "-  Loading table '" << table_name << "' from " << *table_info.binary_file_path << std::flush;
+        table_info.table = ImportBinary::read_binary(*table_info.binary_file_path);
+        table_info.loaded_from_binary = true;
+        std::cout << " (" << table_info.table->row_count() << " rows; " << timer.lap_formatted() << ")" << std::endl;
+      }
+      return table_info_by_name;
+    }
+
+    std::filesystem::create_directories(cache_directory);
+  }
 
   const auto customer_count = static_cast<size_t>(tdefs[CUST].base * _scale_factor);
   const auto order_count = static_cast<size_t>(tdefs[ORDER].base * _scale_factor);
@@ -227,102 +452,149 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   const auto nation_count = static_cast<size_t>(tdefs[NATION].base);
   const auto region_count = static_cast<size_t>(tdefs[REGION].base);
 
+  /**
+   * The rows of customer, orders (with their lineitems), part (with their partsupps), and supplier are generated in
+   * ranges of rows_per_range rows by JobTasks. Usually, a range is exactly one chunk of the final table.
+   */
+  const auto rows_per_range = std::min(size_t{chunk_size}, MAX_ROWS_PER_RANGE);
+  const auto range_count = [&](const size_t row_count) { return (row_count + rows_per_range - 1) / rows_per_range; };
+
+  const auto& encoding_config = _benchmark_config->encoding_config;
+
   // The `* 4` part is defined in the TPC-H specification.
-  TableBuilder customer_builder{_benchmark_config->chunk_size, customer_column_types, customer_column_names,
-                                UseMvcc::Yes, customer_count};
-  TableBuilder order_builder{_benchmark_config->chunk_size, order_column_types, order_column_names, UseMvcc::Yes,
-                             order_count};
-  TableBuilder lineitem_builder{_benchmark_config->chunk_size, lineitem_column_types, lineitem_column_names,
-                                UseMvcc::Yes, order_count * 4};
-  TableBuilder part_builder{_benchmark_config->chunk_size, part_column_types, part_column_names, UseMvcc::Yes,
-                            part_count};
-  TableBuilder partsupp_builder{_benchmark_config->chunk_size, partsupp_column_types, partsupp_column_names,
-                                UseMvcc::Yes, part_count * 4};
-  TableBuilder supplier_builder{_benchmark_config->chunk_size, supplier_column_types, supplier_column_names,
-                                UseMvcc::Yes, supplier_count};
-  TableBuilder nation_builder{_benchmark_config->chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes,
-                              nation_count};
-  TableBuilder region_builder{_benchmark_config->chunk_size, region_column_types, region_column_names, UseMvcc::Yes,
-                              region_count};
+  TableBuilder customer_builder{chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes,
+                                range_count(customer_count), rows_per_range, "customer", encoding_config};
+  TableBuilder order_builder{chunk_size, order_column_types, order_column_names, UseMvcc::Yes,
+                             range_count(order_count), rows_per_range, "orders", encoding_config};
+  TableBuilder lineitem_builder{chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::Yes,
+                                range_count(order_count), rows_per_range * 4, "lineitem", encoding_config};
+  TableBuilder part_builder{chunk_size, part_column_types, part_column_names, UseMvcc::Yes,
+                            range_count(part_count), rows_per_range, "part", encoding_config};
+  TableBuilder partsupp_builder{chunk_size, partsupp_column_types, partsupp_column_names, UseMvcc::Yes,
+                                range_count(part_count), rows_per_range * 4, "partsupp", encoding_config};
+  TableBuilder supplier_builder{chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes,
+                                range_count(supplier_count), rows_per_range, "supplier", encoding_config};
+  TableBuilder nation_builder{chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes, 1, nation_count,
+                              "nation", encoding_config};
+  TableBuilder region_builder{chunk_size, region_column_types, region_column_names, UseMvcc::Yes, 1, region_count,
+                              "region", encoding_config};
 
   dbgen_reset_seeds();
 
   /**
-   * CUSTOMER
+   * dbgen lazily initializes some of its global state (e.g., the text pool that comments are taken from and the
+   * date strings) when the first row of a table is generated. Do this here, before the ranges are generated
+   * concurrently. The random number streams are thread-local and reset by each range, so this does not change the
+   * generated data.
    */
-
-  for (size_t row_idx = 0; row_idx < customer_count; row_idx++) {
-    auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
-    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
-                                convert_money(customer.acctbal), customer.mktsegment, customer.comment);
-  }
+  call_dbgen_mk<customer_t>(1, mk_cust, TpchTable::Customer);
+  call_dbgen_mk<order_t>(1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+  call_dbgen_mk<part_t>(1, mk_part, TpchTable::Part, _scale_factor);
+  call_dbgen_mk<supplier_t>(1, mk_supp, TpchTable::Supplier);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  // Schedules a JobTask per range of [0, row_count). Each range starts with the initial random number streams and
+  // skips the rows before it, so that its rows are the same as if all rows were generated sequentially. Once its rows
+  // are generated, a range is finished, which encodes the chunks that are complete by then.
+  const auto schedule_ranges = [&](const size_t row_count, const auto& generate_range) {
+    for (auto range_begin = size_t{0}; range_begin < row_count; range_begin += rows_per_range) {
+      const auto range_idx = range_begin / rows_per_range;
+      const auto range_end = std::min(range_begin + rows_per_range, row_count);
+
+      jobs.emplace_back(std::make_shared<JobTask>([generate_range, range_idx, range_begin, range_end]() {
+        dbgen_reset_seeds();
+        generate_range(range_idx, range_begin, range_end);
+      }));
+      jobs.back()->schedule();
+    }
+  };
 
   /**
-   * ORDER and LINEITEM
+   * CUSTOMER
    */
 
-  for (size_t order_idx = 0; order_idx < order_count; ++order_idx) {
-    const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+  schedule_ranges(customer_count, [&](const size_t range_idx, const size_t range_begin, const size_t range_end) {
+    sd_cust(0, range_begin);
 
-    order_builder.append_row(order.okey, order.custkey, pmr_string(1, order.orderstatus),
-                             convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
-                             order.spriority, order.comment);
+    for (auto row_idx = range_begin; row_idx < range_end; ++row_idx) {
+      auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
+      customer_builder.append_row(range_idx, customer.custkey, customer.name, customer.address, customer.nation_code,
+                                  customer.phone, convert_money(customer.acctbal), customer.mktsegment,
+                                  customer.comment);
+    }
 
-    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
-      const auto& lineitem = order.l[line_idx];
+    customer_builder.finish_range(range_idx);
+  });
 
-      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
-                                  convert_money(lineitem.eprice), convert_money(lineitem.discount),
-                                  convert_money(lineitem.tax), pmr_string(1, lineitem.rflag[0]),
-                                  pmr_string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
-                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
-    }
-  }
+  /**
+   * ORDER and LINEITEM
+   */
+
+  schedule_ranges(order_count, [&](const size_t range_idx, const size_t range_begin, const size_t range_end) {
+    generate_orders(range_idx, range_begin, range_end, _scale_factor, order_builder, lineitem_builder);
+  });
 
   /**
    * PART and PARTSUPP
    */
 
-  for (size_t part_idx = 0; part_idx < part_count; ++part_idx) {
-    const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
+  schedule_ranges(part_count, [&](const size_t range_idx, const size_t range_begin, const size_t range_end) {
+    sd_part(0, range_begin);
+    sd_psupp(0, range_begin);
 
-    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
-                            convert_money(part.retailprice), part.comment);
+    for (auto part_idx = range_begin; part_idx < range_end; ++part_idx) {
+      const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
 
-    for (const auto& partsupp : part.s) {
-      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
-                                  partsupp.comment);
+      part_builder.append_row(range_idx, part.partkey, part.name, part.mfgr, part.brand, part.type, part.size,
+                              part.container, convert_money(part.retailprice), part.comment);
+
+      for (const auto& partsupp : part.s) {
+        partsupp_builder.append_row(range_idx, partsupp.partkey, partsupp.suppkey, partsupp.qty,
+                                    convert_money(partsupp.scost), partsupp.comment);
+      }
     }
-  }
+
+    part_builder.finish_range(range_idx);
+    partsupp_builder.finish_range(range_idx);
+  });
 
   /**
    * SUPPLIER
    */
 
-  for (size_t supplier_idx = 0; supplier_idx < supplier_count; ++supplier_idx) {
-    const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
+  schedule_ranges(supplier_count, [&](const size_t range_idx, const size_t range_begin, const size_t range_end) {
+    sd_supp(0, range_begin);
 
-    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
-                                convert_money(supplier.acctbal), supplier.comment);
-  }
+    for (auto supplier_idx = range_begin; supplier_idx < range_end; ++supplier_idx) {
+      const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
+
+      supplier_builder.append_row(range_idx, supplier.suppkey, supplier.name, supplier.address, supplier.nation_code,
+                                  supplier.phone, convert_money(supplier.acctbal), supplier.comment);
+    }
+
+    supplier_builder.finish_range(range_idx);
+  });
 
   /**
-   * NATION
+   * NATION and REGION are tiny and generated sequentially
    */
 
+  dbgen_reset_seeds();
+
   for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
     const auto nation = call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TpchTable::Nation);
-    nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
+    nation_builder.append_row(0, nation.code, nation.text, nation.join, nation.comment);
   }
-
-  /**
-   * REGION
-   */
+  nation_builder.finish_range(0);
 
   for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
     const auto region = call_dbgen_mk<code_t>(region_idx + 1, mk_region, TpchTable::Region);
-    region_builder.append_row(region.code, region.text, region.comment);
+    region_builder.append_row(0, region.code, region.text, region.comment);
   }
+  region_builder.finish_range(0);
+
+  CurrentScheduler::wait_for_tasks(jobs);
 
   /**
    * Clean up dbgen every time we finish table generation to avoid memory leaks in dbgen
@@ -330,7 +602,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   dbgen_cleanup();
 
   /**
-   * Return
+   * All chunks were encoded by the ranges, collect them into the tables
    */
   std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
 
@@ -343,7 +615,32 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   table_info_by_name["nation"].table = nation_builder.finish_table();
   table_info_by_name["region"].table = region_builder.finish_table();
 
+  // AbstractTableGenerator::generate_and_store() writes the tables to these files
+  if (_benchmark_config->cache_binary_tables) {
+    for (auto& [table_name, table_info] : table_info_by_name) {
+      table_info.binary_file_path = cache_directory / (table_name + ".bin");
+    }
+  }
+
   return table_info_by_name;
 }
 
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> TpchTableGenerator::generate_refresh_orders(
+    const size_t order_count) {
+  const auto first_order_idx = static_cast<size_t>(tdefs[ORDER].base * _scale_factor);
+  const auto chunk_size = _benchmark_config->chunk_size;
+
+  const auto encoding_config = EncodingConfig::unencoded();
+  TableBuilder order_builder{chunk_size, order_column_types, order_column_names, UseMvcc::No, 1, order_count,
+                             "orders", encoding_config};
+  TableBuilder lineitem_builder{chunk_size, lineitem_column_types, lineitem_column_names, UseMvcc::No, 1,
+                                order_count * 4, "lineitem", encoding_config};
+
+  dbgen_reset_seeds();
+  generate_orders(0, first_order_idx, first_order_idx + order_count, _scale_factor, order_builder, lineitem_builder);
+  dbgen_cleanup();
+
+  return {order_builder.finish_table(), lineitem_builder.finish_table()};
+}
+
 }  // namespace opossum
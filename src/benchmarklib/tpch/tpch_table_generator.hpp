@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "abstract_table_generator.hpp"
@@ -25,7 +26,13 @@ extern std::unordered_map<opossum::TpchTable, std::string> tpch_table_names;
  * Wrapper around the official tpch-dbgen tool, making it directly generate opossum::Table instances without having
  * to generate and then load .tbl files.
  *
- * NOT thread safe because the underlying tpch-dbgen is not (since it has global data and malloc races).
+ * The tables are generated in ranges of rows by JobTasks. Each range skips to its first row using dbgen's seed
+ * skipping, so the data is the same as if it was generated sequentially. The finished chunks are encoded right away as
+ * requested by the BenchmarkConfig's EncodingConfig. If the BenchmarkConfig has cache_binary_tables set, the tables
+ * are written to binary files and loaded from them by subsequent runs.
+ *
+ * Multiple TpchTableGenerators must NOT be used concurrently because the underlying tpch-dbgen has global data that
+ * is shared by all ranges.
  */
 class TpchTableGenerator final : public AbstractTableGenerator {
  public:
@@ -37,6 +44,11 @@ class TpchTableGenerator final : public AbstractTableGenerator {
 
   std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
 
+  // Generates @param order_count orders and their lineitems that follow the last order of the orders table, i.e.,
+  // their keys are larger than those of all generated orders. They are inserted by the TPC-H refresh function RF1
+  // (see TpchRefreshFunctions). Returns the orders and the lineitems. Must not be called concurrently with generate().
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> generate_refresh_orders(const size_t order_count);
+
  private:
   float _scale_factor;
 };
@@ -61,6 +61,17 @@ class AbstractCacheImpl {
   // Resize to the given capacity.
   virtual void resize(size_t capacity) = 0;
 
+  // Returns true if get() may be called concurrently with other calls to get() (but not with any other method).
+  virtual bool allows_concurrent_get() const { return false; }
+
+  // Returns true if the cache is bounded by the summed size of its entries. In that case, the size passed to set() is
+  // the memory usage of the entry in bytes. Other implementations may use the size as a weight (e.g., GDS) and are
+  // only passed a constant size.
+  virtual bool is_bounded_by_memory() const { return false; }
+
+  // Limits the summed size of the entries. Ignored by implementations that are not bounded by memory.
+  virtual void set_memory_budget(double memory_budget) {}
+
   virtual ErasedIterator begin() = 0;
   virtual ErasedIterator end() = 0;
 
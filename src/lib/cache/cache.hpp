@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -7,7 +9,9 @@
 #include <utility>
 #include <vector>
 
-#include "gdfs_cache.hpp"
+#include <shared_mutex>  // NOLINT
+
+#include "sampled_lfu_cache.hpp"
 
 #include "utils/singleton.hpp"
 
@@ -15,74 +19,180 @@ namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
-// Per-default, uses the GDFS cache as underlying storage.
+// Upper bound for the summed size of the entries, applies only to implementations that are bounded by memory
+inline constexpr size_t DefaultCacheMemoryBudget = 256 * 1024 * 1024;
+
+// To avoid one mutex being taken by every access, the cache is split into shards that each have their own lock and
+// their own instance of the eviction strategy. The shard of an entry is determined by the hash of its key. Lookups in
+// implementations that allow concurrent calls to get() (e.g., SampledLFUCache) only take a shared lock.
+// Small caches are not split, so that they evict exactly as their underlying implementation does.
+inline constexpr size_t MinCacheShardCapacity = 64;
+inline constexpr size_t MaxCacheShardCount = 16;
+
+// Per-default, uses the SampledLFU cache as underlying storage.
 template <typename Value, typename Key = std::string>
 class Cache : public Singleton<Cache<Value, Key>> {
  public:
+  using KeyValuePair = typename AbstractCacheImpl<Key, Value>::KeyValuePair;
   using Iterator = typename AbstractCacheImpl<Key, Value>::ErasedIterator;
 
-  explicit Cache(size_t capacity = DefaultCacheCapacity)
-      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+  explicit Cache(size_t capacity = DefaultCacheCapacity) {
+    replace_cache_impl<SampledLFUCache<Key, Value>>(capacity);
+    set_memory_budget(DefaultCacheMemoryBudget);
+  }
 
   virtual ~Cache() {}
 
-  // Adds or refreshes the cache entry [query, value].
-  void set(const Key& query, const Value& value) {
-    if (_impl->capacity() == 0) return;
+  // Adds or refreshes the cache entry [query, value]. If the underlying implementation is bounded by memory, size is
+  // the memory usage of the entry in bytes.
+  void set(const Key& query, const Value& value, double size = 1.0) {
+    auto& shard = _shard(query);
+    if (shard.impl->capacity() == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    _impl->set(query, value);
+    std::lock_guard<std::shared_mutex> lock(shard.mutex);
+    shard.impl->set(query, value, 1.0, shard.impl->is_bounded_by_memory() ? size : 1.0);
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
   std::optional<Value> try_get(const Key& query) {
-    if (_impl->capacity() == 0) return {};
+    auto& shard = _shard(query);
+    if (shard.impl->capacity() == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
+    if (shard.impl->allows_concurrent_get()) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      if (!shard.impl->has(query)) return {};
+      return shard.impl->get(query);
+    }
+
+    std::lock_guard<std::shared_mutex> lock(shard.mutex);
+    if (!shard.impl->has(query)) {
       return {};
     }
-    return _impl->get(query);
+    return shard.impl->get(query);
   }
 
   // Checks whether an entry for the query exists.
-  bool has(const Key& query) const { return _impl->has(query); }
+  bool has(const Key& query) const {
+    const auto& shard = _shard(query);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.impl->has(query);
+  }
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _impl->get(query);
+    auto& shard = _shard(query);
+    if (shard.impl->allows_concurrent_get()) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      return shard.impl->get(query);
+    }
+
+    std::lock_guard<std::shared_mutex> lock(shard.mutex);
+    return shard.impl->get(query);
   }
 
   // Purges all entries from the cache.
-  void clear() { _impl->clear(); }
+  void clear() {
+    for (auto& shard : _shards) {
+      std::lock_guard<std::shared_mutex> lock(shard.mutex);
+      shard.impl->clear();
+    }
+  }
 
-  void resize(size_t capacity) { _impl->resize(capacity); }
+  // Resizes the shards. Their number is kept.
+  void resize(size_t capacity) {
+    for (auto& shard : _shards) {
+      std::lock_guard<std::shared_mutex> lock(shard.mutex);
+      shard.impl->resize(_shard_capacity(capacity));
+    }
+  }
 
-  size_t size() const { return _impl->size(); }
+  // Limits the summed size of the entries, which is split evenly between the shards. Ignored by implementations that
+  // are not bounded by memory.
+  void set_memory_budget(size_t memory_budget) {
+    for (auto& shard : _shards) {
+      std::lock_guard<std::shared_mutex> lock(shard.mutex);
+      shard.impl->set_memory_budget(static_cast<double>(memory_budget) / static_cast<double>(_shards.size()));
+    }
+  }
 
-  // Returns a reference to the underlying cache.
-  AbstractCacheImpl<Key, Value>& cache() { return *_impl; }
-  const AbstractCacheImpl<Key, Value>& cache() const { return *_impl; }
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.impl->size();
+    }
+    return size;
+  }
+
+  size_t shard_count() const { return _shards.size(); }
 
-  // Replaces the underlying cache by creating a new object
-  // of the given cache type.
+  // Replaces the underlying cache by creating new objects of the given cache type. Unless given, the number of shards
+  // is derived from the capacity. Not thread-safe.
   template <class cache_t>
-  void replace_cache_impl(size_t capacity) {
-    _impl = std::make_unique<cache_t>(capacity);
+  void replace_cache_impl(size_t capacity, std::optional<size_t> shard_count = std::nullopt) {
+    if (!shard_count) shard_count = std::clamp(capacity / MinCacheShardCapacity, size_t{1}, MaxCacheShardCount);
+    _shards = std::vector<Shard>(std::max(*shard_count, size_t{1}));
+    for (auto& shard : _shards) {
+      shard.impl = std::make_unique<cache_t>(_shard_capacity(capacity));
+    }
   }
 
-  Iterator begin() { return _impl->begin(); }
+  // Iterates over the entries of all shards. Not thread-safe.
+  Iterator begin() { return Iterator{std::make_unique<ShardIterator>(_shards, 0)}; }
 
-  Iterator end() { return _impl->end(); }
+  Iterator end() { return Iterator{std::make_unique<ShardIterator>(_shards, _shards.size())}; }
 
  protected:
-  // Underlying cache eviction strategy.
-  std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
+  struct Shard {
+    mutable std::shared_mutex mutex;
+
+    // Underlying cache eviction strategy.
+    std::unique_ptr<AbstractCacheImpl<Key, Value>> impl;
+  };
+
+  class ShardIterator : public AbstractCacheImpl<Key, Value>::AbstractIterator {
+   public:
+    ShardIterator(std::vector<Shard>& shards, size_t shard_idx) : _shards(shards), _shard_idx(shard_idx) {
+      _skip_empty_shards();
+    }
+
+    void increment() {
+      ++*_iterator;
+      _skip_empty_shards();
+    }
+
+    bool equal(const typename AbstractCacheImpl<Key, Value>::AbstractIterator& other) const {
+      const auto& other_iterator = static_cast<const ShardIterator&>(other);
+      if (_shard_idx != other_iterator._shard_idx) return false;
+      return _shard_idx == _shards.size() || *_iterator == *other_iterator._iterator;
+    }
+
+    const KeyValuePair& dereference() const { return **_iterator; }
+
+   private:
+    // Moves on to the next shard until the iterator points to an entry or the last shard was passed
+    void _skip_empty_shards() {
+      while (_shard_idx < _shards.size()) {
+        if (!_iterator) _iterator.emplace(_shards[_shard_idx].impl->begin());
+        if (*_iterator != _shards[_shard_idx].impl->end()) return;
+        _iterator.reset();
+        ++_shard_idx;
+      }
+    }
+
+    std::vector<Shard>& _shards;
+    size_t _shard_idx;
+    std::optional<Iterator> _iterator;
+  };
+
+  size_t _shard_capacity(size_t capacity) const { return (capacity + _shards.size() - 1) / _shards.size(); }
+
+  Shard& _shard(const Key& query) { return _shards[std::hash<Key>{}(query) % _shards.size()]; }
+  const Shard& _shard(const Key& query) const { return _shards[std::hash<Key>{}(query) % _shards.size()]; }
 
-  std::mutex _mutex;
+  std::vector<Shard> _shards;
 };
 
 }  // namespace opossum
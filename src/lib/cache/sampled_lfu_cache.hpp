@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+
+namespace opossum {
+
+// Generic cache implementation using a sampled least-frequently-used policy. Instead of keeping the entries ordered
+// (as, e.g., the heap of GDFS does), a few randomly sampled entries are compared on eviction. Thus, get() only
+// increments an atomic counter and may be called concurrently. The frequencies are halved whenever as many entries
+// were inserted as the cache can hold, so that formerly popular entries age out.
+// Besides the number of entries, the cache is bounded by a memory budget. The size passed to set() is the memory
+// usage of the entry in bytes.
+// Note: Apart from concurrent calls to get(), this implementation is not thread-safe.
+template <typename Key, typename Value>
+class SampledLFUCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  // Number of entries that are compared to find the entry to evict
+  static constexpr auto SAMPLE_SIZE = size_t{5};
+
+  struct SampledLFUCacheEntry {
+    SampledLFUCacheEntry(const Key& key, const Value& value, const double init_size)
+        : key_value(key, value), size(init_size), frequency(1) {}
+
+    SampledLFUCacheEntry(SampledLFUCacheEntry&& other) noexcept
+        : key_value(std::move(other.key_value)),
+          size(other.size),
+          frequency(other.frequency.load(std::memory_order_relaxed)) {}
+
+    SampledLFUCacheEntry& operator=(SampledLFUCacheEntry&& other) noexcept {
+      key_value = std::move(other.key_value);
+      size = other.size;
+      frequency.store(other.frequency.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      return *this;
+    }
+
+    KeyValuePair key_value;
+    double size;
+    std::atomic<uint32_t> frequency;
+  };
+
+  class Iterator : public AbstractIterator {
+   public:
+    using IteratorType = typename std::vector<SampledLFUCacheEntry>::iterator;
+    explicit Iterator(IteratorType p) : _wrapped_iterator(p) {}
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    IteratorType _wrapped_iterator;
+
+    void increment() { ++_wrapped_iterator; }
+
+    bool equal(const AbstractIterator& other) const {
+      return _wrapped_iterator == static_cast<const Iterator&>(other)._wrapped_iterator;
+    }
+
+    const KeyValuePair& dereference() const { return _wrapped_iterator->key_value; }
+  };
+
+  explicit SampledLFUCache(size_t capacity, double memory_budget = std::numeric_limits<double>::infinity())
+      : AbstractCacheImpl<Key, Value>(capacity), _memory_budget(memory_budget) {}
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto it = _map.find(key);
+    if (it != _map.end()) {
+      auto& entry = _entries[it->second];
+      _memory_usage += size - entry.size;
+      entry.key_value.second = value;
+      entry.size = size;
+      entry.frequency.fetch_add(1, std::memory_order_relaxed);
+      _evict_to_fit(it->second);
+      return;
+    }
+
+    // Entries that exceed the whole budget are not cached
+    if (this->_capacity == 0 || size > _memory_budget) return;
+
+    _entries.emplace_back(key, value, size);
+    _map.emplace(key, _entries.size() - 1);
+    _memory_usage += size;
+    _evict_to_fit(_entries.size() - 1);
+
+    if (++_insertions_since_aging >= this->_capacity) _age();
+  }
+
+  // Safe to be called concurrently with other calls to get().
+  Value& get(const Key& key) {
+    auto& entry = _entries[_map.find(key)->second];
+    if (entry.frequency.load(std::memory_order_relaxed) < std::numeric_limits<uint32_t>::max()) {
+      entry.frequency.fetch_add(1, std::memory_order_relaxed);
+    }
+    return entry.key_value.second;
+  }
+
+  bool has(const Key& key) const { return _map.find(key) != _map.end(); }
+
+  bool allows_concurrent_get() const { return true; }
+
+  bool is_bounded_by_memory() const { return true; }
+
+  size_t size() const { return _map.size(); }
+
+  void clear() {
+    _entries.clear();
+    _map.clear();
+    _memory_usage = 0.0;
+    _insertions_since_aging = 0;
+  }
+
+  void resize(size_t capacity) {
+    this->_capacity = capacity;
+    _evict_to_fit(INVALID_ENTRY_IDX);
+  }
+
+  void set_memory_budget(double memory_budget) {
+    _memory_budget = memory_budget;
+    _evict_to_fit(INVALID_ENTRY_IDX);
+  }
+
+  double memory_budget() const { return _memory_budget; }
+
+  // Summed size of all entries
+  double memory_usage() const { return _memory_usage; }
+
+  uint32_t frequency(const Key& key) const {
+    return _entries[_map.find(key)->second].frequency.load(std::memory_order_relaxed);
+  }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_entries.begin())}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_entries.end())}; }
+
+ protected:
+  static constexpr auto INVALID_ENTRY_IDX = std::numeric_limits<size_t>::max();
+
+  // Entries in insertion order, apart from the gaps filled by eviction
+  std::vector<SampledLFUCacheEntry> _entries;
+
+  // Map to point towards the position of an entry in _entries.
+  std::unordered_map<Key, size_t> _map;
+
+  double _memory_budget;
+  double _memory_usage{0.0};
+  size_t _insertions_since_aging{0};
+
+  std::mt19937 _generator;
+
+  // Evicts entries until both the capacity and the memory budget are met. The entry at protected_entry_idx (the one
+  // that was just set) is only evicted if it is the last one left.
+  void _evict_to_fit(size_t protected_entry_idx) {
+    while (!_entries.empty() && (_entries.size() > this->_capacity || _memory_usage > _memory_budget)) {
+      protected_entry_idx = _evict_entry(_sample_victim(protected_entry_idx), protected_entry_idx);
+    }
+  }
+
+  void _evict() { _evict_entry(_sample_victim(INVALID_ENTRY_IDX), INVALID_ENTRY_IDX); }
+
+  // Picks the least frequently used of SAMPLE_SIZE random entries, preferring larger entries on ties. If the cache
+  // holds no more than SAMPLE_SIZE entries, all of them are compared.
+  size_t _sample_victim(size_t protected_entry_idx) {
+    if (_entries.size() == 1) return 0;
+
+    auto victim_idx = INVALID_ENTRY_IDX;
+    const auto compare = [&](const size_t entry_idx) {
+      if (entry_idx == protected_entry_idx) return;
+      if (victim_idx == INVALID_ENTRY_IDX || _is_better_victim(_entries[entry_idx], _entries[victim_idx])) {
+        victim_idx = entry_idx;
+      }
+    };
+
+    if (_entries.size() <= SAMPLE_SIZE) {
+      for (auto entry_idx = size_t{0}; entry_idx < _entries.size(); ++entry_idx) compare(entry_idx);
+      return victim_idx;
+    }
+
+    auto distribution = std::uniform_int_distribution<size_t>{0, _entries.size() - 1};
+    for (auto sample_idx = size_t{0}; sample_idx < SAMPLE_SIZE; ++sample_idx) {
+      compare(distribution(_generator));
+    }
+
+    // All samples hit the protected entry
+    if (victim_idx == INVALID_ENTRY_IDX) victim_idx = protected_entry_idx == 0 ? 1 : 0;
+    return victim_idx;
+  }
+
+  static bool _is_better_victim(const SampledLFUCacheEntry& entry, const SampledLFUCacheEntry& victim) {
+    const auto frequency = entry.frequency.load(std::memory_order_relaxed);
+    const auto victim_frequency = victim.frequency.load(std::memory_order_relaxed);
+    return frequency < victim_frequency || (frequency == victim_frequency && entry.size > victim.size);
+  }
+
+  // Removes the entry by moving the last entry into its place. Returns the new position of the protected entry.
+  size_t _evict_entry(size_t entry_idx, size_t protected_entry_idx) {
+    const auto last_entry_idx = _entries.size() - 1;
+
+    _memory_usage -= _entries[entry_idx].size;
+    _map.erase(_entries[entry_idx].key_value.first);
+
+    if (entry_idx != last_entry_idx) {
+      _entries[entry_idx] = std::move(_entries[last_entry_idx]);
+      _map[_entries[entry_idx].key_value.first] = entry_idx;
+    }
+    _entries.pop_back();
+
+    if (protected_entry_idx == entry_idx) return INVALID_ENTRY_IDX;
+    if (protected_entry_idx == last_entry_idx) return entry_idx;
+    return protected_entry_idx;
+  }
+
+  void _age() {
+    for (auto& entry : _entries) {
+      entry.frequency.store(std::max(entry.frequency.load(std::memory_order_relaxed) / 2, uint32_t{1}),
+                            std::memory_order_relaxed);
+    }
+    _insertions_since_aging = 0;
+  }
+};
+
+}  // namespace opossum
@@ -30,6 +30,8 @@
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_gather.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -133,11 +135,13 @@ namespace opossum {
 
 ExpressionEvaluator::ExpressionEvaluator(
     const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results)
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions)
     : _table(table),
       _chunk(_table->get_chunk(chunk_id)),
       _chunk_id(chunk_id),
-      _uncorrelated_subquery_results(uncorrelated_subquery_results) {
+      _uncorrelated_subquery_results(uncorrelated_subquery_results),
+      _common_subexpressions(common_subexpressions) {
   _output_row_count = _chunk->size();
   _segment_materializations.resize(_chunk->column_count());
 }
@@ -145,6 +149,30 @@ ExpressionEvaluator::ExpressionEvaluator(
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  if (_common_subexpressions && !_common_subexpressions->empty()) {
+    const auto shared_expression = std::const_pointer_cast<AbstractExpression>(expression.shared_from_this());
+    if (_common_subexpressions->count(shared_expression)) {
+      auto& cached_result = _common_subexpression_results[shared_expression];
+      if (!cached_result) {
+        const auto result = _evaluate_expression_to_result_without_cache<Result>(expression);
+        cached_result = result;
+        return result;
+      }
+
+      // The same expression might be requested with a different result type, e.g., as a branch of a CASE. That
+      // result is not cached.
+      if (const auto typed_result = std::dynamic_pointer_cast<ExpressionResult<Result>>(cached_result)) {
+        return typed_result;
+      }
+    }
+  }
+
+  return _evaluate_expression_to_result_without_cache<Result>(expression);
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result_without_cache(
+    const AbstractExpression& expression) {
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       return _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
@@ -353,7 +381,7 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
   const auto& right_expression = *in_expression.set();
 
   std::vector<ExpressionEvaluator::Bool> result_values;
-  std::vector<bool> result_nulls;
+  ExpressionResultNulls result_nulls;
 
   if (right_expression.type == ExpressionType::List) {
     const auto& list_expression = static_cast<const ListExpression&>(right_expression);
@@ -367,7 +395,7 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
     if (left_expression.data_type() == DataType::Null) {
       // `NULL [NOT] IN ...` is NULL
       return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(std::vector<ExpressionEvaluator::Bool>{0},
-                                                                           std::vector<bool>{true});
+                                                                           ExpressionResultNulls{true});
     }
 
     /**
@@ -386,12 +414,9 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
           type_compatible_elements.emplace_back(element);
         }
 
-        if (element->type != ExpressionType::Value) {
-          all_elements_are_values_of_left_type = false;
-        } else {
-          const auto& value_expression = std::static_pointer_cast<ValueExpression>(element);
-          if (value_expression->value.type() != typeid(LeftDataType)) all_elements_are_values_of_left_type = false;
-        }
+        // Parameters are treated like values, e.g., for literals parameterized by the SQLPipelineStatement
+        const auto value = expression_get_value_or_parameter(*element);
+        if (!value || value->type() != typeid(LeftDataType)) all_elements_are_values_of_left_type = false;
       }
     });
 
@@ -418,8 +443,7 @@ ExpressionEvaluator::_evaluate_in_expression<ExpressionEvaluator::Bool>(const In
           std::vector<LeftDataType> right_values;
           right_values.reserve(type_compatible_elements.size());
           for (const auto& expression : type_compatible_elements) {
-            const auto& value_expression = std::static_pointer_cast<ValueExpression>(expression);
-            right_values.emplace_back(boost::get<LeftDataType>(value_expression->value));
+            right_values.emplace_back(boost::get<LeftDataType>(*expression_get_value_or_parameter(*expression)));
           }
           std::sort(right_values.begin(), right_values.end());
 
@@ -592,7 +616,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
   const auto when = evaluate_expression_to_result<ExpressionEvaluator::Bool>(*case_expression.when());
 
   std::vector<Result> values;
-  std::vector<bool> nulls;
+  ExpressionResultNulls nulls;
 
   _resolve_to_expression_results(
       *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
@@ -633,7 +657,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
    */
 
   auto values = std::vector<Result>{};
-  auto nulls = std::vector<bool>{};
+  auto nulls = ExpressionResultNulls{};
 
   _resolve_to_expression_result(*cast_expression.argument(), [&](const auto& argument_result) {
     using ArgumentDataType = typename std::decay_t<decltype(argument_result)>::Type;
@@ -726,7 +750,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_value_o
     // NullValue can be evaluated to any type - it is then a null value of that type.
     // This makes it easier to implement expressions where a certain data type is expected, but a Null literal is
     // given. Think `CASE NULL THEN ... ELSE ...` - the NULL will be evaluated to be a bool.
-    std::vector<bool> nulls{};
+    ExpressionResultNulls nulls{};
     nulls.emplace_back(true);
     return std::make_shared<ExpressionResult<Result>>(std::vector<Result>{{Result{}}}, nulls);
   } else {
@@ -806,7 +830,7 @@ template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_unary_minus_expression(
     const UnaryMinusExpression& unary_minus_expression) {
   std::vector<Result> values;
-  std::vector<bool> nulls;
+  ExpressionResultNulls nulls;
 
   _resolve_to_expression_result(*unary_minus_expression.argument(), [&](const auto& argument_result) {
     using ArgumentType = typename std::decay_t<decltype(argument_result)>::Type;
@@ -838,7 +862,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_subquer
   const auto subquery_results = _prune_tables_to_expression_results<Result>(subquery_result_tables);
 
   std::vector<Result> result_values(subquery_results.size());
-  std::vector<bool> result_nulls;
+  ExpressionResultNulls result_nulls;
 
   // Materialize values
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < subquery_results.size(); ++chunk_offset) {
@@ -912,6 +936,32 @@ ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(
   return uncorrelated_subquery_results;
 }
 
+std::shared_ptr<ExpressionUnorderedSet> ExpressionEvaluator::find_common_subexpressions(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto visited_expressions = ExpressionUnorderedSet{};
+  auto common_subexpressions = std::make_shared<ExpressionUnorderedSet>();
+
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      // Evaluating these is cheaper than looking up their results
+      if (sub_expression->type == ExpressionType::PQPColumn || sub_expression->type == ExpressionType::Value ||
+          sub_expression->type == ExpressionType::CorrelatedParameter) {
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      if (!visited_expressions.emplace(sub_expression).second) {
+        // The arguments of a common subexpression are evaluated only once as well, so they are not counted again
+        common_subexpressions->emplace(sub_expression);
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  return common_subexpressions;
+}
+
 std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_for_row(
     const PQPSubqueryExpression& expression, const ChunkOffset chunk_offset) {
   Assert(expression.parameters.empty() || _chunk,
@@ -1163,29 +1213,43 @@ template <typename Result, typename Functor>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_with_default_null_logic(
     const AbstractExpression& left_expression, const AbstractExpression& right_expression) {
   std::vector<Result> values;
-  std::vector<bool> nulls;
+  ExpressionResultNulls nulls;
+
+  _resolve_to_expression_result_ptrs(left_expression, right_expression, [&](const auto& left_result,
+                                                                            const auto& right_result) {
+    const auto& left = *left_result;
+    const auto& right = *right_result;
 
-  _resolve_to_expression_results(left_expression, right_expression, [&](const auto& left, const auto& right) {
     using LeftDataType = typename std::decay_t<decltype(left)>::Type;
     using RightDataType = typename std::decay_t<decltype(right)>::Type;
 
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_size = _result_size(left.size(), right.size());
-      values.resize(result_size);
       nulls = _evaluate_default_null_logic(left.nulls, right.nulls);
 
+      // The values of an operand might be moved into `values` below. The moved buffer stays the same, so we access the
+      // operands through pointers to their data. If the buffer is reused, each row is read before it is written.
+      const auto* left_values = left.values.data();
+      const auto* right_values = right.values.data();
+      const auto left_is_literal = left.is_literal();
+      const auto right_is_literal = right.is_literal();
+
+      if (!_reuse_values(values, left_result, result_size) && !_reuse_values(values, right_result, result_size)) {
+        values.resize(result_size);
+      }
+
       // Using three different branches instead of views, which would generate 9 cases.
-      if (left.is_literal() == right.is_literal()) {
+      if (left_is_literal == right_is_literal) {
         for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values[row_idx], right.values[row_idx]);
+          Functor{}(values[row_idx], left_values[row_idx], right_values[row_idx]);
         }
-      } else if (right.is_literal()) {
+      } else if (right_is_literal) {
         for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values[row_idx], right.values.front());
+          Functor{}(values[row_idx], left_values[row_idx], right_values[0]);
         }
       } else {
         for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values.front(), right.values[row_idx]);
+          Functor{}(values[row_idx], left_values[0], right_values[row_idx]);
         }
       }
     } else {
@@ -1208,7 +1272,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_row_count = _result_size(left.size(), right.size());
 
-      std::vector<bool> nulls(result_row_count);
+      ExpressionResultNulls nulls(result_row_count);
       std::vector<Result> values(result_row_count);
 
       for (auto row_idx = ChunkOffset{0}; row_idx < result_row_count; ++row_idx) {
@@ -1257,11 +1321,27 @@ void ExpressionEvaluator::_resolve_to_expression_results(const AbstractExpressio
 
 template <typename Functor>
 void ExpressionEvaluator::_resolve_to_expression_result(const AbstractExpression& expression, const Functor& fn) {
+  _resolve_to_expression_result_ptr(expression, [&](const auto& result) { fn(*result); });
+}
+
+template <typename Functor>
+void ExpressionEvaluator::_resolve_to_expression_result_ptrs(const AbstractExpression& left_expression,
+                                                             const AbstractExpression& right_expression,
+                                                             const Functor& fn) {
+  _resolve_to_expression_result_ptr(left_expression, [&](const auto& left_result) {
+    _resolve_to_expression_result_ptr(right_expression,
+                                      [&](const auto& right_result) { fn(left_result, right_result); });
+  });
+}
+
+template <typename Functor>
+void ExpressionEvaluator::_resolve_to_expression_result_ptr(const AbstractExpression& expression, const Functor& fn) {
   Assert(expression.type != ExpressionType::List, "Can't resolve ListExpression to ExpressionResult");
 
   if (expression.data_type() == DataType::Null) {
     // resolve_data_type() doesn't support Null, so we have handle it explicitly
-    ExpressionResult<NullValue> null_value_result{{NullValue{}}, {true}};
+    const auto null_value_result =
+        std::make_shared<ExpressionResult<NullValue>>(std::vector<NullValue>{NullValue{}}, ExpressionResultNulls{true});
 
     fn(null_value_result);
 
@@ -1270,11 +1350,27 @@ void ExpressionEvaluator::_resolve_to_expression_result(const AbstractExpression
       using ExpressionDataType = typename decltype(data_type_t)::type;
 
       const auto expression_result = evaluate_expression_to_result<ExpressionDataType>(expression);
-      fn(*expression_result);
+      fn(expression_result);
     });
   }
 }
 
+template <typename Result, typename OperandDataType>
+bool ExpressionEvaluator::_reuse_values(std::vector<Result>& values,
+                                        const std::shared_ptr<ExpressionResult<OperandDataType>>& operand,
+                                        const size_t size) {
+  if constexpr (std::is_same_v<Result, OperandDataType>) {
+    // Results that are still referenced elsewhere (e.g., materialized segments or cached common subexpressions) must
+    // not be modified
+    if (operand.use_count() != 1 || operand->values.size() != size || !values.empty()) return false;
+
+    values = std::move(operand->values);
+    return true;
+  } else {
+    return false;
+  }
+}
+
 template <typename... RowCounts>
 ChunkOffset ExpressionEvaluator::_result_size(const RowCounts... row_counts) {
   // If any operand is empty (that's the case IFF it is an empty segment) the result of the expression has no rows
@@ -1293,18 +1389,19 @@ ChunkOffset ExpressionEvaluator::_result_size(const RowCounts... row_counts) {
   return static_cast<ChunkOffset>(std::max({row_counts...}));
 }
 
-std::vector<bool> ExpressionEvaluator::_evaluate_default_null_logic(const std::vector<bool>& left,
-                                                                    const std::vector<bool>& right) const {
+ExpressionResultNulls ExpressionEvaluator::_evaluate_default_null_logic(const ExpressionResultNulls& left,
+                                                                        const ExpressionResultNulls& right) const {
   if (left.size() == right.size()) {
-    std::vector<bool> nulls(left.size());
-    std::transform(left.begin(), left.end(), right.begin(), nulls.begin(), [](auto l, auto r) { return l || r; });
+    ExpressionResultNulls nulls(left.size());
+    // Null flags are either 0 or 1, so the branch-free `|` can be used instead of `||`
+    std::transform(left.begin(), left.end(), right.begin(), nulls.begin(), [](auto l, auto r) { return l | r; });
     return nulls;
   } else if (left.size() > right.size()) {
     DebugAssert(right.size() <= 1,
                 "Operand should have either the same row count as the other, 1 row (to represent a literal), or no "
                 "rows (to represent a non-nullable operand)");
     if (!right.empty() && right.front()) {
-      return std::vector<bool>({true});
+      return ExpressionResultNulls({true});
     } else {
       return left;
     }
@@ -1313,7 +1410,7 @@ std::vector<bool> ExpressionEvaluator::_evaluate_default_null_logic(const std::v
                 "Operand should have either the same row count as the other, 1 row (to represent a literal), or no "
                 "rows (to represent a non-nullable operand)");
     if (!left.empty() && left.front()) {
-      return std::vector<bool>({true});
+      return ExpressionResultNulls({true});
     } else {
       return right;
     }
@@ -1334,8 +1431,32 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
 
     auto chunk_offset = ChunkOffset{0};
 
+    // Positions that are scattered across the referenced chunks (e.g., in the output of a join) are read by the
+    // ReferenceSegmentGather, which groups them by chunk instead of resolving each position through a virtual accessor
+    const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+    if (reference_segment && !reference_segment->pos_list()->references_single_chunk()) {
+      ExpressionResultNulls nulls(segment.size());
+      auto gather = ReferenceSegmentGather<ColumnDataType>{*reference_segment};
+      gather.for_each(ChunkOffset{0}, static_cast<ChunkOffset>(segment.size()),
+                      [&](const auto offset, const auto& value) {
+                        if (value) {
+                          values[offset] = *value;
+                        } else {
+                          nulls[offset] = true;
+                        }
+                      });
+
+      if (_table->column_is_nullable(column_id)) {
+        _segment_materializations[column_id] =
+            std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
+      } else {
+        _segment_materializations[column_id] = std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values));
+      }
+      return;
+    }
+
     if (_table->column_is_nullable(column_id)) {
-      std::vector<bool> nulls(segment.size());
+      ExpressionResultNulls nulls(segment.size());
 
       segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
         if (position.is_null()) {
@@ -1371,7 +1492,7 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_sub
   const auto row_count = _result_size(strings->size(), starts->size(), lengths->size());
 
   std::vector<pmr_string> result_values(row_count);
-  std::vector<bool> result_nulls(row_count);
+  ExpressionResultNulls result_nulls(row_count);
 
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
     result_nulls[chunk_offset] =
@@ -1471,7 +1592,7 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_con
   }
 
   // 4 - Optionally concatenate the nulls (i.e. one argument is null -> result is null) and return
-  std::vector<bool> result_nulls{};
+  ExpressionResultNulls result_nulls{};
   if (result_is_nullable) {
     result_nulls.resize(result_size, false);
     for (const auto& argument_result : argument_results) {
@@ -1507,7 +1628,7 @@ std::vector<std::shared_ptr<ExpressionResult<Result>>> ExpressionEvaluator::_pru
     Assert(table->column_data_type(ColumnID{0}) == data_type_from_type<Result>(),
            "Expected different DataType from Subquery");
 
-    std::vector<bool> result_nulls;
+    ExpressionResultNulls result_nulls;
     std::vector<Result> result_values(table->row_count());
 
     auto chunk_offset = ChunkOffset{0};
@@ -6,6 +6,7 @@
 #include "boost/variant.hpp"
 
 #include "all_type_variant.hpp"
+#include "expression/abstract_expression.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression_result.hpp"
@@ -62,9 +63,13 @@ class ExpressionEvaluator final {
    * For Expressions that reference segments from a single table
    * @param uncorrelated_subquery_results  Results from pre-computed uncorrelated selects, so they do not need to be
    *                                     evaluated for every chunk. Solely for performance.
+   * @param common_subexpressions  Subexpressions that occur multiple times in the expressions evaluated with this
+   *                               evaluator (see find_common_subexpressions()). Their results are computed once and
+   *                               reused. Solely for performance.
    */
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {});
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {},
+                      const std::shared_ptr<const ExpressionUnorderedSet>& common_subexpressions = {});
 
   std::shared_ptr<BaseValueSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   PosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
@@ -76,7 +81,16 @@ class ExpressionEvaluator final {
   static std::shared_ptr<UncorrelatedSubqueryResults> populate_uncorrelated_subquery_results_cache(
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
+  // Utility to find the subexpressions that occur more than once in @param expressions, e.g., `a + b` in
+  // `SELECT a + b, (a + b) * c`. Columns and values are not included.
+  static std::shared_ptr<ExpressionUnorderedSet> find_common_subexpressions(
+      const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
  private:
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result_without_cache(
+      const AbstractExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -164,6 +178,23 @@ class ExpressionEvaluator final {
   template <typename Functor>
   void _resolve_to_expression_result(const AbstractExpression& expression, const Functor& fn);
 
+  // Like _resolve_to_expression_results(), but passes the shared_ptrs of the results, see _reuse_values()
+  template <typename Functor>
+  void _resolve_to_expression_result_ptrs(const AbstractExpression& left_expression,
+                                          const AbstractExpression& right_expression, const Functor& fn);
+
+  template <typename Functor>
+  void _resolve_to_expression_result_ptr(const AbstractExpression& expression, const Functor& fn);
+
+  /**
+   * Moves the values of @param operand into @param values if nothing but the caller references the operand and it
+   * has the requested size. This way, a chain of operations like `a + b * c` reuses the buffer of the intermediate
+   * `b * c` instead of allocating (and page faulting) a new one for every operation.
+   */
+  template <typename Result, typename OperandDataType>
+  static bool _reuse_values(std::vector<Result>& values,
+                            const std::shared_ptr<ExpressionResult<OperandDataType>>& operand, const size_t size);
+
   /**
    * Compute the number of rows that any kind expression produces, given the number of rows in its parameters
    */
@@ -176,7 +207,8 @@ class ExpressionEvaluator final {
    * Either operand can be either empty (the operand is not nullable), contain one element (the operand is a literal
    * with null info) or can have n rows (the operand is a nullable series)
    */
-  std::vector<bool> _evaluate_default_null_logic(const std::vector<bool>& left, const std::vector<bool>& right) const;
+  ExpressionResultNulls _evaluate_default_null_logic(const ExpressionResultNulls& left,
+                                                     const ExpressionResultNulls& right) const;
 
   void _materialize_segment_if_not_yet_materialized(const ColumnID column_id);
 
@@ -198,6 +230,9 @@ class ExpressionEvaluator final {
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+
+  const std::shared_ptr<const ExpressionUnorderedSet> _common_subexpressions;
+  ExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _common_subexpression_results;
 };
 
 }  // namespace opossum
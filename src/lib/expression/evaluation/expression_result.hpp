@@ -62,7 +62,7 @@ class ExpressionResult : public BaseExpressionResult {
 
   ExpressionResult() = default;
 
-  explicit ExpressionResult(std::vector<T> values, std::vector<bool> nulls = {})
+  explicit ExpressionResult(std::vector<T> values, ExpressionResultNulls nulls = {})
       : values(std::move(values)), nulls(std::move(nulls)) {
     DebugAssert(nulls.empty() || nulls.size() == values.size(), "Need as many nulls as values or no nulls at all");
   }
@@ -109,7 +109,7 @@ class ExpressionResult : public BaseExpressionResult {
   size_t size() const { return values.size(); }
 
   std::vector<T> values;
-  std::vector<bool> nulls;
+  ExpressionResultNulls nulls;
 };
 
 }  // namespace opossum
@@ -1,10 +1,18 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
+
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+/**
+ * Null flags of an ExpressionResult. A byte per flag instead of the bit-packed std::vector<bool>, so that the loops
+ * computing and reading them do not need to mask individual bits and can be vectorized by the compiler.
+ */
+using ExpressionResultNulls = std::vector<uint8_t>;
+
 /**
  * ExpressionResultViews is a Concept used internally in the ExpressionEvaluator to allow the compiler to throw
  * away, e.g., calls to is_null(), if the ExpressionResult is non-nullable and to omit bounds checks in release builds.
@@ -20,7 +28,7 @@ class ExpressionResultNullableSeries {
  public:
   using Type = T;
 
-  ExpressionResultNullableSeries(const std::vector<T>& values, const std::vector<bool>& nulls)
+  ExpressionResultNullableSeries(const std::vector<T>& values, const ExpressionResultNulls& nulls)
       : _values(values), _nulls(nulls) {
     DebugAssert(values.size() == nulls.size(), "Need as many values as nulls");
   }
@@ -43,7 +51,7 @@ class ExpressionResultNullableSeries {
 
  private:
   const std::vector<T>& _values;
-  const std::vector<bool>& _nulls;
+  const ExpressionResultNulls& _nulls;
 };
 
 /**
@@ -1,12 +1,19 @@
 #include "like_matcher.hpp"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
 #include "boost/algorithm/string/replace.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant(pattern_string_to_pattern_variant(pattern)) {}
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
@@ -87,10 +94,12 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern also has to end with '%' (in which case a string is expected next). This rules out, e.g., '' and
+    // '%hello%world', which the loop above accepts.
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return GeneralPattern{pattern};
     }
   }
 }
@@ -120,6 +129,155 @@ std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
   return std::string{"^" + sql_like + "$"};
 }
 
+size_t LikeMatcher::find_substring(const std::string_view string, const std::string_view substring,
+                                   const size_t offset) {
+  if (offset > string.size() || substring.size() > string.size() - offset) return pmr_string::npos;
+  if (substring.empty()) return offset;
+
+  const auto* const data = string.data();
+  const auto last_candidate = string.size() - substring.size();
+
+  if (substring.size() == 1) {
+    const auto* const match =
+        static_cast<const char*>(std::memchr(data + offset, substring.front(), last_candidate - offset + 1));
+    return match ? static_cast<size_t>(match - data) : pmr_string::npos;
+  }
+
+  auto position = offset;
+
+#ifdef __SSE2__
+  // Compare the first and the last character of the substring with 16 candidate positions at once. Only for the
+  // candidates where both match, the characters in between are compared.
+  constexpr auto BLOCK_SIZE = size_t{16};
+  const auto first = _mm_set1_epi8(substring.front());
+  const auto last = _mm_set1_epi8(substring.back());
+
+  for (; position + BLOCK_SIZE <= last_candidate + 1; position += BLOCK_SIZE) {
+    const auto block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+    const auto block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position + substring.size() - 1));
+    auto mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last))));
+
+    while (mask != 0) {
+      const auto candidate = position + __builtin_ctz(mask);
+      if (std::memcmp(data + candidate + 1, substring.data() + 1, substring.size() - 2) == 0) return candidate;
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  for (; position <= last_candidate; ++position) {
+    if (data[position] == substring.front() && data[position + substring.size() - 1] == substring.back() &&
+        std::memcmp(data + position + 1, substring.data() + 1, substring.size() - 2) == 0) {
+      return position;
+    }
+  }
+
+  return pmr_string::npos;
+}
+
+LikeMatcher::GeneralPattern::GeneralPattern(const pmr_string& pattern) {
+  _contains_any_chars = pattern.find('%') != pmr_string::npos;
+  _starts_with_any_chars = !pattern.empty() && pattern.front() == '%';
+  _ends_with_any_chars = !pattern.empty() && pattern.back() == '%';
+
+  auto segment_begin = size_t{0};
+  while (segment_begin <= pattern.size()) {
+    const auto segment_end = std::min(pattern.find('%', segment_begin), pattern.size());
+
+    // Consecutive '%' and '%' at the beginning or the end of the pattern lead to empty segments, except for a pattern
+    // without '%', which needs its single (potentially empty) segment
+    if (segment_end > segment_begin || !_contains_any_chars) {
+      auto segment = Segment{pattern.substr(segment_begin, segment_end - segment_begin)};
+
+      auto literal_begin = size_t{0};
+      while (literal_begin < segment.characters.size()) {
+        const auto literal_end = std::min(segment.characters.find('_', literal_begin), segment.characters.size());
+        if (literal_end - literal_begin > segment.literal_length) {
+          segment.literal_offset = literal_begin;
+          segment.literal_length = literal_end - literal_begin;
+        }
+        literal_begin = literal_end + 1;
+      }
+
+      _segments.emplace_back(std::move(segment));
+    }
+
+    segment_begin = segment_end + 1;
+  }
+}
+
+bool LikeMatcher::GeneralPattern::matches(const std::string_view string) const {
+  if (!_contains_any_chars) {
+    const auto& segment = _segments.front();
+    return string.size() == segment.characters.size() && _matches_at(string, 0, segment);
+  }
+
+  // Matches of the remaining segments have to lie within [begin, end)
+  auto begin = size_t{0};
+  auto end = string.size();
+  auto segments_begin = _segments.begin();
+  auto segments_end = _segments.end();
+
+  if (!_starts_with_any_chars) {
+    const auto& segment = *segments_begin;
+    if (segment.characters.size() > end || !_matches_at(string, 0, segment)) return false;
+    begin = segment.characters.size();
+    ++segments_begin;
+  }
+
+  if (!_ends_with_any_chars) {
+    const auto& segment = *(segments_end - 1);
+    if (segment.characters.size() > end - begin ||
+        !_matches_at(string, end - segment.characters.size(), segment)) {
+      return false;
+    }
+    end -= segment.characters.size();
+    --segments_end;
+  }
+
+  for (auto segment_iter = segments_begin; segment_iter < segments_end; ++segment_iter) {
+    const auto position = _find(string, begin, end, *segment_iter);
+    if (position == pmr_string::npos) return false;
+    begin = position + segment_iter->characters.size();
+  }
+
+  return true;
+}
+
+bool LikeMatcher::GeneralPattern::_matches_at(const std::string_view string, const size_t position,
+                                              const Segment& segment) const {
+  const auto& characters = segment.characters;
+  for (auto character_idx = size_t{0}; character_idx < characters.size(); ++character_idx) {
+    if (characters[character_idx] != '_' && characters[character_idx] != string[position + character_idx]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t LikeMatcher::GeneralPattern::_find(const std::string_view string, const size_t begin, const size_t end,
+                                          const Segment& segment) const {
+  const auto segment_size = segment.characters.size();
+  if (segment_size > end - begin) return pmr_string::npos;
+
+  // A segment consisting only of '_' matches anywhere
+  if (segment.literal_length == 0) return begin;
+
+  // Search for the literal part of the segment in the range where it could be located and then compare the rest
+  const auto literal = std::string_view{segment.characters}.substr(segment.literal_offset, segment.literal_length);
+  const auto search_range = string.substr(0, end - (segment_size - segment.literal_offset - segment.literal_length));
+
+  auto literal_position = find_substring(search_range, literal, begin + segment.literal_offset);
+  while (literal_position != pmr_string::npos) {
+    const auto position = literal_position - segment.literal_offset;
+    if (_matches_at(string, position, segment)) return position;
+    literal_position = find_substring(search_range, literal, literal_position + 1);
+  }
+
+  return pmr_string::npos;
+}
+
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
   switch (wildcard) {
     case LikeMatcher::Wildcard::SingleChar:
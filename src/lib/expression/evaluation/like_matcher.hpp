@@ -1,7 +1,7 @@
 #pragma once
 
-#include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -14,7 +14,7 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are matched by GeneralPattern, which never backtracks.
  */
 class LikeMatcher {
  public:
@@ -23,6 +23,14 @@ class LikeMatcher {
    */
   static std::string sql_like_to_regex(pmr_string sql_like);
 
+  /**
+   * Returns the position of the first occurrence of @param substring in @param string at or after @param offset, or
+   * pmr_string::npos. Blocks of 16 candidate positions are filtered by comparing the first and the last character of
+   * the substring using SSE2 before the remaining characters are compared.
+   */
+  static size_t find_substring(const std::string_view string, const std::string_view substring,
+                               const size_t offset = 0);
+
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -40,7 +48,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is handled by GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -58,13 +66,42 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // Anything else, e.g., 'h_llo%w%ld'
+  class GeneralPattern final {
+   public:
+    explicit GeneralPattern(const pmr_string& pattern);
+
+    /**
+     * The pattern is split at '%' into segments of characters and '_'. A string matches if the segments can be found
+     * in it in order, the first one at its beginning and the last one at its end (unless the pattern starts or ends
+     * with '%'). As '%' matches any number of characters, it is always safe to pick the leftmost occurrence of a
+     * segment, so that each segment is searched for only once and no backtracking is necessary.
+     */
+    bool matches(const std::string_view string) const;
+
+   private:
+    struct Segment {
+      // '_' stands for any character
+      pmr_string characters;
+      // Longest run of characters without '_', used to search for the segment with find_substring()
+      size_t literal_offset{0};
+      size_t literal_length{0};
+    };
+
+    bool _matches_at(const std::string_view string, const size_t position, const Segment& segment) const;
+    size_t _find(const std::string_view string, const size_t begin, const size_t end, const Segment& segment) const;
+
+    std::vector<Segment> _segments;
+    bool _contains_any_chars{false};
+    bool _starts_with_any_chars{false};
+    bool _ends_with_any_chars{false};
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a GeneralPattern.
    */
   using AllPatternVariant =
-      boost::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      boost::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -94,7 +131,7 @@ class LikeMatcher {
     } else if (_pattern_variant.type() == typeid(ContainsPattern)) {
       const auto& contains_str = boost::get<ContainsPattern>(_pattern_variant).string;
       functor([&](const pmr_string& string) -> bool {
-        return (string.find(contains_str) != pmr_string::npos) ^ invert_results;
+        return (find_substring(string, contains_str) != pmr_string::npos) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(MultipleContainsPattern)) {
@@ -103,17 +140,17 @@ class LikeMatcher {
       functor([&](const pmr_string& string) -> bool {
         auto current_position = size_t{0};
         for (const auto& contains_str : contains_strs) {
-          current_position = string.find(contains_str, current_position);
+          current_position = find_substring(string, contains_str, current_position);
           if (current_position == pmr_string::npos) return invert_results;
           current_position += contains_str.size();
         }
         return !invert_results;
       });
 
-    } else if (_pattern_variant.type() == typeid(std::regex)) {
-      const auto& regex = boost::get<std::regex>(_pattern_variant);
+    } else if (_pattern_variant.type() == typeid(GeneralPattern)) {
+      const auto& general_pattern = boost::get<GeneralPattern>(_pattern_variant);
 
-      functor([&](const pmr_string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      functor([&](const pmr_string& string) -> bool { return general_pattern.matches(string) ^ invert_results; });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
@@ -1,9 +1,29 @@
 #pragma once
 
+#include <cstdint>
+
+#include "types.hpp"
+
 namespace opossum {
 
-enum class BinarySegmentType : uint8_t { value_segment = 0, dictionary_segment = 1 };
+enum class BinarySegmentType : uint8_t {
+  value_segment = 0,
+  dictionary_segment = 1,
+  fixed_string_dictionary_segment = 2,
+  run_length_segment = 3,
+  frame_of_reference_segment = 4,
+  lz4_segment = 5
+};
 
 using BoolAsByteType = uint8_t;
 
+// Every binary file begins with the magic number and the version of the format, so that files that were written in a
+// different format (e.g., cached tables of an older build) are rejected instead of being misread. The version has to be
+// incremented whenever the layout of the file changes.
+constexpr uint32_t BINARY_FORMAT_MAGIC_NUMBER = 0x46425948;  // The bytes "HYBF" on little-endian machines
+constexpr uint32_t BINARY_FORMAT_VERSION = 1;
+
+// Compressed vectors are stored with their width in bytes. SimdBp128 vectors do not have a fixed width.
+constexpr AttributeVectorWidth SIMD_BP128_VECTOR_WIDTH = 0;
+
 }  // namespace opossum
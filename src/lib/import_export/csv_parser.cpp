@@ -1,13 +1,15 @@
 #include "csv_parser.hpp"
 
 #include <boost/algorithm/string/trim.hpp>
-#include <fstream>
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <list>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -22,11 +24,49 @@
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
+#include "utils/mapped_file.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the first position in [begin, end) that holds either character a or b, or end if there is none. Eight bytes
+// are checked at once (SIMD within a register, see https://graphics.stanford.edu/~seander/bithacks.html#ValueInWord),
+// which speeds up skipping long fields.
+size_t find_either(std::string_view content, const size_t begin, const size_t end, const char a, const char b) {
+  constexpr auto LOW_BITS = uint64_t{0x0101010101010101};
+  constexpr auto HIGH_BITS = uint64_t{0x8080808080808080};
+  const auto pattern_a = LOW_BITS * static_cast<uint8_t>(a);
+  const auto pattern_b = LOW_BITS * static_cast<uint8_t>(b);
+
+  auto pos = begin;
+  for (; pos + sizeof(uint64_t) <= end; pos += sizeof(uint64_t)) {
+    auto word = uint64_t{};
+    std::memcpy(&word, content.data() + pos, sizeof(uint64_t));
+
+    // A byte of word ^ pattern is zero if the byte of word matches. Checks if any byte is zero.
+    const auto matches_a = word ^ pattern_a;
+    const auto matches_b = word ^ pattern_b;
+    if ((((matches_a - LOW_BITS) & ~matches_a) | ((matches_b - LOW_BITS) & ~matches_b)) & HIGH_BITS) break;
+  }
+
+  for (; pos < end; ++pos) {
+    if (content[pos] == a || content[pos] == b) return pos;
+  }
+  return end;
+}
+
+}  // namespace
 
 namespace opossum {
 
+CsvParser::CsvParser(const size_t scan_block_size) : _scan_block_size(scan_block_size) {
+  Assert(_scan_block_size > 0, "Scan block size must be greater than 0");
+}
+
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta,
-                                        const ChunkOffset chunk_size) {
+                                        const ChunkOffset chunk_size,
+                                        const std::optional<SegmentEncodingSpec>& encoding_spec) {
   // If no meta info is given as a parameter, look for a json file
   if (csv_meta == std::nullopt) {
     _meta = process_csv_meta_file(filename + CsvMeta::META_FILE_EXTENSION);
@@ -38,53 +78,75 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::
 
   auto table = _create_table_from_meta(chunk_size);
 
-  std::ifstream csvfile{filename};
+  // As before CSV files were mapped, a file that cannot be opened is read as an empty file
+  auto csv_file = std::optional<MappedFile>{};
+  try {
+    csv_file.emplace(filename);
+  } catch (const std::system_error&) {
+    return table;
+  }
+  const auto content = csv_file->content();
 
   // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
-
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != _meta.config.delimiter) content.push_back(_meta.config.delimiter);
-
-  std::string_view content_view{content.c_str(), content.size()};
-
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
-  std::vector<size_t> field_ends;
-  while (_find_fields_in_chunk(content_view, *table, field_ends)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+  if (content.empty() || content.front() == '\r' || content.front() == '\n') return table;
+
+  // Start of the first row that is not yet part of a chunk
+  auto chunk_begin = size_t{0};
+  // Ends of the rows that are not yet part of a chunk
+  auto row_ends = std::vector<size_t>{};
+
+  auto scan_begin = size_t{0};
+  auto in_quotes = false;
+  const auto window_size = _scan_block_size * SCAN_BLOCKS_PER_WINDOW;
+
+  while (scan_begin < content.size()) {
+    const auto scan_end = std::min(scan_begin + window_size, content.size());
+    _find_row_ends(content, scan_begin, scan_end, in_quotes, row_ends);
+    scan_begin = scan_end;
+
+    const auto is_last_window = scan_end == content.size();
+    const auto last_row_end = row_ends.empty() ? chunk_begin : row_ends.back() + 1;
+    if (is_last_window && last_row_end < content.size()) {
+      // The last row is not terminated by a delimiter
+      row_ends.emplace_back(content.size());
+    }
 
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
+    // Cut full chunks (and, at the end of the file, the remaining rows) and parse them in parallel. Rows that do not
+    // fill a chunk yet are kept for the next window.
+    std::list<std::shared_ptr<Chunk>> chunks;
+    std::vector<std::shared_ptr<AbstractTask>> tasks;
+    auto row_idx = size_t{0};
+    while (row_ends.size() - row_idx >= chunk_size || (is_last_window && row_idx < row_ends.size())) {
+      const auto chunk_row_count = std::min(static_cast<size_t>(chunk_size), row_ends.size() - row_idx);
+      const auto chunk_end = row_ends[row_idx + chunk_row_count - 1];
+
+      chunks.emplace_back();
+      auto& chunk = chunks.back();
+
+      tasks.emplace_back(std::make_shared<JobTask>([&, chunk_begin, chunk_end]() {
+        if (chunk_end < content.size()) {
+          chunk = _parse_chunk(content.substr(chunk_begin, chunk_end - chunk_begin + 1), *table, encoding_spec);
+        } else {
+          // make sure the content ends with a delimiter for better row processing later
+          auto terminated_content = std::string(content.substr(chunk_begin));
+          terminated_content.push_back(_meta.config.delimiter);
+          chunk = _parse_chunk(terminated_content, *table, encoding_spec);
+        }
+      }));
+      tasks.back()->schedule();
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+      chunk_begin = chunk_end + 1;
+      row_idx += chunk_row_count;
+    }
+    row_ends.erase(row_ends.begin(), row_ends.begin() + row_idx);
 
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([this, relevant_content, field_ends, &table, &segments]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments);
-    }));
-    tasks.back()->schedule();
-  }
+    CurrentScheduler::wait_for_tasks(tasks);
 
-  CurrentScheduler::wait_for_tasks(tasks);
+    for (const auto& chunk : chunks) {
+      table->append_chunk(chunk);
+    }
 
-  for (auto& segments : segments_by_chunks) {
-    table->append_chunk(segments);
+    csv_file->release(chunk_begin);
   }
 
   return table;
@@ -113,6 +175,93 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
+void CsvParser::_find_row_ends(std::string_view csv_content, const size_t begin, const size_t end, bool& in_quotes,
+                               std::vector<size_t>& row_ends) const {
+  const auto block_count = (end - begin + _scan_block_size - 1) / _scan_block_size;
+  const auto block_begin = [&](const size_t block_idx) { return std::min(begin + block_idx * _scan_block_size, end); };
+
+  // First pass: Count the quotes in each block. A block starts within a quoted field if the number of quotes before it
+  // is odd.
+  // Not std::vector<bool>, as the tasks write to it concurrently
+  std::vector<uint8_t> block_has_odd_quote_count(block_count);
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, block_idx]() {
+      const auto block_end = block_begin(block_idx + 1);
+      auto quote_count = size_t{0};
+      auto pos = find_either(csv_content, block_begin(block_idx), block_end, _meta.config.quote, _meta.config.quote);
+      while (pos < block_end) {
+        quote_count += _is_unescaped_quote(csv_content, pos);
+        pos = find_either(csv_content, pos + 1, block_end, _meta.config.quote, _meta.config.quote);
+      }
+      block_has_odd_quote_count[block_idx] = quote_count % 2;
+    }));
+    tasks.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  std::vector<bool> block_starts_in_quotes(block_count);
+  for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+    block_starts_in_quotes[block_idx] = in_quotes;
+    if (block_has_odd_quote_count[block_idx]) in_quotes = !in_quotes;
+  }
+
+  // Second pass: Collect the delimiters that are not part of a quoted field
+  std::vector<std::vector<size_t>> row_ends_by_block(block_count);
+  tasks.clear();
+  for (auto block_idx = size_t{0}; block_idx < block_count; ++block_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, block_idx]() {
+      const auto block_end = block_begin(block_idx + 1);
+      auto block_in_quotes = block_starts_in_quotes[block_idx];
+      auto& block_row_ends = row_ends_by_block[block_idx];
+      const auto& config = _meta.config;
+      auto pos = find_either(csv_content, block_begin(block_idx), block_end, config.quote, config.delimiter);
+      while (pos < block_end) {
+        if (csv_content[pos] == config.delimiter && !block_in_quotes) {
+          block_row_ends.emplace_back(pos);
+        } else if (_is_unescaped_quote(csv_content, pos)) {
+          block_in_quotes = !block_in_quotes;
+        }
+        pos = find_either(csv_content, pos + 1, block_end, config.quote, config.delimiter);
+      }
+    }));
+    tasks.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  for (const auto& block_row_ends : row_ends_by_block) {
+    row_ends.insert(row_ends.end(), block_row_ends.begin(), block_row_ends.end());
+  }
+}
+
+bool CsvParser::_is_unescaped_quote(std::string_view csv_content, const size_t pos) const {
+  if (csv_content[pos] != _meta.config.quote) return false;
+
+  // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
+  if (_meta.config.quote != _meta.config.escape) {
+    return pos == 0 || csv_content[pos - 1] != _meta.config.escape;
+  }
+  return true;
+}
+
+std::shared_ptr<Chunk> CsvParser::_parse_chunk(std::string_view csv_chunk, const Table& table,
+                                               const std::optional<SegmentEncodingSpec>& encoding_spec) {
+  std::vector<size_t> field_ends;
+  _find_fields_in_chunk(csv_chunk, table, field_ends);
+
+  Segments segments;
+  const auto row_count = _parse_into_chunk(csv_chunk.substr(0, field_ends.back()), field_ends, table, segments);
+
+  const auto mvcc_data = table.has_mvcc() == UseMvcc::Yes ? std::make_shared<MvccData>(row_count) : nullptr;
+  const auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+
+  if (encoding_spec) {
+    ChunkEncoder::encode_chunk(chunk, table.column_data_types(), *encoding_spec);
+  }
+
+  return chunk;
+}
+
 bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table,
                                       std::vector<size_t>& field_ends) {
   field_ends.clear();
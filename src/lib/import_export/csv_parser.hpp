@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "import_export/csv_meta.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -21,22 +22,35 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser memory-maps the csv file and processes it in windows of SCAN_BLOCKS_PER_WINDOW blocks. The blocks of a
+ * window are scanned for row ends in parallel: A first pass counts the quotes in each block, which tells the second
+ * pass whether a block starts within a quoted field. The rows are then cut into data chunks that are aligned with the
+ * csv rows. Each data chunk is parsed, converted into an opossum chunk and, optionally, encoded by a separate task.
+ * Once all chunks of a window are appended to the table, the pages of the file are released. Thus, the memory needed
+ * for the raw csv content does not grow with the size of the file.
  */
 class CsvParser {
  public:
+  static constexpr size_t DEFAULT_SCAN_BLOCK_SIZE = 16 * 1024 * 1024;
+  static constexpr size_t SCAN_BLOCKS_PER_WINDOW = 16;
+
+  /*
+   * @param scan_block_size Number of bytes scanned for row ends by one task. Mainly exposed for testing.
+   */
+  explicit CsvParser(const size_t scan_block_size = DEFAULT_SCAN_BLOCK_SIZE);
+
   // cannot move-assign because of const members
   CsvParser& operator=(CsvParser&&) = delete;
 
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec If set, each chunk is encoded by the task that parsed it.
    * @returns             The table that was created from the csv file.
    */
   std::shared_ptr<Table> parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta = std::nullopt,
-                               const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+                               const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
+                               const std::optional<SegmentEncodingSpec>& encoding_spec = std::nullopt);
   std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                      const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
@@ -46,6 +60,30 @@ class CsvParser {
    */
   std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size);
 
+  /*
+   * @param      csv_content      The complete content of the CSV.
+   * @param      begin            First position to scan.
+   * @param      end              Position after the last position to scan.
+   * @param[in,out] in_quotes     Whether begin lies within a quoted field. Set to whether end does.
+   * @param[out] row_ends         Positions of the delimiters that end rows between begin and end are appended.
+   */
+  void _find_row_ends(std::string_view csv_content, const size_t begin, const size_t end, bool& in_quotes,
+                      std::vector<size_t>& row_ends) const;
+
+  /*
+   * @returns Whether the character at pos is a quote that is not escaped.
+   */
+  bool _is_unescaped_quote(std::string_view csv_content, const size_t pos) const;
+
+  /*
+   * @param csv_chunk     String_view on the rows of one chunk, including the delimiter of the last row.
+   * @param table         Empty table created by _process_meta_file.
+   * @param encoding_spec Encoding to apply to the chunk, if any.
+   * @returns             The chunk, with MVCC data if the table uses MVCC.
+   */
+  std::shared_ptr<Chunk> _parse_chunk(std::string_view csv_chunk, const Table& table,
+                                      const std::optional<SegmentEncodingSpec>& encoding_spec);
+
   /*
    * @param      csv_content String_view on the remaining content of the CSV.
    * @param      table       Empty table created by _process_meta_file.
@@ -74,5 +112,7 @@ class CsvParser {
   CsvMeta _meta;
 
   std::string _escaped_linebreak;
+
+  const size_t _scan_block_size;
 };
 }  // namespace opossum
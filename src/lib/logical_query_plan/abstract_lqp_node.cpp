@@ -216,6 +216,53 @@ bool AbstractLQPNode::is_column_nullable(const ColumnID column_id) const {
   return left_input()->is_column_nullable(column_id);
 }
 
+LQPUniqueConstraints AbstractLQPNode::unique_constraints() const {
+  // Default behaviour: Forward from input, as long as all columns of a constraint are still part of the output
+  if (!left_input() || right_input()) return {};
+
+  auto unique_constraints = left_input()->unique_constraints();
+  unique_constraints.erase(std::remove_if(unique_constraints.begin(), unique_constraints.end(),
+                                          [&](const auto& unique_constraint) {
+                                            return std::any_of(unique_constraint.column_expressions.begin(),
+                                                               unique_constraint.column_expressions.end(),
+                                                               [&](const auto& expression) {
+                                                                 return !find_column_id(*expression);
+                                                               });
+                                          }),
+                           unique_constraints.end());
+  return unique_constraints;
+}
+
+bool AbstractLQPNode::has_unique_constraint(const ExpressionUnorderedSet& column_expressions) const {
+  const auto unique_constraints = this->unique_constraints();
+  return std::any_of(unique_constraints.begin(), unique_constraints.end(), [&](const auto& unique_constraint) {
+    return std::all_of(unique_constraint.column_expressions.begin(), unique_constraint.column_expressions.end(),
+                       [&](const auto& expression) { return column_expressions.count(expression) > 0; });
+  });
+}
+
+FunctionalDependencies AbstractLQPNode::functional_dependencies() const {
+  auto functional_dependencies = FunctionalDependencies{};
+
+  for (const auto& unique_constraint : unique_constraints()) {
+    // With NULLs, two rows that share the (non-NULL) determinants are not guaranteed to be the same row
+    const auto has_nullable_column =
+        std::any_of(unique_constraint.column_expressions.begin(), unique_constraint.column_expressions.end(),
+                    [&](const auto& expression) { return is_column_nullable(get_column_id(*expression)); });
+    if (has_nullable_column) continue;
+
+    auto dependents = ExpressionUnorderedSet{};
+    for (const auto& expression : column_expressions()) {
+      if (!unique_constraint.column_expressions.count(expression)) dependents.emplace(expression);
+    }
+    if (dependents.empty()) continue;
+
+    functional_dependencies.emplace_back(FunctionalDependency{unique_constraint.column_expressions, dependents});
+  }
+
+  return functional_dependencies;
+}
+
 const std::shared_ptr<TableStatistics> AbstractLQPNode::get_statistics() {
   return derive_statistics_from(left_input(), right_input());
 }
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "enable_make_for_lqp_node.hpp"
+#include "lqp_unique_constraint.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -140,6 +141,32 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
    */
   virtual bool is_column_nullable(const ColumnID column_id) const;
 
+  /**
+   * @defgroup Data dependencies of the node's output, derived from the UNIQUE and PRIMARY KEY constraints of the
+   * stored tables (see Table::add_unique_constraint()). Optimizer rules can use them, e.g., to remove redundant
+   * GROUP BY columns or to turn joins on unique columns into semi joins.
+   * @{
+   */
+
+  /**
+   * @return the sets of output columns whose value combinations are unique. The default implementation forwards
+   *         those constraints of the only input whose columns are all part of this node's output.
+   */
+  virtual LQPUniqueConstraints unique_constraints() const;
+
+  /**
+   * @return whether the value combinations of @param column_expressions are unique, i.e., whether they contain all
+   *         columns of at least one unique constraint
+   */
+  bool has_unique_constraint(const ExpressionUnorderedSet& column_expressions) const;
+
+  /**
+   * @return for each unique constraint without nullable columns, the dependency of all other output columns on it
+   */
+  FunctionalDependencies functional_dependencies() const;
+
+  /** @} */
+
   // @{
   /**
    * These functions provide access to statistics for this particular node.
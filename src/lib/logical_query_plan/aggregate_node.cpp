@@ -94,6 +94,29 @@ bool AggregateNode::is_column_nullable(const ColumnID column_id) const {
   return node_expressions[column_id]->is_nullable_on_lqp(*left_input());
 }
 
+LQPUniqueConstraints AggregateNode::unique_constraints() const {
+  // Without GROUP BY, the output consists of a single row, which is not expressed as a unique constraint
+  if (aggregate_expressions_begin_idx == 0) return {};
+
+  // Each group is emitted once, so the group by columns are unique
+  const auto group_by_expressions =
+      ExpressionUnorderedSet(node_expressions.begin(), node_expressions.begin() + aggregate_expressions_begin_idx);
+  auto unique_constraints = LQPUniqueConstraints{LQPUniqueConstraint{group_by_expressions}};
+
+  // Constraints of the input that are made up of group by columns only remain valid, as a unique value can only
+  // belong to a single group
+  for (const auto& unique_constraint : left_input()->unique_constraints()) {
+    const auto columns_are_grouped = std::all_of(
+        unique_constraint.column_expressions.begin(), unique_constraint.column_expressions.end(),
+        [&](const auto& expression) { return group_by_expressions.count(expression) > 0; });
+    if (columns_are_grouped && unique_constraint.column_expressions.size() < group_by_expressions.size()) {
+      unique_constraints.emplace_back(unique_constraint);
+    }
+  }
+
+  return unique_constraints;
+}
+
 std::shared_ptr<AbstractLQPNode> AggregateNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
       node_expressions.begin(), node_expressions.begin() + aggregate_expressions_begin_idx};
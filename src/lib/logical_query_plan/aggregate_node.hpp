@@ -26,6 +26,7 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
   std::string description() const override;
   const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
   bool is_column_nullable(const ColumnID column_id) const override;
+  LQPUniqueConstraints unique_constraints() const override;
 
   std::shared_ptr<TableStatistics> derive_statistics_from(
       const std::shared_ptr<AbstractLQPNode>& left_input,
@@ -88,6 +88,37 @@ bool JoinNode::is_column_nullable(const ColumnID column_id) const {
   }
 }
 
+LQPUniqueConstraints JoinNode::unique_constraints() const {
+  Assert(left_input() && right_input(), "Need both inputs to determine unique constraints");
+
+  // The output of semi and anti joins is a subset of the left input
+  if (join_mode == JoinMode::Semi || join_mode == JoinMode::Anti) return left_input()->unique_constraints();
+
+  const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(this->join_predicate());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return {};
+
+  auto left_operand = join_predicate->left_operand();
+  auto right_operand = join_predicate->right_operand();
+  if (!left_input()->find_column_id(*left_operand)) std::swap(left_operand, right_operand);
+  if (!left_input()->find_column_id(*left_operand) || !right_input()->find_column_id(*right_operand)) return {};
+
+  // If the join column of one input is unique, each row of the other input is emitted at most once (plus, for outer
+  // joins, NULL-padded rows, which unique constraints ignore). Therefore, the other input's constraints remain valid.
+  auto unique_constraints = LQPUniqueConstraints{};
+  if (right_input()->has_unique_constraint({right_operand})) {
+    const auto left_unique_constraints = left_input()->unique_constraints();
+    unique_constraints.insert(unique_constraints.end(), left_unique_constraints.begin(),
+                              left_unique_constraints.end());
+  }
+  if (left_input()->has_unique_constraint({left_operand})) {
+    const auto right_unique_constraints = right_input()->unique_constraints();
+    unique_constraints.insert(unique_constraints.end(), right_unique_constraints.begin(),
+                              right_unique_constraints.end());
+  }
+
+  return unique_constraints;
+}
+
 std::shared_ptr<TableStatistics> JoinNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   DebugAssert(left_input && right_input, "JoinNode needs left_input and right_input");
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
@@ -94,6 +95,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   }
 
   const auto pqp = _translate_by_node_type(node->type, node);
+  if (!pqp->lqp_node) pqp->lqp_node = node;
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
@@ -158,57 +160,59 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
-  /**
-   * Not using OperatorScanPredicate, since it splits up BETWEEN into two scans for some cases that TableScan cannot handle
-   */
-
-  auto column_id = ColumnID{0};
-  auto value_variant = AllTypeVariant{NullValue{}};
-  auto value2_variant = std::optional<AllTypeVariant>{};
-
   // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
   // Our IndexScan implementation does not work on reference segments yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
-  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
-  Assert(predicate, "Expected predicate");
-  Assert(!predicate->arguments.empty(), "Expected arguments");
-
-  column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
-  if (predicate->arguments.size() > 1) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as second argument for IndexScan");
-    value_variant = value_expression->value;
-  }
-  if (predicate->arguments.size() > 2) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[2]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as third argument for IndexScan");
-    value2_variant = value_expression->value;
-  }
+  // The IndexScanRule only chooses IndexScans for predicates that result in a single OperatorScanPredicate comparing
+  // the column (on either side of the predicate) to a value or a parameter, which the IndexScan resolves at runtime
+  const auto operator_predicates = OperatorScanPredicate::from_expression(*node->predicate(), *node);
+  Assert(operator_predicates && operator_predicates->size() == 1, "Expected a single predicate for IndexScan");
+  const auto& operator_predicate = operator_predicates->front();
+  Assert(!is_column_id(operator_predicate.value), "Expected value or parameter as second argument for IndexScan");
 
+  const auto column_id = operator_predicate.column_id;
   const std::vector<ColumnID> column_ids = {column_id};
-  const std::vector<AllTypeVariant> right_values = {value_variant};
-  std::vector<AllTypeVariant> right_values2 = {};
-  if (value2_variant) right_values2.emplace_back(*value2_variant);
+  const std::vector<AllParameterVariant> right_values = {operator_predicate.value};
+  std::vector<AllParameterVariant> right_values2 = {};
+  if (operator_predicate.value2) right_values2.emplace_back(*operator_predicate.value2);
 
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
+
+  const auto& excluded_chunk_ids = stored_table_node->excluded_chunk_ids();
+
+  // A table index covers all chunks, so no TableScan is needed for the remaining chunks. Its positions refer to the
+  // chunks of the stored table, which GetTable renumbers when it prunes chunks. Thus, it is only used without pruning.
+  if (excluded_chunk_ids.empty() && table->get_table_index(column_id)) {
+    return std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                       operator_predicate.predicate_condition, right_values, right_values2);
+  }
+
+  // GetTable drops the excluded chunks, so the chunks are identified by their position in its output
+  const auto excluded_chunk_id_set = std::unordered_set<ChunkID>(excluded_chunk_ids.begin(), excluded_chunk_ids.end());
   std::vector<ChunkID> indexed_chunks;
 
+  auto input_chunk_id = ChunkID{0u};
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (excluded_chunk_id_set.count(chunk_id)) continue;
+
     const auto chunk = table->get_chunk(chunk_id);
     if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
-      indexed_chunks.emplace_back(chunk_id);
+      indexed_chunks.emplace_back(input_chunk_id);
     }
+    ++input_chunk_id;
   }
 
+  // An IndexScan without included chunks would scan all of them. This happens, e.g., if the table only has a table
+  // index, which cannot be used on the pruned table.
+  if (indexed_chunks.empty()) return _translate_predicate_node_to_table_scan(node, input_operator);
+
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
   auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+                                                operator_predicate.predicate_condition, right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -442,7 +446,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_view_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_create_table_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto create_table_node = std::dynamic_pointer_cast<CreateTableNode>(node);
-  return std::make_shared<CreateTable>(create_table_node->table_name, create_table_node->column_definitions);
+  return std::make_shared<CreateTable>(create_table_node->table_name, create_table_node->column_definitions,
+                                       create_table_node->constraint_definitions);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_drop_table_node(
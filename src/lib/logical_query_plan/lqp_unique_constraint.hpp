@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+
+namespace opossum {
+
+/**
+ * A set of output columns of an LQP node whose value combinations are unique. As for UNIQUE constraints in SQL, rows
+ * containing NULL in one of the columns are not considered.
+ */
+struct LQPUniqueConstraint final {
+  ExpressionUnorderedSet column_expressions;
+};
+
+using LQPUniqueConstraints = std::vector<LQPUniqueConstraint>;
+
+/**
+ * Rows that have the same values in all determinants also have the same values in all dependents.
+ */
+struct FunctionalDependency final {
+  ExpressionUnorderedSet determinants;
+  ExpressionUnorderedSet dependents;
+};
+
+using FunctionalDependencies = std::vector<FunctionalDependency>;
+
+}  // namespace opossum
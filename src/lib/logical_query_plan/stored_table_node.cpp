@@ -42,6 +42,22 @@ bool StoredTableNode::is_column_nullable(const ColumnID column_id) const {
   return table->column_is_nullable(column_id);
 }
 
+LQPUniqueConstraints StoredTableNode::unique_constraints() const {
+  const auto table = StorageManager::get().get_table(table_name);
+  const auto& expressions = column_expressions();
+
+  auto unique_constraints = LQPUniqueConstraints{};
+  for (const auto& constraint_definition : table->get_unique_constraints()) {
+    auto constraint_expressions = ExpressionUnorderedSet{};
+    for (const auto column_id : constraint_definition.columns) {
+      constraint_expressions.emplace(expressions[column_id]);
+    }
+    unique_constraints.emplace_back(LQPUniqueConstraint{constraint_expressions});
+  }
+
+  return unique_constraints;
+}
+
 std::shared_ptr<TableStatistics> StoredTableNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   DebugAssert(!left_input && !right_input, "StoredTableNode must be leaf");
@@ -34,6 +34,12 @@ bool UnionNode::is_column_nullable(const ColumnID column_id) const {
   }
 }
 
+LQPUniqueConstraints UnionNode::unique_constraints() const {
+  // UnionPositions emits each row of the common input at most once
+  DebugAssert(union_mode == UnionMode::Positions, "Unique constraints are only known for UnionMode::Positions");
+  return left_input()->unique_constraints();
+}
+
 std::shared_ptr<TableStatistics> UnionNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   Fail("Statistics for UNION not yet implemented");
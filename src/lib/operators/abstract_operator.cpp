@@ -7,9 +7,11 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/current_scheduler.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/performance_counters.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
 #include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
@@ -30,6 +32,7 @@ void AbstractOperator::execute() {
   DebugAssert(!_output, "Operator has already been executed");
 
   Timer performance_timer;
+  PerformanceCounters performance_counters;
 
   auto transaction_context = this->transaction_context();
 
@@ -53,9 +56,22 @@ void AbstractOperator::execute() {
   _on_cleanup();
 
   _performance_data->walltime = performance_timer.lap();
+  // The counters only count the calling thread. With the scheduler, they would miss the jobs of the operator and
+  // include unrelated tasks that the worker processes while waiting for them (see PerformanceCounters).
+  if (!CurrentScheduler::is_set()) _performance_data->performance_counters = performance_counters.lap();
+
+  if (_input_left) _performance_data->input_row_count = input_table_left()->row_count();
+  if (_input_right) _performance_data->input_row_count += input_table_right()->row_count();
+  if (_output) {
+    _performance_data->output_row_count = _output->row_count();
+    _performance_data->output_chunk_count = _output->chunk_count();
+    if (_type != OperatorType::GetTable && _type != OperatorType::TableWrapper) {
+      _performance_data->output_memory_usage = _output->estimate_memory_usage();
+    }
+  }
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
-                _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
+                _performance_data->output_row_count, _performance_data->output_chunk_count,
                 reinterpret_cast<uintptr_t>(this));
 }
 
@@ -79,6 +95,20 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
 
 void AbstractOperator::clear_output() { _output = nullptr; }
 
+void AbstractOperator::register_consumer() { ++_consumer_count; }
+
+bool AbstractOperator::deregister_consumer() {
+  const auto previous_consumer_count = _consumer_count--;
+  DebugAssert(previous_consumer_count > 0, "Operator " + description() + " has no registered consumers");
+
+  // Only the last consumer gets here, so the output is not cleared while another consumer still reads it
+  if (previous_consumer_count != 1) return false;
+  clear_output();
+  return true;
+}
+
+size_t AbstractOperator::consumer_count() const { return _consumer_count; }
+
 const std::string AbstractOperator::description(DescriptionMode description_mode) const { return name(); }
 
 std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
@@ -172,6 +202,7 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->lqp_node = lqp_node;
 
   copied_ops.emplace(this, copied_op);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -11,6 +12,7 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -84,13 +86,21 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   virtual void execute();
 
   // returns the result of the operator
-  // When using OperatorTasks, they automatically clear this once all successors are done. This reduces the number of
+  // When using OperatorTasks, they automatically clear this once all consumers are done. This reduces the number of
   // temporary tables.
   std::shared_ptr<const Table> get_output() const;
 
   // clears the output of this operator to free up space
   void clear_output();
 
+  // Reference counting of the operators that consume the output. OperatorTasks register one consumer per input edge
+  // when they are created and deregister it once the consuming operator was executed. deregister_consumer() clears the
+  // output and returns true when the last consumer is gone. Operators without registered consumers (e.g., the root of
+  // a PQP) keep their output.
+  void register_consumer();
+  bool deregister_consumer();
+  size_t consumer_count() const;
+
   virtual const std::string name() const = 0;
   virtual const std::string description(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 
@@ -129,6 +139,10 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // The LQP node this operator was translated from, if any. Its statistics provide the estimated cardinality of the
+  // operator's output (see explain_analyze.hpp). Kept by deep_copy().
+  std::shared_ptr<AbstractLQPNode> lqp_node;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -166,6 +180,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
 
+  std::atomic<size_t> _consumer_count{0};
+
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
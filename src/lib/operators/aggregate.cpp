@@ -21,7 +21,9 @@
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
 
 namespace {
 using namespace opossum;  // NOLINT
@@ -55,7 +57,7 @@ namespace opossum {
 Aggregate::Aggregate(const std::shared_ptr<AbstractOperator>& in,
                      const std::vector<AggregateColumnDefinition>& aggregates,
                      const std::vector<ColumnID>& groupby_column_ids)
-    : AbstractReadOnlyOperator(OperatorType::Aggregate, in),
+    : AbstractReadOnlyOperator(OperatorType::Aggregate, in, nullptr, std::make_unique<Aggregate::PerformanceData>()),
       _aggregates(aggregates),
       _groupby_column_ids(groupby_column_ids) {
   Assert(!(aggregates.empty() && groupby_column_ids.empty()),
@@ -252,6 +254,9 @@ void Aggregate::_aggregate() {
   using AggregateKeysAllocator =
       boost::container::scoped_allocator_adaptor<PolymorphicAllocator<AggregateKeys<AggregateKey>>>;
 
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  Timer timer;
+
   auto input_table = input_table_left();
 
   for ([[maybe_unused]] const auto& groupby_column_id : _groupby_column_ids) {
@@ -325,6 +330,8 @@ void Aggregate::_aggregate() {
 
   for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
     jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
       const auto column_id = _groupby_column_ids.at(group_column_index);
       const auto data_type = input_table->column_data_type(column_id);
 
@@ -415,8 +422,14 @@ void Aggregate::_aggregate() {
     _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
   }
 
+  performance_data.groupby = timer.lap();
+
   // Process Chunks and perform aggregations
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    // If the query was cancelled, the keys of some chunks might not have been computed. The remaining chunks are not
+    // aggregated and the output is written from the incomplete results, which the caller discards.
+    if (AbstractTask::is_current_task_cancelled()) return;
+
     auto chunk_in = input_table->get_chunk(chunk_id);
 
     const auto& hash_keys = keys_per_chunk[chunk_id];
@@ -527,6 +540,8 @@ void Aggregate::_aggregate() {
       }
     }
   }
+
+  performance_data.aggregate = timer.lap();
 }
 
 std::shared_ptr<const Table> Aggregate::_on_execute() {
@@ -549,6 +564,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
       break;
   }
 
+  Timer timer;
+
   const auto& input_table = input_table_left();
 
   /**
@@ -590,6 +607,8 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   auto output = std::make_shared<Table>(_output_column_definitions, TableType::Data);
   output->append_chunk(_output_segments);
 
+  static_cast<PerformanceData&>(*_performance_data).output_writing = timer.lap();
+
   return output;
 }
 
@@ -862,4 +881,12 @@ std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(cons
   return context;
 }
 
+std::string Aggregate::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += "groupby " + format_duration(groupby) + ", aggregate " + format_duration(aggregate) +
+            ", output writing " + format_duration(output_writing);
+  return string;
+}
+
 }  // namespace opossum
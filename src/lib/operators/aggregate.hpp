@@ -3,6 +3,7 @@
 #include <boost/container/pmr/polymorphic_allocator.hpp>
 #include <boost/container/scoped_allocator.hpp>
 #include <boost/functional/hash.hpp>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -108,6 +109,15 @@ class Aggregate : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  // Durations of the steps of the aggregation. groupby includes the computation of the keys of the groups.
+  struct PerformanceData : public OperatorPerformanceData {
+    std::chrono::nanoseconds groupby{0};
+    std::chrono::nanoseconds aggregate{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
   // write the aggregated output for a given aggregate column
   template <typename ColumnDataType, AggregateFunction function>
   void write_aggregate_output(ColumnID column_index);
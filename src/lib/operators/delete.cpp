@@ -101,11 +101,16 @@ void Delete::_on_commit_records(const CommitID cid) {
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
 
+    // The rows are not removed from the referenced table's table indexes, as transactions with an older snapshot
+    // might still look them up. Their end_cid makes sure that they are filtered out by later transactions.
+
     // Update statistics about deleted rows
     const auto table_statistics = referenced_table->table_statistics();
     if (table_statistics) {
       table_statistics->increase_invalid_row_count(referencing_segment->pos_list()->size());
     }
+
+    referenced_table->register_commit(cid);
   }
 }
 
@@ -8,11 +8,15 @@
 
 #include "import_export/binary.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
-#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -83,6 +87,12 @@ void export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
   const auto writable_bools = std::vector<BoolAsByteType>(values.begin(), values.end());
   export_values(ofstream, writable_bools);
 }
+template <>
+void export_values(std::ofstream& ofstream, const pmr_vector<bool>& values) {
+  // Cast to fixed-size format used in binary file
+  const auto writable_bools = std::vector<BoolAsByteType>(values.begin(), values.end());
+  export_values(ofstream, writable_bools);
+}
 
 template <typename T>
 void export_values(std::ofstream& ofstream, const pmr_concurrent_vector<T>& values) {
@@ -112,6 +122,21 @@ template <typename T>
 void export_value(std::ofstream& ofstream, const T& value) {
   ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
+
+// Returns the width under which a compressed vector of the given type is stored
+AttributeVectorWidth attribute_vector_width(const CompressedVectorType type) {
+  switch (type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      return 4u;
+    case CompressedVectorType::FixedSize2ByteAligned:
+      return 2u;
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return 1u;
+    case CompressedVectorType::SimdBp128:
+      return SIMD_BP128_VECTOR_WIDTH;
+  }
+  Fail("Unknown CompressedVectorType");
+}
 }  // namespace
 
 namespace opossum {
@@ -147,6 +172,8 @@ std::shared_ptr<AbstractOperator> ExportBinary::_on_deep_copy(
 void ExportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
+  export_value(ofstream, BINARY_FORMAT_MAGIC_NUMBER);
+  export_value(ofstream, BINARY_FORMAT_VERSION);
   export_value(ofstream, static_cast<ChunkOffset>(table.max_chunk_size()));
   export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
   export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
@@ -247,53 +274,100 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
 
   Assert(base_segment.compressed_vector_type(),
          "Expected DictionarySegment to use vector compression for attribute vector");
-  Assert(is_fixed_size_byte_aligned(*base_segment.compressed_vector_type()),
-         "Does only support fixed-size byte-aligned compressed attribute vectors.");
-
-  export_value(context->ofstream, BinarySegmentType::dictionary_segment);
-
-  const auto attribute_vector_width = [&]() {
-    Assert(base_segment.compressed_vector_type(),
-           "Expected DictionarySegment to use vector compression for attribute vector");
-    switch (*base_segment.compressed_vector_type()) {
-      case CompressedVectorType::FixedSize4ByteAligned:
-        return 4u;
-      case CompressedVectorType::FixedSize2ByteAligned:
-        return 2u;
-      case CompressedVectorType::FixedSize1ByteAligned:
-        return 1u;
-      default:
-        return 0u;
-    }
-  }();
-
-  // Write attribute vector width
-  export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
+  const auto compressed_vector_type = *base_segment.compressed_vector_type();
 
   if (base_segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& segment = static_cast<const FixedStringDictionarySegment<pmr_string>&>(base_segment);
 
-    // Write the dictionary size and dictionary
+    export_value(context->ofstream, BinarySegmentType::fixed_string_dictionary_segment);
+    export_value(context->ofstream, attribute_vector_width(compressed_vector_type));
+
+    // Write the dictionary size, the length of the fixed strings, and the dictionary
     export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
+    export_value(context->ofstream, segment.fixed_string_dictionary()->string_length());
     export_values(context->ofstream, *segment.dictionary());
   } else {
     const auto& segment = static_cast<const DictionarySegment<T>&>(base_segment);
 
+    export_value(context->ofstream, BinarySegmentType::dictionary_segment);
+    export_value(context->ofstream, attribute_vector_width(compressed_vector_type));
+
     // Write the dictionary size and dictionary
     export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
     export_values(context->ofstream, *segment.dictionary());
   }
 
   // Write attribute vector
-  Assert(base_segment.compressed_vector_type(),
-         "Expected DictionarySegment to use vector compression for attribute vector");
-  _export_attribute_vector(context->ofstream, *base_segment.compressed_vector_type(), *base_segment.attribute_vector());
+  _export_attribute_vector(context->ofstream, compressed_vector_type, *base_segment.attribute_vector());
 }
 
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseEncodedSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
-  Fail("Binary export not implemented yet for encoded segments.");
+  auto context = std::static_pointer_cast<ExportContext>(base_context);
+
+  switch (base_segment.encoding_type()) {
+    case EncodingType::RunLength:
+      _export_run_length_segment(context->ofstream, static_cast<const RunLengthSegment<T>&>(base_segment));
+      return;
+    case EncodingType::FrameOfReference:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                hana::type_c<T>)) {
+        _export_frame_of_reference_segment(context->ofstream,
+                                           static_cast<const FrameOfReferenceSegment<T>&>(base_segment));
+        return;
+      }
+      Fail("FrameOfReference encoding does not support this data type");
+    case EncodingType::LZ4:
+      _export_lz4_segment(context->ofstream, static_cast<const LZ4Segment<T>&>(base_segment));
+      return;
+    default:
+      Fail("Binary export not implemented yet for encoding type " +
+           encoding_type_to_string.left.at(base_segment.encoding_type()));
+  }
+}
+
+template <typename T>
+void ExportBinary::ExportBinaryVisitor<T>::_export_run_length_segment(std::ofstream& ofstream,
+                                                                      const RunLengthSegment<T>& segment) {
+  export_value(ofstream, BinarySegmentType::run_length_segment);
+
+  export_value(ofstream, static_cast<ChunkOffset>(segment.values()->size()));
+  export_values(ofstream, *segment.values());
+  export_values(ofstream, *segment.null_values());
+  export_values(ofstream, *segment.end_positions());
+}
+
+template <typename T>
+template <typename FrameOfReferenceSegmentType>
+void ExportBinary::ExportBinaryVisitor<T>::_export_frame_of_reference_segment(
+    std::ofstream& ofstream, const FrameOfReferenceSegmentType& segment) {
+  export_value(ofstream, BinarySegmentType::frame_of_reference_segment);
+
+  export_value(ofstream, static_cast<ChunkOffset>(segment.block_minima().size()));
+  export_values(ofstream, segment.block_minima());
+  export_values(ofstream, segment.null_values());
+
+  const auto compressed_vector_type = *segment.compressed_vector_type();
+  export_value(ofstream, attribute_vector_width(compressed_vector_type));
+  _export_attribute_vector(ofstream, compressed_vector_type, segment.offset_values());
+}
+
+template <typename T>
+void ExportBinary::ExportBinaryVisitor<T>::_export_lz4_segment(std::ofstream& ofstream, const LZ4Segment<T>& segment) {
+  export_value(ofstream, BinarySegmentType::lz4_segment);
+
+  export_value(ofstream, segment.decompressed_size());
+  export_value(ofstream, segment.compressed_data().size());
+  export_values(ofstream, segment.compressed_data());
+  export_values(ofstream, segment.null_values());
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto offsets = segment.offsets();
+    Assert(offsets, "Expected LZ4Segment of strings to have offsets");
+    export_value(ofstream, offsets->size());
+    export_values(ofstream, *offsets);
+  }
 }
 
 template <typename T>
@@ -310,8 +384,12 @@ void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstrea
     case CompressedVectorType::FixedSize1ByteAligned:
       export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
       return;
-    default:
-      Fail("Any other type should have been caught before.");
+    case CompressedVectorType::SimdBp128: {
+      const auto& data = dynamic_cast<const SimdBp128Vector&>(attribute_vector).data();
+      export_value(ofstream, data.size());
+      export_values(ofstream, data);
+      return;
+    }
   }
 }
 
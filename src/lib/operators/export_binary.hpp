@@ -15,6 +15,10 @@ namespace opossum {
 
 class BaseCompressedVector;
 enum class CompressedVectorType : uint8_t;
+template <typename T>
+class LZ4Segment;
+template <typename T>
+class RunLengthSegment;
 
 /**
  * Note: ExportBinary does not support null values at the moment
@@ -51,6 +55,8 @@ class ExportBinary : public AbstractReadOnlyOperator {
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
+   * Magic number          | uint32_t (BINARY_FORMAT_MAGIC_NUMBER) |   4
+   * Format version        | uint32_t (BINARY_FORMAT_VERSION)      |   4
    * Chunk size            | ChunkOffset                           |   4
    * Chunk count           | ChunkID                               |   4
    * Column count          | ColumnID                              |   2
@@ -147,14 +153,16 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * Column Type           | ColumnType                            |   1
    * Width of attribute v. | AttributeVectorWidth                  |   1
    * Size of dictionary v. | ValueID                               |   4
+   * Fixed string length*  | size_t                                |   8
    * Dictionary Values°    | T (int, float, double, long)          |   dict. size * sizeof(T)
    * Dict. String Length^  | size_t                                |   dict. size * 2
    * Dictionary Values^    | std::string                           |   Sum of all string lengths
-   * Attribute v. values   | uintX                                 |   rows * width of attribute v.
+   * Attribute v. values   | see _export_attribute_vector          |
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
    *
+   * *: This field is only written for FixedStringDictionarySegments, which have their own column type.
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is written if the type of the column is NOT a string
    *
@@ -164,11 +172,63 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
   void handle_segment(const BaseDictionarySegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
+  /**
+   * Dispatches RunLength, FrameOfReference, and LZ4 segments to the functions below.
+   */
   void handle_segment(const BaseEncodedSegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
  private:
-  // Chooses the right FixedSizeByteAlignedVector depending on the attribute_vector_width and exports it.
+  /**
+   * Run Length Segments are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Run count             | ChunkOffset                           |   4
+   * Values                | T (strings as for value segments)     |   runs * sizeof(T)
+   * Null Values           | vector<bool> (BoolAsByteType)         |   runs * 1
+   * End Positions         | ChunkOffset                           |   runs * 4
+   */
+  static void _export_run_length_segment(std::ofstream& ofstream, const RunLengthSegment<T>& segment);
+
+  /**
+   * Frame of Reference Segments are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Block count           | ChunkOffset                           |   4
+   * Block minima          | T (int, long)                         |   blocks * sizeof(T)
+   * Null Values           | vector<bool> (BoolAsByteType)         |   rows * 1
+   * Width of offset v.    | AttributeVectorWidth                  |   1
+   * Offset v. values      | see _export_attribute_vector          |
+   */
+  template <typename FrameOfReferenceSegmentType>
+  static void _export_frame_of_reference_segment(std::ofstream& ofstream, const FrameOfReferenceSegmentType& segment);
+
+  /**
+   * LZ4 Segments are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Decompressed size     | size_t                                |   8
+   * Compressed size       | size_t                                |   8
+   * Compressed data       | char                                  |   compressed size
+   * Null Values           | vector<bool> (BoolAsByteType)         |   rows * 1
+   * Offset count^         | size_t                                |   8
+   * Offsets^              | size_t                                |   offset count * 8
+   *
+   * ^: These fields are only written if the type of the column IS a string.
+   */
+  static void _export_lz4_segment(std::ofstream& ofstream, const LZ4Segment<T>& segment);
+
+  /**
+   * Writes the values of a compressed vector. FixedSizeByteAlignedVectors are written as rows * width bytes.
+   * SimdBp128Vectors, for which SIMD_BP128_VECTOR_WIDTH is written as width, are stored as the number of 128-bit
+   * blocks (size_t) followed by the blocks.
+   */
   static void _export_attribute_vector(std::ofstream& ofstream, const CompressedVectorType type,
                                        const BaseCompressedVector& attribute_vector);
 };
@@ -3,6 +3,7 @@
 #include <boost/hana/for_each.hpp>
 
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <numeric>
@@ -15,9 +16,14 @@
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+#include "utils/mapped_file.hpp"
 
 namespace opossum {
 
@@ -27,48 +33,60 @@ ImportBinary::ImportBinary(const std::string& filename, const std::optional<std:
 const std::string ImportBinary::name() const { return "ImportBinary"; }
 
 std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-
-  Assert(file.is_open(), "ImportBinary: Could not open file " + filename);
-
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  const auto file = MappedFile{filename};
+  const auto content = file.content();
+  auto input = content;
 
   std::shared_ptr<Table> table;
   ChunkID chunk_count;
-  std::tie(table, chunk_count) = _read_header(file);
+  std::tie(table, chunk_count) = _read_header(input);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    _import_chunk(input, table);
+    file.release(content.size() - input.size());
   }
 
   return table;
 }
 
+bool ImportBinary::has_current_format(const std::string& filename) {
+  auto ifstream = std::ifstream{filename, std::ios::binary};
+
+  auto magic_number = uint32_t{0};
+  auto version = uint32_t{0};
+  ifstream.read(reinterpret_cast<char*>(&magic_number), sizeof(magic_number));
+  ifstream.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+  return ifstream && magic_number == BINARY_FORMAT_MAGIC_NUMBER && version == BINARY_FORMAT_VERSION;
+}
+
 template <typename T>
-pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> ImportBinary::_read_values(std::string_view& input, const size_t count) {
+  const auto byte_count = count * sizeof(T);
+  Assert(input.size() >= byte_count, "ImportBinary: Unexpected end of file");
+
   pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  std::memcpy(values.data(), input.data(), byte_count);
+  input.remove_prefix(byte_count);
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  return _read_string_values(file, count);
+pmr_vector<pmr_string> ImportBinary::_read_values(std::string_view& input, const size_t count) {
+  return _read_string_values(input, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
+pmr_vector<bool> ImportBinary::_read_values(std::string_view& input, const size_t count) {
+  const auto readable_bools = _read_values<BoolAsByteType>(input, count);
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
-pmr_vector<pmr_string> ImportBinary::_read_string_values(std::ifstream& file, const size_t count) {
-  const auto string_lengths = _read_values<size_t>(file, count);
+pmr_vector<pmr_string> ImportBinary::_read_string_values(std::string_view& input, const size_t count) {
+  const auto string_lengths = _read_values<size_t>(input, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+  const auto buffer = _read_values<char>(input, total_length);
 
   pmr_vector<pmr_string> values(count);
   size_t start = 0;
@@ -82,9 +100,12 @@ pmr_vector<pmr_string> ImportBinary::_read_string_values(std::ifstream& file, co
 }
 
 template <typename T>
-T ImportBinary::_read_value(std::ifstream& file) {
+T ImportBinary::_read_value(std::string_view& input) {
+  Assert(input.size() >= sizeof(T), "ImportBinary: Unexpected end of file");
+
   T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+  std::memcpy(&result, input.data(), sizeof(T));
+  input.remove_prefix(sizeof(T));
   return result;
 }
 
@@ -110,13 +131,21 @@ std::shared_ptr<AbstractOperator> ImportBinary::_on_deep_copy(
 
 void ImportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstream& file) {
-  const auto chunk_size = _read_value<ChunkOffset>(file);
-  const auto chunk_count = _read_value<ChunkID>(file);
-  const auto column_count = _read_value<ColumnID>(file);
-  const auto column_data_types = _read_values<pmr_string>(file, column_count);
-  const auto column_nullables = _read_values<bool>(file, column_count);
-  const auto column_names = _read_string_values(file, column_count);
+std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::string_view& input) {
+  Assert(input.size() >= 2 * sizeof(uint32_t), "ImportBinary: Not a binary table file");
+  const auto magic_number = _read_value<uint32_t>(input);
+  Assert(magic_number == BINARY_FORMAT_MAGIC_NUMBER, "ImportBinary: Not a binary table file");
+  const auto version = _read_value<uint32_t>(input);
+  Assert(version == BINARY_FORMAT_VERSION, "ImportBinary: The file was written in version " + std::to_string(version) +
+                                               " of the binary format, but version " +
+                                               std::to_string(BINARY_FORMAT_VERSION) + " is required. Re-export it.");
+
+  const auto chunk_size = _read_value<ChunkOffset>(input);
+  const auto chunk_count = _read_value<ChunkID>(input);
+  const auto column_count = _read_value<ColumnID>(input);
+  const auto column_data_types = _read_values<pmr_string>(input, column_count);
+  const auto column_nullables = _read_values<bool>(input, column_count);
+  const auto column_names = _read_string_values(input, column_count);
 
   TableColumnDefinitions output_column_definitions;
   for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
@@ -130,85 +159,161 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
-  const auto row_count = _read_value<ChunkOffset>(file);
+void ImportBinary::_import_chunk(std::string_view& input, std::shared_ptr<Table>& table) {
+  const auto row_count = _read_value<ChunkOffset>(input);
 
   Segments output_segments;
   for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
     output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_segment(input, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
   }
   table->append_chunk(output_segments);
 }
 
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::string_view& input, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
-    result = _import_segment<ColumnDataType>(file, row_count, is_nullable);
+    result = _import_segment<ColumnDataType>(input, row_count, is_nullable);
   });
 
   return result;
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::string_view& input, ChunkOffset row_count,
                                                            bool is_nullable) {
-  const auto column_type = _read_value<BinarySegmentType>(file);
+  const auto column_type = _read_value<BinarySegmentType>(input);
 
   switch (column_type) {
     case BinarySegmentType::value_segment:
-      return _import_value_segment<ColumnDataType>(file, row_count, is_nullable);
+      return _import_value_segment<ColumnDataType>(input, row_count, is_nullable);
     case BinarySegmentType::dictionary_segment:
-      return _import_dictionary_segment<ColumnDataType>(file, row_count);
+      return _import_dictionary_segment<ColumnDataType>(input, row_count);
+    case BinarySegmentType::fixed_string_dictionary_segment:
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+        return _import_fixed_string_dictionary_segment(input, row_count);
+      }
+      Fail("FixedStringDictionarySegments must contain strings");
+    case BinarySegmentType::run_length_segment:
+      return _import_run_length_segment<ColumnDataType>(input);
+    case BinarySegmentType::frame_of_reference_segment:
+      return _import_frame_of_reference_segment<ColumnDataType>(input, row_count);
+    case BinarySegmentType::lz4_segment:
+      return _import_lz4_segment<ColumnDataType>(input, row_count);
     default:
       // This case happens if the read column type is not a valid BinarySegmentType.
       Fail("Cannot import column: invalid column type");
   }
 }
 
-std::shared_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+std::unique_ptr<const BaseCompressedVector> ImportBinary::_import_attribute_vector(
+    std::string_view& input, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(input, row_count));
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(input, row_count));
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(input, row_count));
+    case SIMD_BP128_VECTOR_WIDTH: {
+      const auto block_count = _read_value<size_t>(input);
+      return std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(input, block_count), row_count);
+    }
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(std::string_view& input, ChunkOffset row_count,
                                                                      bool is_nullable) {
   // TODO(unknown): Ideally _read_values would directly write into a tbb::concurrent_vector so that no conversion is
   // needed
   if (is_nullable) {
-    const auto nullables = _read_values<bool>(file, row_count);
-    const auto values = _read_values<T>(file, row_count);
+    const auto nullables = _read_values<bool>(input, row_count);
+    const auto values = _read_values<T>(input, row_count);
     return std::make_shared<ValueSegment<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()},
                                              tbb::concurrent_vector<bool>{nullables.begin(), nullables.end()});
   } else {
-    const auto values = _read_values<T>(file, row_count);
+    const auto values = _read_values<T>(input, row_count);
     return std::make_shared<ValueSegment<T>>(tbb::concurrent_vector<T>{values.begin(), values.end()});
   }
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(std::string_view& input,
                                                                                ChunkOffset row_count) {
-  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
-  const auto dictionary_size = _read_value<ValueID>(file);
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(input);
+  const auto dictionary_size = _read_value<ValueID>(input);
   const auto null_value_id = dictionary_size;
-  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(input, dictionary_size));
+
+  auto attribute_vector = _import_attribute_vector(input, row_count, attribute_vector_width);
 
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  return std::make_shared<DictionarySegment<T>>(dictionary, std::move(attribute_vector), null_value_id);
+}
 
-  return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector, null_value_id);
+std::shared_ptr<FixedStringDictionarySegment<pmr_string>> ImportBinary::_import_fixed_string_dictionary_segment(
+    std::string_view& input, ChunkOffset row_count) {
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(input);
+  const auto dictionary_size = _read_value<ValueID>(input);
+  const auto null_value_id = dictionary_size;
+  const auto string_length = _read_value<size_t>(input);
+  const auto values = _read_string_values(input, dictionary_size);
+  auto dictionary =
+      std::make_shared<FixedStringVector>(values.cbegin(), values.cend(), string_length, values.size());
+
+  auto attribute_vector = _import_attribute_vector(input, row_count, attribute_vector_width);
+
+  return std::make_shared<FixedStringDictionarySegment<pmr_string>>(dictionary, std::move(attribute_vector),
+                                                                    null_value_id);
+}
+
+template <typename T>
+std::shared_ptr<RunLengthSegment<T>> ImportBinary::_import_run_length_segment(std::string_view& input) {
+  const auto run_count = _read_value<ChunkOffset>(input);
+  const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(input, run_count));
+  const auto null_values = std::make_shared<pmr_vector<bool>>(_read_values<bool>(input, run_count));
+  const auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(_read_values<ChunkOffset>(input, run_count));
+
+  return std::make_shared<RunLengthSegment<T>>(values, null_values, end_positions);
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> ImportBinary::_import_frame_of_reference_segment(std::string_view& input,
+                                                                              ChunkOffset row_count) {
+  if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::type_c<T>)) {
+    const auto block_count = _read_value<ChunkOffset>(input);
+    auto block_minima = _read_values<T>(input, block_count);
+    auto null_values = _read_values<bool>(input, row_count);
+
+    const auto offset_vector_width = _read_value<AttributeVectorWidth>(input);
+    auto offset_values = _import_attribute_vector(input, row_count, offset_vector_width);
+
+    return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
+                                                        std::move(offset_values));
+  } else {
+    Fail("FrameOfReference encoding does not support this data type");
+  }
+}
+
+template <typename T>
+std::shared_ptr<LZ4Segment<T>> ImportBinary::_import_lz4_segment(std::string_view& input, ChunkOffset row_count) {
+  const auto decompressed_size = _read_value<size_t>(input);
+  const auto compressed_size = _read_value<size_t>(input);
+  auto compressed_data = _read_values<char>(input, compressed_size);
+  auto null_values = _read_values<bool>(input, row_count);
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    const auto offset_count = _read_value<size_t>(input);
+    auto offsets = _read_values<size_t>(input, offset_count);
+    return std::make_shared<LZ4Segment<T>>(std::move(compressed_data), std::move(null_values), std::move(offsets),
+                                           decompressed_size);
+  } else {
+    return std::make_shared<LZ4Segment<T>>(std::move(compressed_data), std::move(null_values), decompressed_size);
+  }
 }
 
 }  // namespace opossum
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -11,6 +11,9 @@
 #include "import_export/binary.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -20,14 +23,27 @@ namespace opossum {
  * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
  * already exists, it is returned and no import is performed.
  *
+ * The file is memory-mapped and read front to back. Pages of chunks that have been imported are handed back to the
+ * operating system, so that the file is never held in memory in addition to the imported table.
+ *
+ * The import is not zero-copy: the segments own their data (in pmr_vectors or, for ValueSegments, in
+ * tbb::concurrent_vectors), whose allocators initialize the elements they allocate. Segments therefore cannot be backed
+ * by the mapping, and each vector is copied out of it with a single memcpy. For the same reason, the payloads in the
+ * file are not padded to page or alignment boundaries.
+ *
  * Note: ImportBinary does not support null values at the moment
  */
 class ImportBinary : public AbstractReadOnlyOperator {
  public:
   explicit ImportBinary(const std::string& filename, const std::optional<std::string>& tablename = std::nullopt);
 
+  // Fails if the file was not written by ExportBinary or was written in a different version of the format
   static std::shared_ptr<Table> read_binary(const std::string& filename);
 
+  // Whether the file begins with the magic number and the version of the current format, i.e., whether read_binary()
+  // can read it. Used to detect outdated files, e.g., cached tables.
+  static bool has_current_format(const std::string& filename);
+
   /*
    * Reads the given binary file. The file must be in the following form:
    *
@@ -58,6 +74,8 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
+   * Magic number          | uint32_t (BINARY_FORMAT_MAGIC_NUMBER) |   4
+   * Format version        | uint32_t (BINARY_FORMAT_VERSION)      |   4
    * Chunk size            | ChunkOffset                           |   4
    * Chunk count           | ChunkID                               |   4
    * Column count          | ColumnID                              |   2
@@ -67,7 +85,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::string_view& input);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -81,15 +99,16 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static void _import_chunk(std::string_view& input, std::shared_ptr<Table>& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
-                                                      bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(std::string_view& input, ChunkOffset row_count,
+                                                      DataType data_type, bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(std::string_view& input, ChunkOffset row_count,
+                                                      bool is_nullable);
 
   /*
    * Imports a serialized ValueSegment from the given file.
@@ -117,7 +136,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    */
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::string_view& input, ChunkOffset row_count,
                                                                 bool is_nullable);
 
   /*
@@ -137,22 +156,42 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * °: This field is needed if the type of the column is NOT a string
    */
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::string_view& input,
+                                                                         ChunkOffset row_count);
+
+  /*
+   * Imports the segments written by the respective ExportBinary::ExportBinaryVisitor functions. See there for the
+   * layouts.
+   */
+  static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
+      std::string_view& input, ChunkOffset row_count);
+
+  template <typename T>
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::string_view& input);
+
+  template <typename T>
+  static std::shared_ptr<BaseSegment> _import_frame_of_reference_segment(std::string_view& input,
+                                                                         ChunkOffset row_count);
+
+  template <typename T>
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::string_view& input, ChunkOffset row_count);
 
-  // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
-                                                                        AttributeVectorWidth attribute_vector_width);
+  // Imports the compressed vector (FixedSizeByteAlignedVector<uintX_t> or SimdBp128Vector) that corresponds to the
+  // given attribute_vector_width.
+  static std::unique_ptr<const BaseCompressedVector> _import_attribute_vector(
+      std::string_view& input, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
 
-  // Reads row_count many values from type T and returns them in a vector
+  // Reads row_count many values from type T and returns them in a vector. Values are copied from the mapped file in
+  // one piece.
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(std::string_view& input, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(std::string_view& input, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(std::string_view& input);
 
  private:
   // Name of the import file
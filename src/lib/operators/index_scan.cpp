@@ -1,21 +1,62 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index/base_table_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<AllTypeVariant> resolve_values(const std::vector<AllParameterVariant>& values) {
+  auto resolved_values = std::vector<AllTypeVariant>{};
+  resolved_values.reserve(values.size());
+  for (const auto& value : values) {
+    Assert(is_variant(value), "IndexScan: Expected a value. Parameters have to be set before the scan is executed.");
+    resolved_values.emplace_back(boost::get<AllTypeVariant>(value));
+  }
+  return resolved_values;
+}
+
+void set_parameters_in_values(std::vector<AllParameterVariant>& values,
+                              const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  for (auto& value : values) {
+    if (!is_parameter_id(value)) continue;
+
+    const auto parameter_iter = parameters.find(boost::get<ParameterID>(value));
+    if (parameter_iter != parameters.end()) value = parameter_iter->second;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
                      const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
                      const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2)
+    : IndexScan{in,
+                index_type,
+                left_column_ids,
+                predicate_condition,
+                std::vector<AllParameterVariant>(right_values.begin(), right_values.end()),
+                std::vector<AllParameterVariant>(right_values2.begin(), right_values2.end())} {}
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
+                     const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
+                     const std::vector<AllParameterVariant>& right_values,
+                     const std::vector<AllParameterVariant>& right_values2)
     : AbstractReadOnlyOperator{OperatorType::IndexScan, in},
       _index_type{index_type},
       _left_column_ids{left_column_ids},
@@ -32,8 +73,18 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _validate_input();
 
+  _search_values = resolve_values(_right_values);
+  _search_values2 = resolve_values(_right_values2);
+
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_left_column_ids.size() == 1) {
+    if (const auto table_index = _in_table->get_table_index(_left_column_ids.front())) {
+      _scan_table_index(*table_index);
+      return _out_table;
+    }
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -61,7 +112,10 @@ std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
                                      _right_values, _right_values2);
 }
 
-void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  set_parameters_in_values(_right_values, parameters);
+  set_parameters_in_values(_right_values2, parameters);
+}
 
 std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
   auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
@@ -84,6 +138,33 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
   return job_task;
 }
 
+void IndexScan::_scan_table_index(const BaseTableIndex& table_index) {
+  const auto value2 = _search_values2.empty() ? std::nullopt : std::optional<AllTypeVariant>{_search_values2.front()};
+
+  auto matches_out = std::make_shared<PosList>();
+  table_index.append_matches(_predicate_condition, _search_values.front(), value2, *matches_out);
+
+  if (!_included_chunk_ids.empty()) {
+    auto chunk_is_included = std::vector<bool>(_in_table->chunk_count(), false);
+    for (const auto chunk_id : _included_chunk_ids) {
+      chunk_is_included[chunk_id] = true;
+    }
+
+    // Rows might have been appended to new chunks since chunk_is_included was sized
+    const auto new_end = std::remove_if(matches_out->begin(), matches_out->end(), [&](const auto& row_id) {
+      return static_cast<size_t>(row_id.chunk_id) >= chunk_is_included.size() ||
+             !chunk_is_included[row_id.chunk_id];
+    });
+    matches_out->erase(new_end, matches_out->end());
+  }
+
+  Segments segments;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(segments);
+}
+
 void IndexScan::_validate_input() {
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
@@ -112,46 +193,46 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
 
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
+      range_begin = index->lower_bound(_search_values);
+      range_end = index->upper_bound(_search_values);
       break;
     }
     case PredicateCondition::NotEquals: {
       // first, get all values less than the search value
       range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      range_end = index->lower_bound(_search_values);
 
       matches_out.reserve(std::distance(range_begin, range_end));
       std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
 
       // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
+      range_begin = index->upper_bound(_search_values);
       range_end = index->cend();
       break;
     }
     case PredicateCondition::LessThan: {
       range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      range_end = index->lower_bound(_search_values);
       break;
     }
     case PredicateCondition::LessThanEquals: {
       range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
+      range_end = index->upper_bound(_search_values);
       break;
     }
     case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
+      range_begin = index->upper_bound(_search_values);
       range_end = index->cend();
       break;
     }
     case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
+      range_begin = index->lower_bound(_search_values);
       range_end = index->cend();
       break;
     }
     case PredicateCondition::Between: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
+      range_begin = index->lower_bound(_search_values);
+      range_end = index->upper_bound(_search_values2);
       break;
     }
     default:
@@ -4,6 +4,7 @@
 
 #include "abstract_read_only_operator.hpp"
 
+#include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
 #include "storage/index/segment_index_type.hpp"
 #include "storage/pos_list.hpp"
@@ -11,12 +12,20 @@
 
 namespace opossum {
 
-class Table;
 class AbstractTask;
+class BaseTableIndex;
+class Table;
 
 /**
  * Operator that performs a predicate search using indices
  *
+ * If the input table has a table index (see BaseTableIndex) on the single scanned column, the whole table, including
+ * its mutable chunks, is searched with a single lookup. Otherwise, the chunk indexes of the given type are probed
+ * chunk by chunk.
+ *
+ * The right values may be parameters (e.g., the literals of cached plans), which are resolved by set_parameters()
+ * before the scan is executed.
+ *
  * Note: Scans only the set of chunks passed to the constructor
  */
 class IndexScan : public AbstractReadOnlyOperator {
@@ -27,6 +36,11 @@ class IndexScan : public AbstractReadOnlyOperator {
             const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
             const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2 = {});
 
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
+            const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
+            const std::vector<AllParameterVariant>& right_values,
+            const std::vector<AllParameterVariant>& right_values2 = {});
+
   const std::string name() const final;
 
   /**
@@ -47,13 +61,19 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_table_index(const BaseTableIndex& table_index);
 
  private:
   const SegmentIndexType _index_type;
   const std::vector<ColumnID> _left_column_ids;
   const PredicateCondition _predicate_condition;
-  const std::vector<AllTypeVariant> _right_values;
-  const std::vector<AllTypeVariant> _right_values2;
+  // Values or, until set_parameters() is called, ParameterIDs
+  std::vector<AllParameterVariant> _right_values;
+  std::vector<AllParameterVariant> _right_values2;
+
+  // The values that are searched for, resolved from _right_values and _right_values2 when the scan is executed
+  std::vector<AllTypeVariant> _search_values;
+  std::vector<AllTypeVariant> _search_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
 
@@ -8,6 +8,8 @@
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/constraints/unique_constraint_index.hpp"
+#include "storage/index/table_index/base_table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
 #include "type_cast.hpp"
@@ -214,6 +216,21 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     start_index = 0u;
   }
 
+  // Check the unique constraints. On a violation, the transaction has to be rolled back, which also removes the rows
+  // from the constraint indexes again.
+  for (const auto& constraint_index : _target_table->unique_constraint_indexes()) {
+    if (!constraint_index->insert(*_target_table, _inserted_rows, context->transaction_id())) {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+
+  // Add the new rows to the table indexes. Until the transaction commits, the rows are invisible to others, so
+  // readers of the index filter them out during validation.
+  for (const auto& table_index : _target_table->table_indexes()) {
+    table_index->insert(*_target_table, _inserted_rows);
+  }
+
   return nullptr;
 }
 
@@ -225,6 +242,8 @@ void Insert::_on_commit_records(const CommitID cid) {
     mvcc_data->begin_cids[row_id.chunk_offset] = cid;
     mvcc_data->tids[row_id.chunk_offset] = 0u;
   }
+
+  _target_table->register_commit(cid);
 }
 
 void Insert::_on_rollback_records() {
@@ -238,6 +257,14 @@ void Insert::_on_rollback_records() {
 
     chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
   }
+
+  // Rolled-back rows can never become visible, so there is no need to keep them indexed
+  for (const auto& constraint_index : _target_table->unique_constraint_indexes()) {
+    constraint_index->erase(*_target_table, _inserted_rows);
+  }
+  for (const auto& table_index : _target_table->table_indexes()) {
+    table_index->erase(*_target_table, _inserted_rows);
+  }
 }
 
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
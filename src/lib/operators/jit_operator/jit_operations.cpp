@@ -129,18 +129,18 @@ std::optional<bool> jit_or(const JitExpression& left_side, const JitExpression&
   }
 }
 
-// TODO(anyone) State Machine is currently build for every comparison. It should be build only once.
+// TODO(anyone) The LikeMatcher is currently built for every comparison. It should be built only once.
 bool jit_like(const pmr_string& a, const pmr_string& b) {
-  const auto regex_string = LikeMatcher::sql_like_to_regex(b);
-  const auto regex = std::regex{regex_string};
-  return std::regex_match(a, regex);
+  auto result = false;
+  LikeMatcher{b}.resolve(false, [&](const auto& matcher) { result = matcher(a); });
+  return result;
 }
 
-// TODO(anyone) State Machine is currently build for every comparison. It should be build only once.
+// TODO(anyone) The LikeMatcher is currently built for every comparison. It should be built only once.
 bool jit_not_like(const pmr_string& a, const pmr_string& b) {
-  const auto regex_string = LikeMatcher::sql_like_to_regex(b);
-  const auto regex = std::regex{regex_string};
-  return !std::regex_match(a, regex);
+  auto result = false;
+  LikeMatcher{b}.resolve(true, [&](const auto& matcher) { result = matcher(a); });
+  return result;
 }
 
 std::optional<bool> jit_is_null(const JitExpression& left_side, JitRuntimeContext& context) {
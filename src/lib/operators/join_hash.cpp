@@ -1,5 +1,6 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <numeric>
@@ -15,9 +16,12 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/estimate_operator_statistics.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
+#include "utils/hardware_info.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
@@ -26,7 +30,8 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                    const std::optional<size_t>& radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition,
+                           std::make_unique<JoinHash::PerformanceData>()),
       _radix_bits(radix_bits) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
@@ -102,6 +107,13 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     } else {
       _radix_bits = _calculate_radix_bits();
     }
+    if (join_hash._second_pass_radix_bits) {
+      Assert(*join_hash._second_pass_radix_bits < _radix_bits, "The first pass needs at least one radix bit");
+      _second_pass_radix_bits = *join_hash._second_pass_radix_bits;
+    } else {
+      _second_pass_radix_bits = _calculate_second_pass_radix_bits();
+    }
+    _first_pass_radix_bits = _radix_bits - _second_pass_radix_bits;
   }
 
  protected:
@@ -114,7 +126,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
   std::shared_ptr<Table> _output_table;
 
+  // The partitions are determined by the lowest _radix_bits bits of the hash. If the fan-out is too large for a single
+  // pass, the first pass partitions by the lowest _first_pass_radix_bits bits and the second by the remaining bits.
   size_t _radix_bits;
+  size_t _first_pass_radix_bits;
+  size_t _second_pass_radix_bits;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
@@ -122,15 +138,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   size_t _calculate_radix_bits() const {
     /*
       Setting number of bits for radix clustering:
-      The number of bits is used to create probe partitions with a size that can
-      be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
-      We estimate the size the following way:
-        - we assume each key appears once (that is an overestimation space-wise, but we
-        aim rather for a hash map that is slightly smaller than L2 than slightly larger)
-        - each entry in the hash map is a data structure holding the actual value
-        and the RowID
+      The number of bits is used to create partitions whose hash tables can be expected to fit into the L2 cache, whose
+      size is detected at runtime (see HardwareInfo).
+      We estimate the size of the hash table of the build relation the following way:
+        - each distinct value has one entry in the hash map, holding the value and a PosList with space for one RowID
+        - each further occurrence of a value adds a RowID to the PosList of the value
+      The distinct count is estimated by the optimizer's statistics. If there are none, we assume that each value
+      appears once (that is an overestimation space-wise, but we aim rather for a hash map that is slightly smaller
+      than L2 than slightly larger).
     */
     const auto build_relation_size = _left->get_output()->row_count();
     const auto probe_relation_size = _right->get_output()->row_count();
@@ -146,26 +161,55 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    const auto l2_cache_size = static_cast<double>(HardwareInfo::get().l2_cache_size());
 
-    // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
-    // that each value maps to a PosList with a single RowID. For the used small_vector's, we assume a
-    // size of 2*RowID per PosList. For sizing, see comments:
+    // For the sizes of the hash map's entries, see comments:
     // https://probablydance.com/2018/05/28/a-new-fast-hash-table-in-response-to-googles-new-fast-hash-table/
-    const auto complete_hash_map_size =
-        // number of items in map
-        (build_relation_size *
-         // key + value (and one byte overhead, see link above)
-         (sizeof(LeftType) + 2 * sizeof(RowID) + 1))
-        // fill factor
-        / 0.8;
+    const auto hash_map_size = [&](const double distinct_count) {
+      return
+          // key + value (and one byte overhead, see link above), divided by the fill factor
+          distinct_count * (sizeof(LeftType) + sizeof(SmallPosList) + 1) / 0.8 +
+          // the further RowIDs are stored on the heap, which grows by doubling the capacity
+          (static_cast<double>(build_relation_size) - distinct_count) * 2 * sizeof(RowID);
+    };
+
+    const auto adaption_factor = 2.0;  // don't occupy the whole L2 cache
+
+    // Deriving the statistics walks the entire LQP below the build relation. Thus, we only do so if the build relation
+    // would be partitioned without them.
+    auto distinct_count = static_cast<double>(build_relation_size);
+    if (adaption_factor * hash_map_size(distinct_count) > l2_cache_size) {
+      if (const auto estimated_distinct_count = estimate_distinct_count(*_left, _column_ids.first)) {
+        distinct_count = std::clamp(static_cast<double>(*estimated_distinct_count), 1.0, distinct_count);
+      }
+    }
 
-    const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+    const auto cluster_count = std::max(1.0, (adaption_factor * hash_map_size(distinct_count)) / l2_cache_size);
 
     return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
   }
 
+  size_t _calculate_second_pass_radix_bits() const {
+    /*
+      In a single partitioning pass, each of the 2^radix_bits partitions is written at a different position of the
+      output. If the pages of these positions do not fit into the TLB, most writes cause a TLB miss. In this case, we
+      partition in two passes, each of which uses half of the radix bits (see Manegold et al., "Optimizing Main-Memory
+      Join on Modern Hardware"). If the output spans fewer pages than the TLB holds (e.g., because it is backed by huge
+      pages), neighboring partitions share pages and a single pass suffices.
+    */
+    if (_radix_bits < 2) return 0;
+
+    const auto& hardware_info = HardwareInfo::get();
+    const auto row_count = std::max(_left->get_output()->row_count(), _right->get_output()->row_count());
+    const auto element_size = std::max(sizeof(PartitionedElement<LeftType>), sizeof(PartitionedElement<RightType>));
+    const auto page_count = row_count * element_size / hardware_info.page_size() + 1;
+
+    const auto written_page_count = std::min(size_t{1} << _radix_bits, page_count);
+    if (written_page_count <= hardware_info.tlb_entries()) return 0;
+
+    return _radix_bits / 2;
+  }
+
   std::shared_ptr<const Table> _on_execute() override {
     auto right_in_table = _right->get_output();
     auto left_in_table = _left->get_output();
@@ -184,7 +228,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
     const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
 
-    Timer performance_timer;
+    // The steps of the left and the right relation run concurrently, so their durations are summed
+    auto& performance_data = static_cast<PerformanceData&>(*_join_hash._performance_data);
+    performance_data.radix_bits = _radix_bits;
+    performance_data.radix_passes = _radix_bits == 0 ? 0 : (_second_pass_radix_bits > 0 ? 2 : 1);
+    auto materialization_left = std::chrono::nanoseconds{0};
+    auto materialization_right = std::chrono::nanoseconds{0};
+    auto partitioning_left = std::chrono::nanoseconds{0};
+    auto partitioning_right = std::chrono::nanoseconds{0};
 
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
@@ -222,59 +273,124 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //                         \_                   _/
     //                           \                 /
     //                          Probing (actual Join)
+    //
+    // If probe-side chunks can be pruned dynamically (see below), materialize_input() of the right relation starts only
+    // after materialize_input() of the left relation has finished.
 
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    /*
+     * Dynamic chunk pruning: For inner and semi joins, probe-side rows without a join partner are discarded. Once the
+     * build side is materialized, the range of its join keys is known, and probe-side chunks whose ChunkStatistics
+     * show that they do not overlap with that range need not be materialized at all. As the probe side then has to
+     * wait for the build side's materialization, we only do this if the probe side has statistics to prune with.
+     */
+    const auto prune_probe_chunks = (_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+                                    std::is_same_v<LeftType, RightType> &&
+                                    has_segment_statistics(*right_in_table, _column_ids.second);
+    auto probe_chunks_to_skip = std::vector<bool>{};
+
+    // If the query is cancelled, the remaining steps are skipped. As the cancellation cannot be undone, a step never
+    // sees the incomplete result of a skipped previous step.
 
     // Pre-Probing path of left relation
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    auto materialize_left_job = std::make_shared<JobTask>([&]() {
+      Timer timer;
+
       // materialize left table (NULLs are always discarded for the build side)
       materialized_left = materialize_input<LeftType, HashedType, false>(left_in_table, _column_ids.first,
-                                                                         histograms_left, _radix_bits);
+                                                                         histograms_left, _first_pass_radix_bits);
+      if (AbstractTask::is_current_task_cancelled()) return;
+
+      if constexpr (std::is_same_v<LeftType, RightType>) {
+        if (prune_probe_chunks) {
+          probe_chunks_to_skip = determine_prunable_chunks(right_in_table, _column_ids.second,
+                                                           determine_value_range(materialized_left));
+        }
+      }
+
+      materialization_left = timer.lap();
+    });
+
+    auto build_left_job = std::make_shared<JobTask>([&]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
+      Timer timer;
 
       if (_radix_bits > 0) {
         // radix partition the left table
         radix_left = partition_radix_parallel<LeftType, HashedType, false>(materialized_left, left_chunk_offsets,
-                                                                           histograms_left, _radix_bits);
+                                                                           histograms_left, _first_pass_radix_bits);
+        if (_second_pass_radix_bits > 0) {
+          radix_left = partition_radix_second_pass<LeftType, HashedType, false>(radix_left, _first_pass_radix_bits,
+                                                                                _second_pass_radix_bits);
+        }
       } else {
         // short cut: skip radix partitioning and use materialized data directly
         radix_left = std::move(materialized_left);
       }
+      partitioning_left = timer.lap();
+      if (AbstractTask::is_current_task_cancelled()) return;
 
       // build hash tables
       hashtables = build<LeftType, HashedType>(radix_left);
-    }));
-    jobs.back()->schedule();
+      performance_data.build = timer.lap();
+    });
+
+    auto right_job = std::make_shared<JobTask>([&]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
+      Timer timer;
 
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
       // Materialize right table. The third template parameter signals if the relation on the right (probe
       // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
       if (keep_nulls) {
         materialized_right = materialize_input<RightType, HashedType, true>(right_in_table, _column_ids.second,
-                                                                            histograms_right, _radix_bits);
+                                                                            histograms_right, _first_pass_radix_bits);
       } else {
-        materialized_right = materialize_input<RightType, HashedType, false>(right_in_table, _column_ids.second,
-                                                                             histograms_right, _radix_bits);
+        materialized_right = materialize_input<RightType, HashedType, false>(
+            right_in_table, _column_ids.second, histograms_right, _first_pass_radix_bits, probe_chunks_to_skip);
       }
+      materialization_right = timer.lap();
+      if (AbstractTask::is_current_task_cancelled()) return;
 
       if (_radix_bits > 0) {
         // radix partition the right table. 'keep_nulls' makes sure that the
         // relation on the right keeps NULL values when executing an OUTER join.
         if (keep_nulls) {
-          radix_right = partition_radix_parallel<RightType, HashedType, true>(materialized_right, right_chunk_offsets,
-                                                                              histograms_right, _radix_bits);
+          radix_right = partition_radix_parallel<RightType, HashedType, true>(
+              materialized_right, right_chunk_offsets, histograms_right, _first_pass_radix_bits);
+          if (_second_pass_radix_bits > 0) {
+            radix_right = partition_radix_second_pass<RightType, HashedType, true>(radix_right, _first_pass_radix_bits,
+                                                                                   _second_pass_radix_bits);
+          }
         } else {
-          radix_right = partition_radix_parallel<RightType, HashedType, false>(materialized_right, right_chunk_offsets,
-                                                                               histograms_right, _radix_bits);
+          radix_right = partition_radix_parallel<RightType, HashedType, false>(
+              materialized_right, right_chunk_offsets, histograms_right, _first_pass_radix_bits);
+          if (_second_pass_radix_bits > 0) {
+            radix_right = partition_radix_second_pass<RightType, HashedType, false>(
+                radix_right, _first_pass_radix_bits, _second_pass_radix_bits);
+          }
         }
       } else {
         // short cut: skip radix partitioning and use materialized data directly
         radix_right = std::move(materialized_right);
       }
-    }));
-    jobs.back()->schedule();
+      partitioning_right = timer.lap();
+    });
+
+    materialize_left_job->set_as_predecessor_of(build_left_job);
+    if (prune_probe_chunks) materialize_left_job->set_as_predecessor_of(right_job);
+
+    const auto jobs = std::vector<std::shared_ptr<AbstractTask>>{materialize_left_job, build_left_job, right_job};
+    CurrentScheduler::schedule_tasks(jobs);
 
     CurrentScheduler::wait_for_tasks(jobs);
 
+    performance_data.materialization = materialization_left + materialization_right;
+    performance_data.partitioning = partitioning_left + partitioning_right;
+    if (AbstractTask::is_current_task_cancelled()) return _output_table;
+
+    Timer performance_timer;
+
     // Probe phase
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
@@ -302,6 +418,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
       }
     }
+    performance_data.probe = performance_timer.lap();
+    if (AbstractTask::is_current_task_cancelled()) return _output_table;
 
     auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
 
@@ -357,9 +475,20 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
       _output_table->append_chunk(output_segments);
     }
+    performance_data.output_writing = performance_timer.lap();
 
     return _output_table;
   }
 };
 
+std::string JoinHash::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += "materialization " + format_duration(materialization) + ", partitioning " +
+            format_duration(partitioning) + " (" + std::to_string(radix_bits) + " radix bits in " +
+            std::to_string(radix_passes) + " passes), build " + format_duration(build) + ", probe " +
+            format_duration(probe) + ", output writing " + format_duration(output_writing);
+  return string;
+}
+
 }  // namespace opossum
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <string>
+
 #include "abstract_join_operator.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -24,6 +28,21 @@ class JoinHash : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  // Durations of the steps of the join. The materialization and the partitioning of both relations run concurrently
+  // and are summed. Also records the number of radix bits and of the partitioning passes that they are split into.
+  struct PerformanceData : public OperatorPerformanceData {
+    size_t radix_bits{0};
+    size_t radix_passes{0};
+
+    std::chrono::nanoseconds materialization{0};
+    std::chrono::nanoseconds partitioning{0};
+    std::chrono::nanoseconds build{0};
+    std::chrono::nanoseconds probe{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -35,6 +54,12 @@ class JoinHash : public AbstractJoinOperator {
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   const std::optional<size_t> _radix_bits;
 
+  // Overrides the number of radix bits of the second partitioning pass, which is otherwise chosen from the TLB size.
+  // Used by tests to partition inputs in two passes that are far too small to require it.
+  std::optional<size_t> _second_pass_radix_bits;
+
+  friend class JoinHashTest;
+
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
   template <typename LeftType, typename RightType>
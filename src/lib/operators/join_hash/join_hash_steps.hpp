@@ -8,11 +8,14 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/chunk_pruning_utils.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/numa_placement_manager.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "uninitialized_vector.hpp"
+#include "utils/radix_partition_writer.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -86,9 +89,19 @@ inline std::vector<size_t> determine_chunk_offsets(std::shared_ptr<const Table>
   return chunk_offsets;
 }
 
+/*
+Materializes the join column of in_table. Chunks flagged in chunks_to_skip (see determine_prunable_chunks()) are not
+read at all, their slots in the output remain unused. Because these slots are later treated like discarded NULL values,
+chunks may only be skipped if consider_null_values is false.
+*/
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    const std::vector<bool>& chunks_to_skip = {}) {
+  DebugAssert(chunks_to_skip.empty() || !consider_null_values, "Chunks can only be skipped if NULLs are discarded");
+  DebugAssert(chunks_to_skip.empty() || chunks_to_skip.size() == static_cast<size_t>(in_table->chunk_count()),
+              "Expected one flag per chunk");
+
   const std::hash<HashedType> hash_function;
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
@@ -101,7 +114,7 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
+  // This is the first pass, which partitions by the lowest radix bits (see partition_radix_second_pass())
   size_t pass = 0;
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
@@ -125,7 +138,15 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   jobs.reserve(in_table->chunk_count());
 
   for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+    const auto home_node_id = NUMAPlacementManager::home_node_id(*in_table, chunk_id);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, home_node_id]() {
+      // The jobs of a cancelled query are skipped. The caller has to check for the cancellation before it uses the
+      // (incomplete) result.
+      if (AbstractTask::is_current_task_cancelled()) return;
+
+      NUMAPlacementManager::get().record_access(home_node_id);
+
       // Get information from work queue
       auto output_offset = chunk_offsets[chunk_id];
       auto output_iterator = elements->begin() + output_offset;
@@ -141,44 +162,48 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       auto reference_chunk_offset = ChunkOffset{0};
 
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
-        using IterableType = typename decltype(it)::IterableType;
-
-        while (it != end) {
-          const auto& value = *it;
-          ++it;
+      // For skipped chunks, all slots remain unused and are filled up below
+      const auto skip_chunk = !chunks_to_skip.empty() && chunks_to_skip[chunk_id];
+      if (!skip_chunk) {
+        segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+          using IterableType = typename decltype(it)::IterableType;
+
+          while (it != end) {
+            const auto& value = *it;
+            ++it;
+
+            if (!value.is_null() || consider_null_values) {
+              const Hash hashed_value = hash_function(type_cast<HashedType>(value.value()));
+
+              /*
+              For ReferenceSegments we do not use the RowIDs from the referenced tables.
+              Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+              values from different inputs (important for Multi Joins).
+              */
+              if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
+                *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+              } else {
+                *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+              }
 
-          if (!value.is_null() || consider_null_values) {
-            const Hash hashed_value = hash_function(type_cast<HashedType>(value.value()));
+              // In case we care about NULL values, store the NULL flag
+              if constexpr (consider_null_values) {
+                if (value.is_null()) {
+                  *null_value_bitvector_iterator = true;
+                }
+              }
 
-            /*
-            For ReferenceSegments we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
-            if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-            } else {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+              const Hash radix = hashed_value & mask;
+              ++histogram[radix];
+              ++null_value_bitvector_iterator;
             }
-
-            // In case we care about NULL values, store the NULL flag
-            if constexpr (consider_null_values) {
-              if (value.is_null()) {
-                *null_value_bitvector_iterator = true;
-              }
+            // reference_chunk_offset is only used for ReferenceSegments
+            if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
+              ++reference_chunk_offset;
             }
-
-            const Hash radix = hashed_value & mask;
-            ++histogram[radix];
-            ++null_value_bitvector_iterator;
-          }
-          // reference_chunk_offset is only used for ReferenceSegments
-          if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
-            ++reference_chunk_offset;
           }
-        }
-      });
+        });
+      }
 
       if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
         // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
@@ -190,13 +215,65 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
 
       histograms[chunk_id] = std::move(histogram);
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(home_node_id);
   }
   CurrentScheduler::wait_for_tasks(jobs);
 
   return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector};
 }
 
+/*
+Dynamic chunk pruning: Once one input of an inner or semi join is materialized, the range of its join keys is known.
+Chunks of the other input whose ChunkStatistics show that they do not contain any value within that range cannot find
+a join partner and need not be materialized. determine_value_range() returns std::nullopt if the materialized input does
+not hold any (non-NULL) value.
+*/
+template <typename T>
+std::optional<std::pair<T, T>> determine_value_range(const RadixContainer<T>& radix_container) {
+  auto range = std::optional<std::pair<T, T>>{};
+
+  for (const auto& element : *radix_container.elements) {
+    // Skip NULL values and unused slots
+    if (element.row_id == NULL_ROW_ID) continue;
+
+    if (!range) {
+      range.emplace(element.value, element.value);
+    } else if (element.value < range->first) {
+      range->first = element.value;
+    } else if (element.value > range->second) {
+      range->second = element.value;
+    }
+  }
+
+  return range;
+}
+
+// Returns true if at least one chunk of the join column has statistics that can be used for determine_prunable_chunks()
+inline bool has_segment_statistics(const Table& table, const ColumnID column_id) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    if (resolve_segment_statistics(table, chunk_id, column_id)) return true;
+  }
+  return false;
+}
+
+// Flags all chunks that cannot contain a value within value_range. If value_range is empty, all chunks are flagged.
+template <typename T>
+std::vector<bool> determine_prunable_chunks(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                            const std::optional<std::pair<T, T>>& value_range) {
+  if (!value_range) return std::vector<bool>(in_table->chunk_count(), true);
+
+  auto prunable_chunks = std::vector<bool>(in_table->chunk_count());
+  const auto min = AllTypeVariant{value_range->first};
+  const auto max = AllTypeVariant{value_range->second};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    prunable_chunks[chunk_id] =
+        chunk_can_be_pruned(*in_table, chunk_id, column_id, PredicateCondition::Between, min, max);
+  }
+
+  return prunable_chunks;
+}
+
 /*
 Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
 */
@@ -226,6 +303,8 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
 
     jobs.emplace_back(std::make_shared<JobTask>([&, partition_left_begin, partition_left_end, current_partition_id,
                                                  partition_size]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
       auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
 
       // slightly oversize the hash table to avoid unnecessary rebuilds
@@ -277,7 +356,7 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
-  // currently, we just do one pass
+  // This is the first pass, which partitions by the lowest radix bits (see partition_radix_second_pass())
   size_t pass = 0;
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
@@ -306,13 +385,19 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
     radix_output.partition_offsets[partition_id] = offset;
   }
 
+  // At a high fan-out, the elements are scattered using software write-combining (see RadixPartitionWriter)
+  const auto write_mode = RadixPartitionWriter<PartitionedElement<T>>::choose_mode(num_partitions, output->size());
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(chunk_offsets.size());
 
   for (ChunkID chunk_id{0}; chunk_id < chunk_offsets.size(); ++chunk_id) {
     jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
       size_t input_offset = chunk_offsets[chunk_id];
       auto& output_offsets = output_offsets_by_chunk[chunk_id];
+      auto writer = RadixPartitionWriter<PartitionedElement<T>>{output->data(), output_offsets, write_mode};
 
       size_t input_size = 0;
       if (chunk_id < chunk_offsets.size() - 1) {
@@ -339,11 +424,101 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
         // we need to keep them during the radix clustering phase.
         if constexpr (consider_null_values) {
           (*output_nulls)[output_offsets[radix]] = null_value_bitvector[chunk_offset];
+          ++output_offsets[radix];
+        }
+
+        writer.write(radix, element);
+      }
+      writer.flush();
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return radix_output;
+}
+
+/*
+Second pass of the radix partitioning: Each partition of the first pass (which partitioned by the lowest
+first_pass_radix_bits bits of the hash) is partitioned by the next second_pass_radix_bits bits. Partitioning in two
+passes limits the fan-out of each pass, so that the pages that the scattered writes go to fit into the TLB. Partition
+p2 of first-pass partition p1 becomes partition p1 * 2^second_pass_radix_bits + p2 of the output, so that the output
+partitions are stored in the order of their ids. The partitions of the first pass are processed in parallel.
+*/
+template <typename T, typename HashedType, bool consider_null_values>
+RadixContainer<T> partition_radix_second_pass(const RadixContainer<T>& radix_container,
+                                              const size_t first_pass_radix_bits,
+                                              const size_t second_pass_radix_bits) {
+  const std::hash<HashedType> hash_function;
+
+  const auto& container_elements = *radix_container.elements;
+  [[maybe_unused]] const auto& null_value_bitvector = *radix_container.null_value_bitvector;
+
+  const auto first_pass_partition_count = radix_container.partition_offsets.size();
+  const auto second_pass_partition_count = size_t{1} << second_pass_radix_bits;
+  const auto mask = second_pass_partition_count - 1;
+
+  auto output = std::make_shared<Partition<T>>();
+  output->resize(container_elements.size());
+
+  [[maybe_unused]] auto output_nulls = std::make_shared<std::vector<bool>>();
+  if constexpr (consider_null_values) {
+    output_nulls->resize(null_value_bitvector.size());
+  }
+
+  RadixContainer<T> radix_output;
+  radix_output.elements = output;
+  radix_output.partition_offsets.resize(first_pass_partition_count * second_pass_partition_count);
+  radix_output.null_value_bitvector = output_nulls;
+
+  const auto write_mode =
+      RadixPartitionWriter<PartitionedElement<T>>::choose_mode(second_pass_partition_count, output->size());
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(first_pass_partition_count);
+
+  for (auto first_pass_partition_id = size_t{0}; first_pass_partition_id < first_pass_partition_count;
+       ++first_pass_partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, first_pass_partition_id]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
+      const auto partition_begin =
+          first_pass_partition_id == 0 ? size_t{0} : radix_container.partition_offsets[first_pass_partition_id - 1];
+      const auto partition_end = radix_container.partition_offsets[first_pass_partition_id];
+
+      const auto radix_of = [&](const PartitionedElement<T>& element) {
+        return (hash_function(type_cast<HashedType>(element.value)) >> first_pass_radix_bits) & mask;
+      };
+
+      auto histogram = std::vector<size_t>(second_pass_partition_count);
+      for (auto element_idx = partition_begin; element_idx < partition_end; ++element_idx) {
+        ++histogram[radix_of(container_elements[element_idx])];
+      }
+
+      // The sub-partitions are stored in the range of the first pass partition. Each job writes the offsets of its own
+      // sub-partitions only.
+      auto output_offsets = std::vector<size_t>(second_pass_partition_count);
+      auto offset = partition_begin;
+      for (auto partition_id = size_t{0}; partition_id < second_pass_partition_count; ++partition_id) {
+        output_offsets[partition_id] = offset;
+        offset += histogram[partition_id];
+        radix_output.partition_offsets[first_pass_partition_id * second_pass_partition_count + partition_id] = offset;
+      }
+
+      auto writer = RadixPartitionWriter<PartitionedElement<T>>{output->data(), output_offsets, write_mode};
+      for (auto element_idx = partition_begin; element_idx < partition_end; ++element_idx) {
+        const auto& element = container_elements[element_idx];
+        const auto radix = radix_of(element);
+
+        if constexpr (consider_null_values) {
+          (*output_nulls)[output_offsets[radix]] = null_value_bitvector[element_idx];
+          ++output_offsets[radix];
         }
 
-        (*output)[output_offsets[radix]] = element;
-        ++output_offsets[radix];
+        writer.write(radix, element);
       }
+      writer.flush();
     }));
     jobs.back()->schedule();
   }
@@ -384,6 +559,8 @@ void probe(const RadixContainer<RightType>& radix_container,
     }
 
     jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
       PosList pos_list_left_local;
@@ -511,6 +688,8 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
     }
 
     jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
 
@@ -12,6 +12,7 @@
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index/base_table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -76,46 +77,69 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+  const auto table_index = input_table_right()->type() == TableType::Data
+                               ? input_table_right()->get_table_index(_column_ids.second)
+                               : nullptr;
 
-    std::shared_ptr<BaseIndex> index = nullptr;
-
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+  if (table_index) {
+    // A table index covers all chunks of the right input, so a single lookup per left value suffices
+    auto right_chunk_sizes = std::vector<ChunkOffset>(input_table_right()->chunk_count());
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      right_chunk_sizes[chunk_id_right] = input_table_right()->get_chunk(chunk_id_right)->size();
+      if (track_right_matches) _right_matches[chunk_id_right].resize(right_chunk_sizes[chunk_id_right]);
     }
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+      const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
 
-        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
-        });
+      segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+        _join_segment_using_table_index(it, end, chunk_id_left, *table_index, right_chunk_sizes);
+      });
+    }
+    performance_data.chunks_scanned_with_index += right_chunk_sizes.size();
+  } else {
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+
+      std::shared_ptr<BaseIndex> index = nullptr;
+
+      if (!indices.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        index = indices.front();
       }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+
+          segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+            _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
+          });
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right,
+                                                     params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
   }
 
@@ -219,6 +243,45 @@ void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterato
   }
 }
 
+// join loop that joins a segment of the left column with all rows of the right column using a table index
+template <typename LeftIterator>
+void JoinIndex::_join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end,
+                                                const ChunkID chunk_id_left, const BaseTableIndex& table_index,
+                                                const std::vector<ChunkOffset>& right_chunk_sizes) {
+  // The index stores right values, so `left <predicate_condition> right` is looked up as `right <flipped> left`
+  const auto index_predicate_condition = flip_predicate_condition(_predicate_condition);
+
+  auto right_row_ids = PosList{};
+
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    right_row_ids.clear();
+    table_index.append_matches(index_predicate_condition, AllTypeVariant{left_value.value()}, std::nullopt,
+                               right_row_ids);
+
+    for (const auto& right_row_id : right_row_ids) {
+      // Rows that were inserted after the join started are not part of its input
+      if (static_cast<size_t>(right_row_id.chunk_id) >= right_chunk_sizes.size() ||
+          right_row_id.chunk_offset >= right_chunk_sizes[right_row_id.chunk_id]) {
+        continue;
+      }
+
+      _pos_list_left->emplace_back(RowID{chunk_id_left, left_value.chunk_offset()});
+      _pos_list_right->emplace_back(right_row_id);
+
+      if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+        _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+      }
+
+      if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+        _right_matches[right_row_id.chunk_id][right_row_id.chunk_offset] = true;
+      }
+    }
+  }
+}
+
 // join loop that joins two segments of two columns via their iterators
 template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
 void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
@@ -12,12 +12,17 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class BaseTableIndex;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. If the right input is
+   *       a data table with a table index (see BaseTableIndex) on the join column, it is used instead of the chunk
+   *       indexes.
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -49,6 +54,11 @@ class JoinIndex : public AbstractJoinOperator {
   void _join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
                                       const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
 
+  template <typename LeftIterator>
+  void _join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
+                                       const BaseTableIndex& table_index,
+                                       const std::vector<ChunkOffset>& right_chunk_sizes);
+
   template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   void _join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                                       RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
@@ -540,11 +540,15 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
           continue;
         }
       }
-      jobs.push_back(std::make_shared<JobTask>([this, cluster_number] { this->_join_cluster(cluster_number); }));
+      jobs.push_back(std::make_shared<JobTask>([this, cluster_number] {
+        if (AbstractTask::is_current_task_cancelled()) return;
+        this->_join_cluster(cluster_number);
+      }));
       jobs.back()->schedule();
     }
 
     CurrentScheduler::wait_for_tasks(jobs);
+    if (AbstractTask::is_current_task_cancelled()) return;
 
     // The outer joins for the non-equi cases
     // Note: Equi outer joins can be integrated into the main algorithm, while these can not.
@@ -650,6 +654,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
         _op == PredicateCondition::Equals, include_null_left, include_null_right, _cluster_count);
     // Sort and cluster the input tables
     auto sort_output = radix_clusterer.execute();
+
+    // The output of a cancelled query is discarded by the caller, so an empty table suffices
+    if (AbstractTask::is_current_task_cancelled()) return _sort_merge_join._initialize_output_table();
+
     _sorted_left_table = std::move(sort_output.clusters_left);
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
@@ -658,6 +666,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
     _perform_join();
+    if (AbstractTask::is_current_task_cancelled()) return _sort_merge_join._initialize_output_table();
 
     // merge the pos lists into single pos lists
     auto output_left = _concatenate_pos_lists(_output_pos_lists_left);
@@ -8,6 +8,8 @@
 
 #include "column_materializer.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "utils/radix_partition_writer.hpp"
 
 namespace opossum {
 
@@ -210,20 +212,32 @@ class RadixClusterSort {
       (*output_table)[cluster_id] = std::make_shared<MaterializedSegment<T>>(cluster_size);
     }
 
-    // Move each entry into its appropriate cluster in parallel
+    // Move each entry into its appropriate cluster in parallel. At a high fan-out, the entries are scattered using
+    // software write-combining (see RadixPartitionWriter).
+    auto row_count = size_t{0};
+    for (const auto cluster_size : table_information.cluster_histogram) {
+      row_count += cluster_size;
+    }
+    const auto write_mode = RadixPartitionWriter<MaterializedValue<T>>::choose_mode(_cluster_count, row_count);
+
     std::vector<std::shared_ptr<AbstractTask>> cluster_jobs;
     for (size_t chunk_number = 0; chunk_number < input_chunks->size(); ++chunk_number) {
-      auto job =
-          std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
-            auto& chunk_information = table_information.chunk_information[chunk_number];
-            for (auto& entry : *(*input_chunks)[chunk_number]) {
-              auto cluster_id = clusterer(entry.value);
-              auto& output_cluster = *(*output_table)[cluster_id];
-              auto& insert_position = chunk_information.insert_position[cluster_id];
-              output_cluster[insert_position] = entry;
-              ++insert_position;
-            }
-          });
+      auto job = std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer,
+                                            write_mode, this] {
+        const auto& chunk_information = table_information.chunk_information[chunk_number];
+
+        auto write_positions = std::vector<MaterializedValue<T>*>(_cluster_count);
+        for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
+          write_positions[cluster_id] =
+              (*output_table)[cluster_id]->data() + chunk_information.insert_position[cluster_id];
+        }
+
+        auto writer = RadixPartitionWriter<MaterializedValue<T>>{std::move(write_positions), write_mode};
+        for (const auto& entry : *(*input_chunks)[chunk_number]) {
+          writer.write(clusterer(entry.value), entry);
+        }
+        writer.flush();
+      });
       cluster_jobs.push_back(job);
       job->schedule();
     }
@@ -337,6 +351,9 @@ class RadixClusterSort {
     output.null_rows_left = std::move(null_rows_left);
     output.null_rows_right = std::move(null_rows_right);
 
+    // The clusters are left empty if the query was cancelled, as the caller discards the output anyway
+    if (AbstractTask::is_current_task_cancelled()) return output;
+
     // Append right samples to left samples and sort (reserve not necessarity when insert can
     // determined the new capacity from iterator: https://stackoverflow.com/a/35359472/1147726)
     samples_left.insert(samples_left.end(), samples_right.begin(), samples_right.end());
@@ -7,7 +7,12 @@
 namespace opossum {
 
 std::string OperatorPerformanceData::to_string(DescriptionMode description_mode) const {
-  return format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  auto string = format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  if (!performance_counters.empty()) {
+    string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+    string += performance_counters.to_string();
+  }
+  return string;
 }
 
 }  // namespace opossum
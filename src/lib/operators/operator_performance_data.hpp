@@ -1,9 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
@@ -14,6 +16,18 @@ struct OperatorPerformanceData : public Noncopyable {
 
   std::chrono::nanoseconds walltime{0};
 
+  // Hardware events of the thread that executed the operator. Empty unless PerformanceCounters are enabled and
+  // available.
+  PerformanceCounterValues performance_counters;
+
+  // Recorded by AbstractOperator::execute(), as the inputs and the output might be cleared before they are inspected
+  size_t input_row_count{0};
+  size_t output_row_count{0};
+  size_t output_chunk_count{0};
+
+  // Estimated size of the output in bytes. Not set for GetTable and TableWrapper, whose outputs are existing tables.
+  std::optional<size_t> output_memory_usage;
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
@@ -12,6 +12,11 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/numa_placement_manager.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -51,41 +56,68 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   const auto uncorrelated_subquery_results =
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
 
-  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  // Subexpressions that occur multiple times, e.g., `a * b` in `SELECT a * b, (a * b) + c`, are evaluated only once
+  // per chunk
+  const auto common_subexpressions = ExpressionEvaluator::find_common_subexpressions(expressions);
+
+  const auto input_table = input_table_left();
 
   /**
-   * Perform the projection
+   * Perform the projection, one job per chunk. Each job writes only the entry of its chunk in output_chunk_segments.
    */
-  auto output_chunk_segments = std::vector<Segments>(input_table_left()->chunk_count());
-
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
-
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
-
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_subquery_results);
-    for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
-      const auto& expression = expressions[column_id];
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table_left()->column_is_nullable(pqp_column_expression->column_id);
-      } else {
-        const auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        output_segments.emplace_back(output_segment);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+  auto output_chunk_segments = std::vector<Segments>(input_table->chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_table->chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto home_node_id = NUMAPlacementManager::home_node_id(*input_table, chunk_id);
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, home_node_id]() {
+      NUMAPlacementManager::get().record_access(home_node_id);
+
+      Segments output_segments;
+      output_segments.reserve(expressions.size());
+
+      const auto input_chunk = input_table->get_chunk(chunk_id);
+
+      ExpressionEvaluator evaluator(input_table, chunk_id, uncorrelated_subquery_results, common_subexpressions);
+      for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+        const auto& expression = expressions[column_id];
+        // Forward input column if possible
+        if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+          const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+          output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+        } else {
+          output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+        }
       }
-    }
 
-    output_chunk_segments[chunk_id] = std::move(output_segments);
+      output_chunk_segments[chunk_id] = std::move(output_segments);
+    }));
+    jobs.back()->schedule(home_node_id);
   }
 
+  CurrentScheduler::wait_for_tasks(jobs);
+
   /**
-   * Determine the TableColumnDefinitions and build the output table
+   * Determine the TableColumnDefinitions and build the output table. Forwarded columns keep the nullability of the
+   * input column, evaluated columns are nullable if any of their segments is.
    */
+  auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    const auto& expression = expressions[column_id];
+    if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+      const auto& pqp_column_expression = static_cast<const PQPColumnExpression&>(*expression);
+      column_is_nullable[column_id] = input_table->column_is_nullable(pqp_column_expression.column_id);
+    } else {
+      column_is_nullable[column_id] =
+          std::any_of(output_chunk_segments.begin(), output_chunk_segments.end(), [&](const auto& segments) {
+            return std::static_pointer_cast<const BaseValueSegment>(segments[column_id])->is_nullable();
+          });
+    }
+  }
+
   TableColumnDefinitions column_definitions;
   for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
     column_definitions.emplace_back(expressions[column_id]->as_column_name(), expressions[column_id]->data_type(),
@@ -93,11 +125,11 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   }
 
   const auto output_table =
-      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table_left()->has_mvcc());
+      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table->has_mvcc());
 
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
     output_table->append_chunk(output_chunk_segments[chunk_id]);
-    output_table->get_chunk(chunk_id)->set_mvcc_data(input_table_left()->get_chunk(chunk_id)->mvcc_data());
+    output_table->get_chunk(chunk_id)->set_mvcc_data(input_table->get_chunk(chunk_id)->mvcc_data());
   }
 
   return output_table;
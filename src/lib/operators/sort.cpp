@@ -1,13 +1,17 @@
 #include "sort.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_gather.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
@@ -96,6 +100,15 @@ class Sort::SortImplMaterializeOutput {
                                                   std::shared_ptr<BaseSegmentAccessor<ColumnDataType>>>>();
         segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
 
+        using Gather = ReferenceSegmentGather<ColumnDataType>;
+        const auto sorted_reference_segment = _sorted_reference_segment(column_id);
+        auto gather = std::optional<Gather>{};
+        auto gathered_values = std::vector<std::optional<ColumnDataType>>{};
+        if (sorted_reference_segment) {
+          gather.emplace(*sorted_reference_segment);
+          gathered_values.resize(Gather::BLOCK_SIZE);
+        }
+
         for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
           const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;  // NOLINT
 
@@ -103,13 +116,25 @@ class Sort::SortImplMaterializeOutput {
           auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
           auto& accessor = segment_ptr_and_typed_ptr_pair.second;
 
-          if (!base_segment) {
+          if (!gather && !base_segment) {
             base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
             accessor = create_segment_accessor<ColumnDataType>(base_segment);
           }
 
-          // If the input segment is not a ReferenceSegment, we can take a fast(er) path
-          if (accessor) {
+          if (gather) {
+            // The values of the next block of rows are read at once
+            const auto block_offset = row_index % Gather::BLOCK_SIZE;
+            if (block_offset == 0) {
+              const auto block_end = std::min(row_count_out, static_cast<size_t>(row_index + Gather::BLOCK_SIZE));
+              gather->gather(row_index, static_cast<ChunkOffset>(block_end), gathered_values.data());
+            }
+
+            auto& typed_value = gathered_values[block_offset];
+            const auto is_null = !typed_value.has_value();
+            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : std::move(*typed_value));
+            value_segment_null_vector.push_back(is_null);
+          } else if (accessor) {
+            // If the input segment is not a ReferenceSegment, we can take a fast(er) path
             const auto typed_value = accessor->access(chunk_offset);
             const auto is_null = !typed_value.has_value();
             value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
@@ -152,6 +177,44 @@ class Sort::SortImplMaterializeOutput {
   }
 
  protected:
+  /**
+   * If all segments of the column are ReferenceSegments that reference the same column of the same table, returns a
+   * ReferenceSegment that references the values of the sorted rows in that table. Its values are read with a
+   * ReferenceSegmentGather, which is faster than resolving each row through the accessor of its input segment.
+   * Otherwise, returns nullptr.
+   */
+  std::shared_ptr<const ReferenceSegment> _sorted_reference_segment(const ColumnID column_id) const {
+    if (_table_in->type() != TableType::References || _table_in->chunk_count() == 0) return nullptr;
+
+    auto referenced_table = std::shared_ptr<const Table>{};
+    auto referenced_column_id = ColumnID{0};
+    auto pos_lists = std::vector<std::shared_ptr<const PosList>>(_table_in->chunk_count());
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      const auto reference_segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(_table_in->get_chunk(chunk_id)->get_segment(column_id));
+      if (!reference_segment) return nullptr;
+
+      if (!referenced_table) {
+        referenced_table = reference_segment->referenced_table();
+        referenced_column_id = reference_segment->referenced_column_id();
+      } else if (reference_segment->referenced_table() != referenced_table ||
+                 reference_segment->referenced_column_id() != referenced_column_id) {
+        return nullptr;
+      }
+      pos_lists[chunk_id] = reference_segment->pos_list();
+    }
+
+    auto sorted_pos_list = std::make_shared<PosList>();
+    sorted_pos_list->reserve(_row_id_value_vector->size());
+    for (const auto& row_id_value : *_row_id_value_vector) {
+      const auto& row_id = row_id_value.first;
+      sorted_pos_list->emplace_back((*pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+    }
+
+    return std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, sorted_pos_list);
+  }
+
   const std::shared_ptr<const Table> _table_in;
   const size_t _output_chunk_size;
   const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
@@ -178,6 +241,7 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
   std::shared_ptr<const Table> _on_execute() override {
     // 1. Prepare Sort: Creating rowid-value-Structure
     _materialize_sort_column();
+    if (AbstractTask::is_current_task_cancelled()) return _cancelled_output();
 
     // 2. After we got our ValueRowID Map we sort the map by the value of the pair
     if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
@@ -185,6 +249,7 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
     } else {
       _sort_with_operator<std::greater<>>();
     }
+    if (AbstractTask::is_current_task_cancelled()) return _cancelled_output();
 
     // 2b. Insert null rows if necessary
     if (!_null_value_rows->empty()) {
@@ -212,6 +277,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
     auto& null_value_rows = *_null_value_rows;
 
     for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      if (AbstractTask::is_current_task_cancelled()) return;
+
       auto chunk = _table_in->get_chunk(chunk_id);
 
       auto base_segment = chunk->get_segment(_column_id);
@@ -226,6 +293,11 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
     }
   }
 
+  // The output of a cancelled query is discarded by the caller, so there is no need to materialize it
+  std::shared_ptr<const Table> _cancelled_output() const {
+    return std::make_shared<Table>(_table_in->column_definitions(), TableType::Data);
+  }
+
   template <typename Comparator>
   void _sort_with_operator() {
     Comparator comparator;
@@ -1,5 +1,7 @@
 #include "table_scan.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -16,32 +18,42 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/chunk_pruning_utils.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/numa_placement_manager.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
+#include "table_scan/column_in_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/disjunction_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in}, _predicate(predicate) {}
+    : AbstractReadOnlyOperator{OperatorType::TableScan, in, nullptr, std::make_unique<TableScan::PerformanceData>()},
+      _predicate(predicate) {}
 
 void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
 
@@ -57,6 +69,9 @@ const std::string TableScan::description(DescriptionMode description_mode) const
   stream << name() << separator;
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
+  if (_runtime_pruned_chunk_count > 0) {
+    stream << separator << "(" << _runtime_pruned_chunk_count << " Chunks pruned at runtime)";
+  }
 
   return stream.str();
 }
@@ -80,23 +95,42 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
 
-  _impl = create_impl();
+  const auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+
+  _impl = _create_impl(resolved_predicate);
   _impl_description = _impl->description();
 
   std::mutex output_mutex;
 
-  const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
+  auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
+  const auto pruned_chunk_ids = _prune_chunks_at_runtime(in_table, resolved_predicate);
+  excluded_chunk_set.insert(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend());
+  _runtime_pruned_chunk_count = pruned_chunk_ids.size();
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
+  // Summed over all jobs, which run concurrently
+  auto scan_nanoseconds = std::atomic<uint64_t>{0};
+  auto output_writing_nanoseconds = std::atomic<uint64_t>{0};
+
   for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
+    const auto home_node_id = NUMAPlacementManager::home_node_id(*in_table, chunk_id);
+
+    auto job_task = std::make_shared<JobTask>([=, &output_mutex, &scan_nanoseconds, &output_writing_nanoseconds]() {
+      // The remaining chunks of a cancelled query are not scanned. The incomplete output is discarded by the caller.
+      if (AbstractTask::is_current_task_cancelled()) return;
+
+      NUMAPlacementManager::get().record_access(home_node_id);
+
+      Timer timer;
+
       const auto chunk_guard = in_table->get_chunk(chunk_id);
       // The actual scan happens in the sub classes of BaseTableScanImpl
       const auto matches_out = _impl->scan_chunk(chunk_id);
+      scan_nanoseconds += timer.lap().count();
       if (matches_out->empty()) return;
 
       Segments out_segments;
@@ -156,14 +190,21 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
       std::lock_guard<std::mutex> lock(output_mutex);
       output_table->append_chunk(out_segments, chunk_guard->get_allocator());
+      output_writing_nanoseconds += timer.lap().count();
     });
 
     jobs.push_back(job_task);
-    job_task->schedule();
+    job_task->schedule(home_node_id);
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  performance_data.chunks_scanned = jobs.size();
+  performance_data.chunks_pruned_at_runtime = _runtime_pruned_chunk_count;
+  performance_data.scan = std::chrono::nanoseconds{scan_nanoseconds.load()};
+  performance_data.output_writing = std::chrono::nanoseconds{output_writing_nanoseconds.load()};
+
   return output_table;
 }
 
@@ -201,7 +242,62 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
   return new_predicate;
 }
 
+std::vector<ChunkID> TableScan::_prune_chunks_at_runtime(
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate) {
+  auto column_id = INVALID_COLUMN_ID;
+  auto predicate_condition = PredicateCondition::Equals;
+  auto value = std::optional<AllTypeVariant>{};
+  auto value2 = std::optional<AllTypeVariant>{};
+
+  // Predicate patterns: <column> <binary predicate_condition> <value> and <column> BETWEEN <value> AND <value>
+  if (const auto binary_predicate_expression =
+          std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
+    predicate_condition = binary_predicate_expression->predicate_condition;
+    if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+      return {};
+    }
+
+    const auto left_column_expression =
+        std::dynamic_pointer_cast<PQPColumnExpression>(binary_predicate_expression->left_operand());
+    const auto right_column_expression =
+        std::dynamic_pointer_cast<PQPColumnExpression>(binary_predicate_expression->right_operand());
+
+    if (left_column_expression) {
+      column_id = left_column_expression->column_id;
+      value = expression_get_value_or_parameter(*binary_predicate_expression->right_operand());
+    } else if (right_column_expression) {
+      column_id = right_column_expression->column_id;
+      predicate_condition = flip_predicate_condition(predicate_condition);
+      value = expression_get_value_or_parameter(*binary_predicate_expression->left_operand());
+    }
+  } else if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(resolved_predicate)) {
+    if (const auto column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(between_expression->value())) {
+      column_id = column_expression->column_id;
+      predicate_condition = PredicateCondition::Between;
+      value = expression_get_value_or_parameter(*between_expression->lower_bound());
+      value2 = expression_get_value_or_parameter(*between_expression->upper_bound());
+      if (!value2) return {};
+    }
+  }
+
+  if (column_id == INVALID_COLUMN_ID || !value) return {};
+
+  auto pruned_chunk_ids = std::vector<ChunkID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    if (chunk_can_be_pruned(*in_table, chunk_id, column_id, predicate_condition, *value, value2)) {
+      pruned_chunk_ids.emplace_back(chunk_id);
+    }
+  }
+
+  return pruned_chunk_ids;
+}
+
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+  return _create_impl(_resolve_uncorrelated_subqueries(_predicate));
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(
+    const std::shared_ptr<AbstractExpression>& resolved_predicate) const {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -209,8 +305,6 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    * an expression.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
-
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
     const auto predicate_condition = binary_predicate_expression->predicate_condition;
@@ -292,10 +386,61 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     }
   }
 
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(resolved_predicate)) {
+    const auto left_column = std::dynamic_pointer_cast<PQPColumnExpression>(in_expression->value());
+    const auto list_expression = std::dynamic_pointer_cast<ListExpression>(in_expression->set());
+
+    // Predicate pattern: <column> [NOT] IN (<non-null value-of-column-type>, ...)
+    if (left_column && list_expression && !list_expression->elements().empty()) {
+      auto values = std::vector<AllTypeVariant>{};
+      values.reserve(list_expression->elements().size());
+      for (const auto& element : list_expression->elements()) {
+        const auto value = expression_get_value_or_parameter(*element);
+        if (!value || variant_is_null(*value) || data_type_from_all_type_variant(*value) != left_column->data_type()) {
+          break;
+        }
+        values.emplace_back(*value);
+      }
+
+      if (values.size() == list_expression->elements().size()) {
+        return std::make_unique<ColumnInTableScanImpl>(input_table_left(), left_column->column_id, values,
+                                                       in_expression->is_negated());
+      }
+    }
+  }
+
+  const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(resolved_predicate);
+  if (logical_expression && logical_expression->logical_operator == LogicalOperator::Or) {
+    // Predicate pattern: <predicate> OR <predicate> OR ..., where all predicates have a dedicated scanning
+    // implementation. Otherwise, the ExpressionEvaluator evaluates the whole disjunction, which is faster than
+    // evaluating a part of it for every disjunct.
+    auto disjunct_impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+    for (const auto& disjunct : flatten_logical_expressions(resolved_predicate, LogicalOperator::Or)) {
+      auto disjunct_impl = _create_impl(disjunct);
+      if (dynamic_cast<ExpressionEvaluatorTableScanImpl*>(disjunct_impl.get())) {
+        disjunct_impls.clear();
+        break;
+      }
+      disjunct_impls.emplace_back(std::move(disjunct_impl));
+    }
+
+    if (!disjunct_impls.empty()) {
+      return std::make_unique<DisjunctionTableScanImpl>(input_table_left(), std::move(disjunct_impls));
+    }
+  }
+
   // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
   return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), resolved_predicate);
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
 
+std::string TableScan::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += std::to_string(chunks_scanned) + " chunks scanned, " + std::to_string(chunks_pruned_at_runtime) +
+            " pruned at runtime, scan " + format_duration(scan) + ", output writing " + format_duration(output_writing);
+  return string;
+}
+
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <optional>
 #include <string>
@@ -43,6 +44,16 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  // The durations are summed over the concurrently scanned chunks, so they can exceed the walltime of the operator
+  struct PerformanceData : public OperatorPerformanceData {
+    size_t chunks_scanned{0};
+    size_t chunks_pruned_at_runtime{0};
+    std::chrono::nanoseconds scan{0};
+    std::chrono::nanoseconds output_writing{0};
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
   /**
    * Create the TableScanImpl based on the predicate type. Public for testing purposes.
    */
@@ -65,6 +76,15 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  std::unique_ptr<AbstractTableScanImpl> _create_impl(
+      const std::shared_ptr<AbstractExpression>& resolved_predicate) const;
+
+  // Uses the ChunkStatistics to find the chunks of @param in_table that cannot contain any match for
+  // @param resolved_predicate. Contrary to the ChunkPruningRule, which only sees literals, this also covers values that
+  // are only known at execution time, i.e., parameters bound to a cached plan and the results of subqueries.
+  static std::vector<ChunkID> _prune_chunks_at_runtime(const std::shared_ptr<const Table>& in_table,
+                                                       const std::shared_ptr<AbstractExpression>& resolved_predicate);
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
@@ -74,6 +94,9 @@ class TableScan : public AbstractReadOnlyOperator {
   std::string _impl_description{"Unset"};
 
   std::vector<ChunkID> _excluded_chunk_ids;
+
+  // Number of chunks skipped by _prune_chunks_at_runtime(), kept for the description
+  size_t _runtime_pruned_chunk_count{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,95 @@
+#include "column_in_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+#include "utils/assert.hpp"
+
+#include "resolve_type.hpp"
+
+namespace opossum {
+
+ColumnInTableScanImpl::ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                             const std::vector<AllTypeVariant>& values, const bool is_negated)
+    : AbstractSingleColumnTableScanImpl{in_table, column_id,
+                                        is_negated ? PredicateCondition::NotIn : PredicateCondition::In},
+      _values{values},
+      _is_negated{is_negated} {
+  DebugAssert(std::none_of(_values.cbegin(), _values.cend(), [](const auto& value) { return variant_is_null(value); }),
+              "ColumnInTableScanImpl does not support NULL values in the list");
+}
+
+std::string ColumnInTableScanImpl::description() const { return "ColumnIn"; }
+
+void ColumnInTableScanImpl::_scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                        PosList& matches,
+                                                        const std::shared_ptr<const PosList>& position_filter) const {
+  // Select optimized or generic scanning implementation based on segment type
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else {
+    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+  }
+}
+
+void ColumnInTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                  PosList& matches,
+                                                  const std::shared_ptr<const PosList>& position_filter) const {
+  segment_with_iterators_filtered(segment, position_filter, [&](auto it, const auto end) {
+    using ColumnDataType = typename decltype(it)::ValueType;
+
+    auto typed_values = std::unordered_set<ColumnDataType>{};
+    typed_values.reserve(_values.size());
+    for (const auto& value : _values) {
+      typed_values.emplace(type_cast_variant<ColumnDataType>(value));
+    }
+
+    const auto is_negated = _is_negated;
+    const auto comparator = [&typed_values, is_negated](const auto& position) {
+      return (typed_values.count(position.value()) != 0) != is_negated;
+    };
+
+    _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+void ColumnInTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                                     PosList& matches,
+                                                     const std::shared_ptr<const PosList>& position_filter) const {
+  const auto unique_values_count = segment.unique_values_count();
+
+  // One entry per ValueID of the dictionary plus one for the NULL value id, which never matches
+  auto value_id_matches = std::vector<bool>(unique_values_count + 1, _is_negated);
+  value_id_matches[segment.null_value_id()] = false;
+
+  auto matching_value_id_count = size_t{0};
+  for (const auto& value : _values) {
+    const auto value_id = segment.lower_bound(value);
+    if (value_id == INVALID_VALUE_ID || value_id >= static_cast<ValueID>(unique_values_count)) continue;
+    if (segment.value_of_value_id(value_id) != value) continue;
+    if (value_id_matches[value_id] == _is_negated) ++matching_value_id_count;
+    value_id_matches[value_id] = !_is_negated;
+  }
+
+  // For IN, no value matches if none of the list's values is in the dictionary. For NOT IN, this is the case if all
+  // values of the dictionary are in the list.
+  if (matching_value_id_count == (_is_negated ? unique_values_count : size_t{0})) return;
+
+  auto column_iterable = create_iterable_from_attribute_vector(segment);
+  column_iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    const auto comparator = [&value_id_matches](const auto& position) { return value_id_matches[position.value()]; };
+
+    // No need to check for NULL because the entry of the NULL value id is never set
+    _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+}  // namespace opossum
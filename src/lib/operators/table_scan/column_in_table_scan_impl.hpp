@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_single_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Compares a column to a list of scalar values (... WHERE col [NOT] IN (value_1, ..., value_n))
+ *
+ * Instead of comparing each row to every element of the list, the values of DictionarySegments are probed in a bitmap
+ * of the matching ValueIDs. The values of all other segments are probed in a hash set of the list's values.
+ *
+ * Limitations:
+ * - The values are expected to have the data type of the column and must not be NULL. Other lists are handled by the
+ *   ExpressionEvaluator.
+ */
+class ColumnInTableScanImpl : public AbstractSingleColumnTableScanImpl {
+ public:
+  ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                        const std::vector<AllTypeVariant>& values, const bool is_negated);
+
+  std::string description() const override;
+
+ protected:
+  void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                                   const std::shared_ptr<const PosList>& position_filter) const override;
+
+  void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                             const std::shared_ptr<const PosList>& position_filter) const;
+
+  // Optimized scan on DictionarySegments
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+                                const std::shared_ptr<const PosList>& position_filter) const;
+
+  const std::vector<AllTypeVariant> _values;
+  const bool _is_negated;
+};
+
+}  // namespace opossum
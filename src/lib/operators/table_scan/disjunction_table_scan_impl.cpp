@@ -0,0 +1,60 @@
+#include "disjunction_table_scan_impl.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+DisjunctionTableScanImpl::DisjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                                                   std::vector<std::unique_ptr<AbstractTableScanImpl>> disjunct_impls)
+    : _in_table(in_table), _disjunct_impls(std::move(disjunct_impls)) {
+  DebugAssert(_disjunct_impls.size() > 1, "Expected at least two disjuncts");
+}
+
+std::string DisjunctionTableScanImpl::description() const {
+  auto description = std::string{"Disjunction("};
+  for (auto disjunct_idx = size_t{0}; disjunct_idx < _disjunct_impls.size(); ++disjunct_idx) {
+    if (disjunct_idx > 0) description += ", ";
+    description += _disjunct_impls[disjunct_idx]->description();
+  }
+  return description + ")";
+}
+
+std::shared_ptr<PosList> DisjunctionTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
+  const auto chunk_size = _in_table->get_chunk(chunk_id)->size();
+
+  auto matches_bitmap = std::vector<bool>(chunk_size);
+  auto match_count = size_t{0};
+
+  for (const auto& disjunct_impl : _disjunct_impls) {
+    const auto disjunct_matches = disjunct_impl->scan_chunk(chunk_id);
+    for (const auto& match : *disjunct_matches) {
+      if (matches_bitmap[match.chunk_offset]) continue;
+      matches_bitmap[match.chunk_offset] = true;
+      ++match_count;
+    }
+
+    // All rows already match, the remaining disjuncts do not need to be scanned
+    if (match_count == chunk_size) break;
+  }
+
+  auto matches = std::make_shared<PosList>(match_count);
+  auto match_idx = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (matches_bitmap[chunk_offset]) (*matches)[match_idx++] = RowID{chunk_id, chunk_offset};
+  }
+
+  return matches;
+}
+
+const std::vector<std::unique_ptr<AbstractTableScanImpl>>& DisjunctionTableScanImpl::disjunct_impls() const {
+  return _disjunct_impls;
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_table_scan_impl.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Scans for rows that match at least one of multiple predicates (... WHERE a < 10 OR b > 20 OR c IN (...))
+ *
+ * Each disjunct is scanned by its own dedicated scan impl. For every chunk, the matches of all disjuncts are marked in
+ * a bitmap with one entry per row of the chunk, which is then turned into a single PosList. Thus, the output is sorted
+ * and free of duplicates without the need to sort and merge the PosLists of multiple scans (as UnionPositions does).
+ */
+class DisjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  DisjunctionTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                           std::vector<std::unique_ptr<AbstractTableScanImpl>> disjunct_impls);
+
+  std::string description() const override;
+
+  std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
+
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>>& disjunct_impls() const;
+
+ protected:
+  const std::shared_ptr<const Table> _in_table;
+  const std::vector<std::unique_ptr<AbstractTableScanImpl>> _disjunct_impls;
+};
+
+}  // namespace opossum
@@ -13,6 +13,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index/base_table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -41,21 +42,31 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
 
       const auto index_infos = table->get_indexes();
       for (const auto& index_info : index_infos) {
-        if (_is_index_scan_applicable(index_info, predicate_node)) {
+        if (index_info.type != SegmentIndexType::GroupKey) continue;
+
+        if (_is_index_scan_applicable(index_info.column_ids, predicate_node)) {
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
+
+      // The positions of table indexes refer to the chunks of the stored table, which GetTable renumbers when it
+      // prunes chunks (see LQPTranslator::_translate_predicate_node_to_index_scan())
+      if (stored_table_node->excluded_chunk_ids().empty()) {
+        for (const auto& table_index : table->table_indexes()) {
+          if (_is_index_scan_applicable({table_index->column_id()}, predicate_node)) {
+            predicate_node->scan_type = ScanType::IndexScan;
+          }
+        }
+      }
     }
   }
 
   _apply_to_inputs(node);
 }
 
-bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
+bool IndexScanRule::_is_index_scan_applicable(const std::vector<ColumnID>& index_column_ids,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
-  if (!_is_single_segment_index(index_info)) return false;
-
-  if (index_info.type != SegmentIndexType::GroupKey) return false;
+  if (!_is_single_segment_index(index_column_ids)) return false;
 
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
@@ -64,10 +75,11 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
 
   const auto& operator_predicate = (*operator_predicates)[0];
 
-  // Currently, we do not support two-column predicates
+  // Currently, we do not support two-column predicates. Values and parameters (e.g., the literals of cached plans,
+  // which are only bound during execution) are resolved by the IndexScan.
   if (is_column_id(operator_predicate.value)) return false;
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+  if (index_column_ids[0] != operator_predicate.column_id) return false;
 
   const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
@@ -79,8 +91,8 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
 }
 
-inline bool IndexScanRule::_is_single_segment_index(const IndexInfo& index_info) const {
-  return index_info.column_ids.size() == 1;
+inline bool IndexScanRule::_is_single_segment_index(const std::vector<ColumnID>& index_column_ids) const {
+  return index_column_ids.size() == 1;
 }
 
 }  // namespace opossum
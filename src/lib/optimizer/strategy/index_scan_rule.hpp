@@ -22,7 +22,7 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes and table indexes (see BaseTableIndex) are supported.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -31,9 +31,9 @@ class IndexScanRule : public AbstractRule {
   void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  protected:
-  bool _is_index_scan_applicable(const IndexInfo& index_info,
+  bool _is_index_scan_applicable(const std::vector<ColumnID>& index_column_ids,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
-  inline bool _is_single_segment_index(const IndexInfo& index_info) const;
+  inline bool _is_single_segment_index(const std::vector<ColumnID>& index_column_ids) const;
 };
 
 }  // namespace opossum
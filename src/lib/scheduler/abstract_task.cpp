@@ -6,13 +6,28 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
+#include "workload_manager.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+/**
+ * The QueryGroup of the task that is being executed on this thread. Tasks scheduled by it, e.g., the JobTasks of an
+ * operator, become part of the same group.
+ */
+thread_local std::shared_ptr<opossum::QueryGroup> this_thread_query_group;
+
+// The CancellationToken of the task that is being executed on this thread, passed on in the same way
+thread_local std::shared_ptr<opossum::CancellationToken> this_thread_cancellation_token;
+
+}  // namespace
+
 namespace opossum {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -57,7 +72,30 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
   _done_callback = done_callback;
 }
 
+void AbstractTask::set_query_group(const std::shared_ptr<QueryGroup>& query_group) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the QueryGroup after the Task was scheduled");
+
+  _query_group = query_group;
+}
+
+const std::shared_ptr<QueryGroup>& AbstractTask::query_group() const { return _query_group; }
+
+void AbstractTask::set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the CancellationToken after the Task was scheduled");
+
+  _cancellation_token = cancellation_token;
+}
+
+const std::shared_ptr<CancellationToken>& AbstractTask::cancellation_token() const { return _cancellation_token; }
+
+bool AbstractTask::is_current_task_cancelled() {
+  return ::this_thread_cancellation_token && ::this_thread_cancellation_token->is_cancelled();
+}
+
 void AbstractTask::schedule(NodeID preferred_node_id) {
+  if (!_query_group) _query_group = ::this_thread_query_group;
+  if (!_cancellation_token) _cancellation_token = ::this_thread_cancellation_token;
+
   _mark_as_scheduled();
 
   if (CurrentScheduler::is_set()) {
@@ -80,8 +118,18 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
+  // Tasks might be executed while the Worker waits for other tasks (see Worker::_wait_for_tasks()), so the group and
+  // the token of the outer task are restored afterwards
+  auto outer_query_group = std::move(::this_thread_query_group);
+  auto outer_cancellation_token = std::move(::this_thread_cancellation_token);
+  ::this_thread_query_group = _query_group;
+  ::this_thread_cancellation_token = _cancellation_token;
+
   _on_execute();
 
+  ::this_thread_query_group = std::move(outer_query_group);
+  ::this_thread_cancellation_token = std::move(outer_cancellation_token);
+
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
   }
@@ -12,6 +12,8 @@
 
 namespace opossum {
 
+class CancellationToken;
+class QueryGroup;
 class Worker;
 
 /**
@@ -85,6 +87,26 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_done_callback(const std::function<void()>& done_callback);
 
+  /**
+   * The QueryGroup determines the share of the Workers the task competes for (see TaskQueue). If none is set, the task
+   * joins the QueryGroup of the task that schedules it, if any.
+   */
+  void set_query_group(const std::shared_ptr<QueryGroup>& query_group);
+  const std::shared_ptr<QueryGroup>& query_group() const;
+
+  /**
+   * Tasks of a cancelled query are expected to finish early (see CancellationToken). Like the QueryGroup, the token is
+   * inherited from the task that schedules this task if none is set.
+   */
+  void set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token);
+  const std::shared_ptr<CancellationToken>& cancellation_token() const;
+
+  /**
+   * @return The CancellationToken of the task that is executed on the calling thread has been cancelled. False if no
+   *         task is executed or the task has no token, e.g., if an operator is executed directly.
+   */
+  static bool is_current_task_cancelled();
+
   /**
    * Schedules the task if a Scheduler is available, otherwise just executes it on the current Thread
    */
@@ -131,6 +153,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
   bool _stealable;
+  std::shared_ptr<QueryGroup> _query_group;
+  std::shared_ptr<CancellationToken> _cancellation_token;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
 
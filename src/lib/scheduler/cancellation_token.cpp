@@ -0,0 +1,22 @@
+#include "cancellation_token.hpp"
+
+#include <chrono>
+
+namespace opossum {
+
+CancellationToken::CancellationToken(const std::chrono::milliseconds timeout)
+    : _deadline(timeout.count() > 0 ? std::optional{std::chrono::steady_clock::now() + timeout} : std::nullopt) {}
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+bool CancellationToken::is_cancelled() const { return _cancelled || _timed_out(); }
+
+void CancellationToken::throw_if_cancelled() const {
+  // Messages as used by PostgreSQL
+  if (_cancelled) throw QueryCancelledException("canceling statement due to user request");
+  if (_timed_out()) throw QueryCancelledException("canceling statement due to statement timeout");
+}
+
+bool CancellationToken::_timed_out() const { return _deadline && std::chrono::steady_clock::now() >= *_deadline; }
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thrown by SQLPipelineStatement::get_result_table() (and the server's prepared statement execution) if the statement
+ * was cancelled before it finished. The transaction of the statement has been rolled back.
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what_arg) : std::runtime_error(what_arg) {}
+};
+
+/**
+ * Cooperative cancellation of a query, either explicitly through cancel() or once its timeout has passed.
+ *
+ * The token is set on the OperatorTasks of the query and inherited by the tasks they schedule (see AbstractTask).
+ * Operators of a cancelled query are skipped. Long-running operators (e.g., JoinHash, Aggregate, Sort, TableScan, and
+ * JoinSortMerge) additionally check AbstractTask::is_current_task_cancelled() between chunks and jobs and stop early.
+ * Their (incomplete) outputs are discarded.
+ */
+class CancellationToken : private Noncopyable {
+ public:
+  CancellationToken() = default;
+
+  // The token is cancelled once @param timeout has passed. A timeout of zero disables it.
+  explicit CancellationToken(const std::chrono::milliseconds timeout);
+
+  void cancel();
+  bool is_cancelled() const;
+
+  // Throws a QueryCancelledException that names the reason for the cancellation, if the token has been cancelled
+  void throw_if_cancelled() const;
+
+ protected:
+  bool _timed_out() const;
+
+  std::atomic_bool _cancelled{false};
+  const std::optional<std::chrono::steady_clock::time_point> _deadline;
+};
+
+}  // namespace opossum
@@ -10,7 +10,10 @@
 #include "operators/abstract_read_write_operator.hpp"
 
 #include "scheduler/job_task.hpp"
+#include "scheduler/query_memory_usage.hpp"
 #include "scheduler/worker.hpp"
+#include "scheduler/workload_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -40,14 +43,18 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
   task_by_op.emplace(op, task);
 
+  // An operator that uses the same input twice (e.g., a self join) is registered as two consumers and also deregisters
+  // twice, as it is added twice to the successors of the input's task
   if (auto left = op->mutable_input_left()) {
     auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
     subtree_root->set_as_predecessor_of(task);
+    if (cleanup_temporaries == CleanupTemporaries::Yes) left->register_consumer();
   }
 
   if (auto right = op->mutable_input_right()) {
     auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
     subtree_root->set_as_predecessor_of(task);
+    if (cleanup_temporaries == CleanupTemporaries::Yes) right->register_consumer();
   }
 
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
@@ -58,6 +65,10 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+void OperatorTask::set_query_memory_usage(const std::shared_ptr<QueryMemoryUsage>& query_memory_usage) {
+  _query_memory_usage = query_memory_usage;
+}
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -82,8 +93,11 @@ void OperatorTask::_on_execute() {
     }
   }
 
-  DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  // The operators of a cancelled query are skipped, but the outputs of their inputs are still released below
+  if (!is_current_task_cancelled()) {
+    DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -96,24 +110,37 @@ void OperatorTask::_on_execute() {
     context->rollback();
   }
 
-  // Get rid of temporary tables that are not needed anymore
-  // Because `clear_output` is only called by the successive OperatorTasks, we can be sure that no one cleans up the
-  // root (i.e., the final result)
+  // Account the intermediate result to the query for the admission control of the WorkloadManager and for the peak
+  // memory metric. The outputs of GetTable and TableWrapper are tables that exist anyway, so their memory usage is not
+  // recorded.
+  const auto& query_group = this->query_group();
+  const auto& output_memory_usage = _op->performance_data().output_memory_usage;
+  if ((query_group || _query_memory_usage) && output_memory_usage) {
+    _accounted_memory_usage = *output_memory_usage;
+    if (query_group) query_group->increase_memory_usage(*output_memory_usage);
+    if (_query_memory_usage) _query_memory_usage->increase(*output_memory_usage);
+  }
+
+  // Get rid of temporary tables that are not needed anymore. Every input counts its consumers (see
+  // _add_tasks_from_operator), so the last of them clears the output, even if several consumers finish concurrently.
+  // The root (i.e., the final result) has no consumers and is never cleared.
+  // If someone else still holds a shared_ptr to the table (e.g., a ReferenceSegment pointing to a materialized
+  // temporary table), it will not yet get deleted.
   if (_cleanup_temporaries == CleanupTemporaries::Yes) {
     for (const auto& weak_predecessor : predecessors()) {
       const auto predecessor = std::dynamic_pointer_cast<OperatorTask>(weak_predecessor.lock());
       DebugAssert(predecessor != nullptr, "predecessor of OperatorTask is not an OperatorTask itself");
-      auto previous_operator_still_needed = false;
-
-      for (const auto& successor : predecessor->successors()) {
-        if (successor.get() != this && !successor->is_done()) {
-          previous_operator_still_needed = true;
-        }
+      if (predecessor->get_operator()->deregister_consumer()) {
+        predecessor->_release_accounted_memory_usage();
       }
-      // If someone else still holds a shared_ptr to the table (e.g., a ReferenceSegment pointing to a materialized
-      // temporary table), it will not yet get deleted
-      if (!previous_operator_still_needed) predecessor->get_operator()->clear_output();
     }
   }
 }
+
+void OperatorTask::_release_accounted_memory_usage() {
+  const auto accounted_memory_usage = _accounted_memory_usage.exchange(0);
+  if (const auto& query_group = this->query_group()) query_group->decrease_memory_usage(accounted_memory_usage);
+  if (_query_memory_usage) _query_memory_usage->decrease(accounted_memory_usage);
+}
+
 }  // namespace opossum
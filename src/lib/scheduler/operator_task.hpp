@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -9,6 +10,7 @@
 namespace opossum {
 
 class AbstractOperator;
+class QueryMemoryUsage;
 
 /**
  * Makes an AbstractOperator scheduleable
@@ -21,6 +23,8 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   * With CleanupTemporaries::Yes, every task is registered as a consumer of its inputs, so that their outputs are
+   * cleared as soon as all consuming tasks are done.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
       const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
@@ -29,9 +33,15 @@ class OperatorTask : public AbstractTask {
 
   std::string description() const override;
 
+  // Sets the tracker to which the size of the operator's output is accounted until the output is released
+  void set_query_memory_usage(const std::shared_ptr<QueryMemoryUsage>& query_memory_usage);
+
  protected:
   void _on_execute() override;
 
+  // Removes the output of the operator, which was cleared after its last consumer finished, from the memory accounting
+  void _release_accounted_memory_usage();
+
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
    * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
@@ -44,5 +54,9 @@ class OperatorTask : public AbstractTask {
  private:
   std::shared_ptr<AbstractOperator> _op;
   CleanupTemporaries _cleanup_temporaries;
+  std::shared_ptr<QueryMemoryUsage> _query_memory_usage;
+
+  // Size of the output that is accounted to the QueryGroup and QueryMemoryUsage, if any, until the output is cleared
+  std::atomic<size_t> _accounted_memory_usage{0};
 };
 }  // namespace opossum
@@ -0,0 +1,25 @@
+#include "query_memory_usage.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t QueryMemoryUsage::current() const { return _current; }
+
+size_t QueryMemoryUsage::peak() const { return _peak; }
+
+void QueryMemoryUsage::increase(const size_t bytes) {
+  const auto current = _current += bytes;
+
+  // Other tasks of the query might raise the peak concurrently, so only replace it if it is still smaller
+  auto peak = _peak.load();
+  while (peak < current && !_peak.compare_exchange_weak(peak, current)) {
+  }
+}
+
+void QueryMemoryUsage::decrease(const size_t bytes) {
+  DebugAssert(_current >= bytes, "Memory usage of query would become negative");
+  _current -= bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <atomic>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Tracks the estimated size of the intermediate results that the operators of a single query currently hold, in bytes,
+ * and the peak of that size during the execution. OperatorTasks increase it when their operator has executed and
+ * decrease it when the output is released after its last consumer finished (see AbstractOperator::register_consumer).
+ * As in the WorkloadManager, the outputs of GetTable and TableWrapper are not counted, as those tables exist anyway.
+ */
+class QueryMemoryUsage : private Noncopyable {
+ public:
+  size_t current() const;
+  size_t peak() const;
+
+  void increase(const size_t bytes);
+  void decrease(const size_t bytes);
+
+ private:
+  std::atomic<size_t> _current{0};
+  std::atomic<size_t> _peak{0};
+};
+
+}  // namespace opossum
@@ -1,10 +1,14 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
+#include <vector>
 
 #include "abstract_task.hpp"
 #include "utils/assert.hpp"
+#include "workload_manager.hpp"
 
 namespace opossum {
 
@@ -14,7 +18,7 @@ bool TaskQueue::empty() const {
   for (const auto& queue : _queues) {
     if (!queue.empty()) return false;
   }
-  return true;
+  return _query_group_task_count == 0;
 }
 
 NodeID TaskQueue::node_id() const { return _node_id; }
@@ -26,7 +30,20 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+
+  if (const auto& query_group = task->query_group()) {
+    std::lock_guard<std::mutex> query_group_lock(_query_group_mutex);
+    auto iter = std::find_if(_query_group_queues.begin(), _query_group_queues.end(), [&](const auto& group_queue) {
+      return group_queue.query_group == query_group;
+    });
+    if (iter == _query_group_queues.end()) {
+      iter = _query_group_queues.insert(iter, QueryGroupQueue{query_group, _current_pass, {}});
+    }
+    iter->queues[priority].push_back(task);
+    ++_query_group_task_count;
+  } else {
+    _queues[priority].push(task);
+  }
 
   new_task.notify_one();
 }
@@ -38,7 +55,9 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
       return task;
     }
   }
-  return nullptr;
+
+  if (_query_group_task_count == 0) return nullptr;
+  return _pull_from_query_groups(false);
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
@@ -52,6 +71,46 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
       }
     }
   }
+
+  if (_query_group_task_count == 0) return nullptr;
+  return _pull_from_query_groups(true);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::_pull_from_query_groups(const bool stealable_only) {
+  std::lock_guard<std::mutex> query_group_lock(_query_group_mutex);
+
+  // There are usually few concurrent queries, so sorting them is cheaper than maintaining a heap. On equal passes, the
+  // group that entered the queue first is served first.
+  auto group_order = std::vector<size_t>(_query_group_queues.size());
+  std::iota(group_order.begin(), group_order.end(), size_t{0});
+  std::stable_sort(group_order.begin(), group_order.end(), [&](const auto lhs, const auto rhs) {
+    return _query_group_queues[lhs].pass < _query_group_queues[rhs].pass;
+  });
+
+  for (const auto group_idx : group_order) {
+    auto& query_group_queue = _query_group_queues[group_idx];
+
+    for (auto& queue : query_group_queue.queues) {
+      const auto task_iter = stealable_only ? std::find_if(queue.begin(), queue.end(),
+                                                           [](const auto& task) { return task->is_stealable(); })
+                                            : queue.begin();
+      if (task_iter == queue.end()) continue;
+
+      auto task = *task_iter;
+      queue.erase(task_iter);
+      --_query_group_task_count;
+
+      _current_pass = query_group_queue.pass;
+      query_group_queue.pass += query_group_queue.query_group->stride();
+
+      const auto group_is_empty = std::all_of(query_group_queue.queues.begin(), query_group_queue.queues.end(),
+                                              [](const auto& group_queue) { return group_queue.empty(); });
+      if (group_is_empty) _query_group_queues.erase(_query_group_queues.begin() + group_idx);
+
+      return task;
+    }
+  }
+
   return nullptr;
 }
 
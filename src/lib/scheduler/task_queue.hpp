@@ -5,16 +5,27 @@
 #include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class QueryGroup;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Tasks without a QueryGroup are kept in lock-free queues and are pulled first. Tasks of QueryGroups (i.e., of queries
+ * admitted by the WorkloadManager) are kept per group and pulled using stride scheduling: each group has a pass value
+ * that advances by the group's stride (inverse to the weight of its WorkloadClass) whenever one of its tasks is pulled.
+ * The group with the smallest pass is served next. A group that (re-)enters the queue starts at the pass of the
+ * group served last. Thus, a newly arriving short query is served at the next task boundary instead of waiting for the
+ * tasks that a long-running query has queued, and concurrent queries share the Workers according to their weights.
  */
 class TaskQueue {
  public:
@@ -51,6 +62,24 @@ class TaskQueue {
  private:
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+
+  // The tasks of one QueryGroup in this TaskQueue
+  struct QueryGroupQueue {
+    std::shared_ptr<QueryGroup> query_group;
+    uint64_t pass;
+    std::array<std::deque<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> queues;
+  };
+
+  // Removes the next task of the group with the smallest pass. If stealable_only is set, groups without a stealable
+  // task are skipped.
+  std::shared_ptr<AbstractTask> _pull_from_query_groups(const bool stealable_only);
+
+  std::mutex _query_group_mutex;
+  std::vector<QueryGroupQueue> _query_group_queues;
+  uint64_t _current_pass{0};
+
+  // Allows pull() to skip the mutex if no task of a QueryGroup is queued
+  std::atomic<size_t> _query_group_task_count{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,132 @@
+#include "workload_manager.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+QueryGroup::QueryGroup(const std::string& workload_class_name, const uint32_t weight)
+    : _workload_class_name(workload_class_name), _stride(STRIDE_BASE / std::max(weight, uint32_t{1})) {}
+
+const std::string& QueryGroup::workload_class_name() const { return _workload_class_name; }
+
+uint64_t QueryGroup::stride() const { return _stride; }
+
+size_t QueryGroup::memory_usage() const { return _memory_usage; }
+
+void QueryGroup::increase_memory_usage(const size_t bytes) { _memory_usage += bytes; }
+
+void QueryGroup::decrease_memory_usage(const size_t bytes) {
+  DebugAssert(_memory_usage >= bytes, "Memory usage of QueryGroup would become negative");
+  _memory_usage -= bytes;
+}
+
+QueryAdmission::QueryAdmission(WorkloadManager& workload_manager, const std::shared_ptr<QueryGroup>& query_group)
+    : _workload_manager(workload_manager), _query_group(query_group) {}
+
+QueryAdmission::~QueryAdmission() { _workload_manager._release(_query_group); }
+
+const std::shared_ptr<QueryGroup>& QueryAdmission::query_group() const { return _query_group; }
+
+void WorkloadManager::add_workload_class(const WorkloadClass& workload_class) {
+  Assert(!workload_class.name.empty(), "WorkloadClass needs a name");
+  Assert(workload_class.weight > 0, "Weight of a WorkloadClass must be positive");
+  Assert(workload_class.max_concurrent_queries > 0, "WorkloadClass must admit at least one query");
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _workload_classes[workload_class.name].workload_class = workload_class;
+    _enabled = true;
+  }
+
+  // The limits might have been raised
+  _query_released.notify_all();
+}
+
+bool WorkloadManager::has_workload_class(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _workload_classes.count(name);
+}
+
+bool WorkloadManager::is_enabled() const { return _enabled; }
+
+std::unique_ptr<QueryAdmission> WorkloadManager::admit(const std::string& workload_class_name) {
+  const auto& name = workload_class_name.empty() ? DEFAULT_WORKLOAD_CLASS : workload_class_name;
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  auto& state = _state(name);
+  _query_released.wait(lock, [&]() { return _can_admit(state); });
+
+  const auto query_group = std::make_shared<QueryGroup>(name, state.workload_class.weight);
+  state.running_queries.emplace_back(query_group);
+
+  return std::make_unique<QueryAdmission>(*this, query_group);
+}
+
+size_t WorkloadManager::running_query_count(const std::string& workload_class_name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto iter = _workload_classes.find(workload_class_name);
+  return iter != _workload_classes.end() ? iter->second.running_queries.size() : 0;
+}
+
+size_t WorkloadManager::memory_usage(const std::string& workload_class_name) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto iter = _workload_classes.find(workload_class_name);
+  if (iter == _workload_classes.end()) return 0;
+
+  auto memory_usage = size_t{0};
+  for (const auto& query_group : iter->second.running_queries) {
+    memory_usage += query_group->memory_usage();
+  }
+  return memory_usage;
+}
+
+void WorkloadManager::reset() {
+  auto& workload_manager = get();
+  std::lock_guard<std::mutex> lock(workload_manager._mutex);
+  for ([[maybe_unused]] const auto& [name, state] : workload_manager._workload_classes) {
+    DebugAssert(state.running_queries.empty(), "Cannot reset the WorkloadManager while queries are admitted");
+  }
+
+  workload_manager._workload_classes.clear();
+  workload_manager._enabled = false;
+}
+
+void WorkloadManager::_release(const std::shared_ptr<QueryGroup>& query_group) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& running_queries = _state(query_group->workload_class_name()).running_queries;
+    const auto iter = std::find(running_queries.begin(), running_queries.end(), query_group);
+    DebugAssert(iter != running_queries.end(), "QueryGroup was not admitted");
+    running_queries.erase(iter);
+  }
+
+  // Waiting queries might belong to different classes, so all of them have to check their limits
+  _query_released.notify_all();
+}
+
+bool WorkloadManager::_can_admit(const WorkloadClassState& state) const {
+  if (state.running_queries.empty()) return true;
+  if (state.running_queries.size() >= state.workload_class.max_concurrent_queries) return false;
+
+  auto memory_usage = size_t{0};
+  for (const auto& query_group : state.running_queries) {
+    memory_usage += query_group->memory_usage();
+  }
+  return memory_usage < state.workload_class.memory_budget;
+}
+
+WorkloadManager::WorkloadClassState& WorkloadManager::_state(const std::string& workload_class_name) {
+  auto iter = _workload_classes.find(workload_class_name);
+  if (iter == _workload_classes.end()) {
+    Assert(workload_class_name == DEFAULT_WORKLOAD_CLASS, "Unknown WorkloadClass '" + workload_class_name + "'");
+    iter = _workload_classes.emplace(workload_class_name, WorkloadClassState{WorkloadClass{workload_class_name}, {}})
+               .first;
+  }
+  return iter->second;
+}
+
+}  // namespace opossum
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Configuration of a class of queries, e.g., latency-critical point queries or analytical reports.
+ */
+struct WorkloadClass {
+  std::string name;
+
+  // Share of the workers that the queries of this class receive relative to other running queries. A query of a class
+  // with weight 4 is scheduled four times as often as one with weight 1 (see TaskQueue).
+  uint32_t weight{1};
+
+  // Queries beyond this limit wait for a running query of the class to finish before they are executed
+  size_t max_concurrent_queries{std::numeric_limits<size_t>::max()};
+
+  // No further query is admitted while the intermediate results of the running queries of this class (see
+  // QueryGroup::memory_usage()) exceed this number of bytes
+  size_t memory_budget{std::numeric_limits<size_t>::max()};
+};
+
+/**
+ * Groups the tasks of one admitted query. Tasks of a QueryGroup are scheduled fairly with the tasks of other
+ * QueryGroups, weighted by their WorkloadClass. Tasks scheduled by a task of a QueryGroup (e.g., the JobTasks spawned by
+ * an operator) become part of the same group.
+ */
+class QueryGroup : private Noncopyable {
+ public:
+  // Scheduling a task advances the pass of its group by STRIDE_BASE / weight
+  static constexpr uint64_t STRIDE_BASE = 1u << 20u;
+
+  QueryGroup(const std::string& workload_class_name, const uint32_t weight);
+
+  const std::string& workload_class_name() const;
+
+  uint64_t stride() const;
+
+  // Estimated size of the intermediate results that are currently held by the operators of this query, in bytes
+  size_t memory_usage() const;
+  void increase_memory_usage(const size_t bytes);
+  void decrease_memory_usage(const size_t bytes);
+
+ private:
+  const std::string _workload_class_name;
+  const uint64_t _stride;
+  std::atomic<size_t> _memory_usage{0};
+};
+
+class WorkloadManager;
+
+/**
+ * Represents the admission of a query to its WorkloadClass. The query counts towards the limits of the class until this
+ * object is destroyed.
+ */
+class QueryAdmission : private Noncopyable {
+ public:
+  QueryAdmission(WorkloadManager& workload_manager, const std::shared_ptr<QueryGroup>& query_group);
+  ~QueryAdmission();
+
+  const std::shared_ptr<QueryGroup>& query_group() const;
+
+ private:
+  WorkloadManager& _workload_manager;
+  const std::shared_ptr<QueryGroup> _query_group;
+};
+
+/**
+ * Assigns queries to WorkloadClasses and limits the number and the memory usage of the concurrently running queries of
+ * each class (admission control). Queries that exceed a limit wait in admit() until a query of their class finishes.
+ * A query is always admitted if no other query of its class is running, even if it exceeds the memory budget.
+ *
+ * The WorkloadManager is disabled until a WorkloadClass is added, so that queries are neither grouped nor limited by
+ * default. Queries that do not name a class are assigned to the class DEFAULT_WORKLOAD_CLASS, which is not limited
+ * unless it is added explicitly.
+ *
+ * admit() blocks the calling thread. Thus, queries should not be admitted from within a task executed by a Worker, as
+ * all Workers might end up waiting for each other.
+ */
+class WorkloadManager : public Singleton<WorkloadManager> {
+ public:
+  inline static const std::string DEFAULT_WORKLOAD_CLASS = "default";
+
+  // Adds or replaces a WorkloadClass. Running queries keep the weight of the class they were admitted with.
+  void add_workload_class(const WorkloadClass& workload_class);
+  bool has_workload_class(const std::string& name) const;
+
+  bool is_enabled() const;
+
+  // Blocks until the query can be admitted to the named class. An empty name selects DEFAULT_WORKLOAD_CLASS.
+  std::unique_ptr<QueryAdmission> admit(const std::string& workload_class_name = "");
+
+  size_t running_query_count(const std::string& workload_class_name) const;
+
+  // Summed memory usage of the running queries of the class
+  size_t memory_usage(const std::string& workload_class_name) const;
+
+  // Removes all WorkloadClasses. Must not be called while queries are admitted.
+  static void reset();
+
+ protected:
+  friend class Singleton;
+  friend class QueryAdmission;
+
+  WorkloadManager() = default;
+
+  struct WorkloadClassState {
+    WorkloadClass workload_class;
+    std::vector<std::shared_ptr<QueryGroup>> running_queries;
+  };
+
+  void _release(const std::shared_ptr<QueryGroup>& query_group);
+
+  // Returns true if a further query can be admitted to the class. Expects _mutex to be locked.
+  bool _can_admit(const WorkloadClassState& state) const;
+
+  // Expects _mutex to be locked. DEFAULT_WORKLOAD_CLASS is created on first use.
+  WorkloadClassState& _state(const std::string& workload_class_name);
+
+  mutable std::mutex _mutex;
+  std::condition_variable _query_released;
+  std::unordered_map<std::string, WorkloadClassState> _workload_classes;
+  std::atomic_bool _enabled{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#include "cancel_request_registry.hpp"
+
+#include <memory>
+#include <mutex>
+#include <random>
+
+#include "scheduler/cancellation_token.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CancelRequestRegistry::CancelRequestRegistry() : _generator(std::random_device()()) {}
+
+BackendKey CancelRequestRegistry::register_session() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto backend_key = BackendKey{_next_process_id++, static_cast<uint32_t>(_generator())};
+  _sessions.emplace(backend_key.process_id, Session{backend_key.secret_key, nullptr});
+  return backend_key;
+}
+
+void CancelRequestRegistry::unregister_session(const uint32_t process_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _sessions.erase(process_id);
+}
+
+void CancelRequestRegistry::set_running_statement(const uint32_t process_id,
+                                                  const std::shared_ptr<CancellationToken>& cancellation_token) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto iter = _sessions.find(process_id);
+  DebugAssert(iter != _sessions.end(), "Session was not registered");
+  iter->second.running_statement = cancellation_token;
+}
+
+bool CancelRequestRegistry::cancel(const BackendKey& backend_key) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto iter = _sessions.find(backend_key.process_id);
+  if (iter == _sessions.end() || iter->second.secret_key != backend_key.secret_key) return false;
+
+  if (iter->second.running_statement) iter->second.running_statement->cancel();
+  return true;
+}
+
+}  // namespace opossum
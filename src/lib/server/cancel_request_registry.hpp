@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class CancellationToken;
+
+// Identifies a session towards the client. It is sent as BackendKeyData during the startup and has to be repeated by
+// the client in a CancelRequest.
+struct BackendKey {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
+/**
+ * Keeps track of the statements that are currently running in the sessions of the server, so that they can be
+ * cancelled by a PostgreSQL CancelRequest. Such a request is sent on a new connection, which is why the sessions have to
+ * be looked up globally.
+ */
+class CancelRequestRegistry : public Singleton<CancelRequestRegistry> {
+ public:
+  // Returns a new key for the session. The secret key is random, so that clients cannot cancel the statements of other
+  // clients by guessing the process id.
+  BackendKey register_session();
+  void unregister_session(const uint32_t process_id);
+
+  // Sets the token of the statement that the session currently executes. Passing nullptr clears it.
+  void set_running_statement(const uint32_t process_id, const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  // Cancels the running statement of the session. Returns false if the key is unknown or the secret key does not match,
+  // in which case the request is ignored (as in PostgreSQL).
+  bool cancel(const BackendKey& backend_key);
+
+ protected:
+  friend class Singleton;
+
+  CancelRequestRegistry();
+
+  struct Session {
+    uint32_t secret_key;
+    std::shared_ptr<CancellationToken> running_statement;
+  };
+
+  std::mutex _mutex;
+  std::unordered_map<uint32_t, Session> _sessions;
+  uint32_t _next_process_id{1};
+  std::mt19937 _generator;
+};
+
+}  // namespace opossum
@@ -2,6 +2,10 @@
 
 #include <boost/asio.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "postgres_wire_handler.hpp"
 #include "then_operator.hpp"
 #include "use_boost_future.hpp"
@@ -29,6 +33,13 @@ boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size)
   };
 }
 
+boost::future<CancelRequestPacket> ClientConnection::receive_cancel_request_body() {
+  // The process id and the secret key of the session whose statement should be cancelled
+  constexpr uint32_t CANCEL_REQUEST_BODY_LENGTH = 8u;
+
+  return _receive_bytes_async(CANCEL_REQUEST_BODY_LENGTH) >> then >> PostgresWireHandler::handle_cancel_request_packet;
+}
+
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
   constexpr uint32_t HEADER_LENGTH = 5u;
 
@@ -65,6 +76,10 @@ boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_
   return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
 }
 
+boost::future<void> ClientConnection::discard_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+}
+
 boost::future<void> ClientConnection::send_ssl_denied() {
   // Don't use new_output_packet here, because this packet has special size requirements (only contains N, no size)
   auto output_packet = std::make_shared<OutputPacket>();
@@ -80,6 +95,14 @@ boost::future<void> ClientConnection::send_auth() {
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
+boost::future<void> ClientConnection::send_backend_key_data(uint32_t process_id, uint32_t secret_key) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::BackendKeyData);
+  PostgresWireHandler::write_value(*output_packet, htonl(process_id));
+  PostgresWireHandler::write_value(*output_packet, htonl(secret_key));
+
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
 boost::future<void> ClientConnection::send_parameter_status(const std::string& key, const std::string& value) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ParameterStatus);
   PostgresWireHandler::write_string(*output_packet, key);
@@ -116,7 +139,7 @@ boost::future<void> ClientConnection::send_notice(const std::string& notice) {
 
   // Terminate the notice response
   PostgresWireHandler::write_value(*output_packet, '\0');
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
 boost::future<void> ClientConnection::send_status_message(const NetworkMessageType& type) {
@@ -174,65 +197,82 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
-
-  /*
-  DataRow (B)
-  Byte1('D')
-  Identifies the message as a data row.
-
-  Int32
-  Length of message contents in bytes, including self.
-
-  Int16
-  The number of column values that follow (possibly zero).
-
-  Next, the following pair of fields appear for each column:
-
-  Int32
-  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
-  -1 indicates a NULL column value. No value bytes follow in the NULL case.
-
-  Byte n
-  The value of the column, in the format indicated by the associated format code. n is the above length.
-  */
-
-  // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
-
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
+boost::future<void> ClientConnection::send_data_rows(
+    const std::shared_ptr<const std::vector<OutputPacket>>& data_rows) {
+  auto data_rows_size = size_t{0};
+  for (const auto& packet : *data_rows) {
+    data_rows_size += packet.data.size();
+  }
 
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
+  // Small results (e.g., of point queries) are buffered with the other messages, so that they are sent at once
+  if (_response_buffer.size() + data_rows_size <= _max_response_size) {
+    for (const auto& packet : *data_rows) {
+      _response_buffer.insert(_response_buffer.end(), packet.data.begin(), packet.data.end());
+    }
+    return boost::make_ready_future();
   }
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  // The messages that are still buffered have to be sent first
+  auto flush = _response_buffer.empty() ? boost::make_ready_future<uint64_t>(0) : _flush_async();
+
+  // The encoded rows are sent as they are instead of being copied into the response buffer. We need a copy of this
+  // client connection and the rows to outlive the async operation.
+  auto self = shared_from_this();
+  return std::move(flush) >> then >> [self, data_rows](uint64_t) {
+    auto buffers = std::vector<boost::asio::const_buffer>{};
+    buffers.reserve(data_rows->size());
+    for (const auto& packet : *data_rows) {
+      buffers.emplace_back(boost::asio::buffer(packet.data));
+    }
+    return boost::asio::async_write(self->_socket, buffers, boost::asio::use_boost_future);
+  } >> then >> [self, data_rows](uint64_t) {};
 }
 
 boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
   PostgresWireHandler::write_string(*output_packet, message);
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
+boost::future<void> ClientConnection::flush() {
+  if (_response_buffer.empty()) return boost::make_ready_future();
+  return _flush_async() >> then >> ignore_sent_bytes;
 }
 
 boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
-  auto result = std::make_shared<InputPacket>();
-  result->data.resize(size);
+  const auto buffered_size = _read_buffer.size() - _read_buffer_offset;
+
+  const auto take_from_buffer = [](const std::shared_ptr<ClientConnection>& self, const size_t size) {
+    auto result = InputPacket{};
+    const auto begin = self->_read_buffer.cbegin() + self->_read_buffer_offset;
+    result.data.assign(begin, begin + size);
+    result.offset = result.data.begin();
+    self->_read_buffer_offset += size;
+    return result;
+  };
 
   // We need a copy of this client connection to outlive the async operation
   auto self = shared_from_this();
-  return _socket.async_read_some(boost::asio::buffer(result->data, size), boost::asio::use_boost_future) >> then >>
-         [self, result, size](uint64_t received_size) {
-           // If this assertion should fail, we will end up in either the error handler for the current command or
-           // the entire session. The connection may be closed but the server will keep running either way.
-           Assert(received_size == size, "Client sent less data than expected.");
-
-           result->offset = result->data.begin();
-           return std::move(*result);
+
+  // Pipelined messages are served from the buffer
+  if (buffered_size >= size) return boost::make_ready_future(take_from_buffer(self, size));
+
+  // Move the remaining bytes to the front and read (at least) the missing ones
+  _read_buffer.erase(_read_buffer.begin(), _read_buffer.begin() + _read_buffer_offset);
+  _read_buffer_offset = 0;
+  const auto missing_size = size - buffered_size;
+  _read_buffer.resize(buffered_size + std::max(missing_size, static_cast<size_t>(_min_read_size)));
+
+  // If the client closes the connection before sending the missing bytes, async_read fails and we will end up in either
+  // the error handler for the current command or the entire session. The server will keep running either way.
+  return boost::asio::async_read(_socket,
+                                 boost::asio::buffer(_read_buffer.data() + buffered_size,
+                                                     _read_buffer.size() - buffered_size),
+                                 boost::asio::transfer_at_least(missing_size), boost::asio::use_boost_future) >>
+         then >> [self, take_from_buffer, buffered_size, size](uint64_t received_size) {
+           self->_read_buffer.resize(buffered_size + received_size);
+           return take_from_buffer(self, size);
          };
 }
 
@@ -13,6 +13,7 @@ struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
+struct CancelRequestPacket;
 enum class NetworkMessageType : unsigned char;
 
 struct ColumnDescription {
@@ -23,13 +24,19 @@ struct ColumnDescription {
 
 // This class provides a wrapper over the TCP socket and (de)serializes
 // network messages using the PostgresWireHandler. It's a very thin wrapper
-// because the ASIO socket is hard to mock, so there are no tests for this class
+// because the ASIO socket is hard to mock, so there are no tests for this class.
+//
+// Clients may pipeline their messages, i.e., send several messages without waiting for the replies. Incoming bytes are
+// therefore read into a buffer that holds as many messages as are available, from which the following receive calls
+// are served without touching the socket. Likewise, outgoing messages are buffered and only sent when a message that
+// the client waits for (ReadyForQuery, an explicit flush) is sent or the buffer is full.
 class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
  public:
   explicit ClientConnection(boost::asio::ip::tcp::socket socket);
 
   boost::future<uint32_t> receive_startup_packet_header();
   boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<CancelRequestPacket> receive_cancel_request_body();
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
@@ -39,18 +46,25 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
   boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  // Reads the body of a message that is ignored, e.g., after an error in the extended query protocol
+  boost::future<void> discard_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
+  boost::future<void> send_backend_key_data(uint32_t process_id, uint32_t secret_key);
   boost::future<void> send_parameter_status(const std::string& key, const std::string& value);
   boost::future<void> send_ready_for_query();
   boost::future<void> send_error(const std::string& message);
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+  // Sends the DataRow messages encoded by an EncodeServerQueryResultTask
+  boost::future<void> send_data_rows(const std::shared_ptr<const std::vector<OutputPacket>>& data_rows);
   boost::future<void> send_command_complete(const std::string& message);
 
+  // Sends all buffered messages
+  boost::future<void> flush();
+
  protected:
   boost::future<InputPacket> _receive_bytes_async(size_t size);
 
@@ -62,6 +76,12 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   // Max 2048 bytes per IP packet sent
   uint32_t _max_response_size = 2048;
   ByteBuffer _response_buffer;
+
+  // Bytes that were received but not yet consumed start at _read_buffer_offset. Each read from the socket asks for at
+  // least _min_read_size bytes, so that pipelined messages are received at once.
+  uint32_t _min_read_size = 4096;
+  ByteBuffer _read_buffer;
+  size_t _read_buffer_offset{0};
 };
 
 }  // namespace opossum
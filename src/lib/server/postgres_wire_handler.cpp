@@ -26,6 +26,9 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   // Special SSL version number that we catch to deny SSL support
   if (version == 80877103) {
     return 0;
+  } else if (version == 80877102) {
+    // Special version number of a CancelRequest, which is sent on a new connection
+    return CANCEL_REQUEST;
   } else {
     // Subtract read bytes from total length
     return length - (2 * sizeof(uint32_t));
@@ -37,6 +40,12 @@ void PostgresWireHandler::handle_startup_package_content(const InputPacket& pack
   read_values<char>(packet, packet.data.size());
 }
 
+CancelRequestPacket PostgresWireHandler::handle_cancel_request_packet(const InputPacket& packet) {
+  const auto process_id = ntohl(read_value<uint32_t>(packet));
+  const auto secret_key = ntohl(read_value<uint32_t>(packet));
+  return {process_id, secret_key};
+}
+
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
   auto tag = read_value<NetworkMessageType>(packet);
 
@@ -140,6 +149,50 @@ void PostgresWireHandler::write_output_packet_size(OutputPacket& packet) {
   }
 }
 
+void PostgresWireHandler::write_data_row(OutputPacket& packet, const std::vector<std::string>& row_strings) {
+  /*
+  DataRow (B)
+  Byte1('D')
+  Identifies the message as a data row.
+
+  Int32
+  Length of message contents in bytes, including self.
+
+  Int16
+  The number of column values that follow (possibly zero).
+
+  Next, the following pair of fields appear for each column:
+
+  Int32
+  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
+  -1 indicates a NULL column value. No value bytes follow in the NULL case.
+
+  Byte n
+  The value of the column, in the format indicated by the associated format code. n is the above length.
+  */
+
+  const auto message_begin = packet.data.size();
+
+  write_value(packet, NetworkMessageType::DataRow);
+  // Placeholder for the size, which is known once the values are written
+  write_value(packet, htonl(0u));
+
+  // Number of columns in row
+  write_value(packet, htons(static_cast<uint16_t>(row_strings.size())));
+
+  for (const auto& value_string : row_strings) {
+    // Size of string representation of value, NOT of value type's size
+    write_value(packet, htonl(static_cast<uint32_t>(value_string.length())));
+
+    // Text mode means that all values are sent as non-terminated strings
+    write_string(packet, value_string, false);
+  }
+
+  // - 1 because the message type byte does not contribute to the size
+  auto total_bytes = htonl(static_cast<uint32_t>(packet.data.size() - message_begin - 1));
+  std::copy_n(reinterpret_cast<char*>(&total_bytes), sizeof(total_bytes), packet.data.begin() + message_begin + 1);
+}
+
 std::string PostgresWireHandler::read_string(const InputPacket& packet) {
   if (packet.offset == packet.data.cend()) return "";
 
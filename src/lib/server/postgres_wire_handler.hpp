@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <algorithm>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -45,13 +46,23 @@ struct BindPacket {
   std::vector<AllTypeVariant> params;
 };
 
+struct CancelRequestPacket {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
 class PostgresWireHandler {
  public:
+  // Returned by handle_startup_package() instead of the length of the remaining packet if the client sent a
+  // CancelRequest, whose remaining packet is handled by handle_cancel_request_packet()
+  static constexpr uint32_t CANCEL_REQUEST = std::numeric_limits<uint32_t>::max();
+
   static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
   static void write_output_packet_size(OutputPacket& packet);
 
   static uint32_t handle_startup_package(const InputPacket& packet);
   static void handle_startup_package_content(const InputPacket& packet);
+  static CancelRequestPacket handle_cancel_request_packet(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
@@ -73,6 +84,10 @@ class PostgresWireHandler {
   static void write_value(OutputPacket& packet, T value);
 
   static void write_string(OutputPacket& packet, const std::string& value, bool terminate = true);
+
+  // Appends a complete DataRow message (including its size) with the values in text format to the packet. This allows
+  // encoding the rows of a result into one packet.
+  static void write_data_row(OutputPacket& packet, const std::vector<std::string>& row_strings);
 };
 
 template <typename T>
@@ -1,7 +1,7 @@
 #include "server.hpp"
 
-#include <boost/asio/placeholders.hpp>
-#include <boost/bind.hpp>
+#include <memory>
+#include <thread>
 
 #include "client_connection.hpp"
 #include "server_session.hpp"
@@ -12,29 +12,63 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port, size_t io_thread_count)
     : _io_service(io_service),
-      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
+  _session_io_services.reserve(io_thread_count);
+  _session_io_service_works.reserve(io_thread_count);
+  _io_threads.reserve(io_thread_count);
+  for (auto thread_id = size_t{0}; thread_id < io_thread_count; ++thread_id) {
+    auto& session_io_service = *_session_io_services.emplace_back(std::make_unique<boost::asio::io_service>());
+    _session_io_service_works.emplace_back(std::make_unique<boost::asio::io_service::work>(session_io_service));
+    _io_threads.emplace_back([&session_io_service]() { session_io_service.run(); });
+  }
+
   _accept_next_connection();
 }
 
+Server::~Server() {
+  _session_io_service_works.clear();
+  for (auto& session_io_service : _session_io_services) {
+    session_io_service->stop();
+  }
+  for (auto& io_thread : _io_threads) {
+    io_thread.join();
+  }
+}
+
 void Server::_accept_next_connection() {
-  _acceptor.async_accept(_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
+  auto& session_io_service = _next_session_io_service();
+  _socket = std::make_unique<boost::asio::ip::tcp::socket>(session_io_service);
+  _acceptor.async_accept(*_socket, [this, &session_io_service](const boost::system::error_code& error) {
+    _start_session(session_io_service, error);
+  });
 }
 
-void Server::_start_session(boost::system::error_code error) {
+void Server::_start_session(boost::asio::io_service& session_io_service, const boost::system::error_code& error) {
   if (!error) {
-    auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
-    auto session = std::make_shared<ServerSession>(connection, task_runner);
-    // Start the session and release it once it has terminated
-    session->start() >> then >> [=]() mutable { session.reset(); };
+    auto connection = std::make_shared<ClientConnection>(std::move(*_socket));
+    auto task_runner = std::make_shared<TaskRunner>(session_io_service);
+
+    // The session is started on the thread of its io_service
+    session_io_service.post([connection, task_runner]() {
+      auto session = std::make_shared<ServerSession>(connection, task_runner);
+      // Start the session and release it once it has terminated
+      session->start() >> then >> [=]() mutable { session.reset(); };
+    });
   }
 
   _accept_next_connection();
 }
 
+boost::asio::io_service& Server::_next_session_io_service() {
+  if (_session_io_services.empty()) return _io_service;
+
+  auto& session_io_service = *_session_io_services[_next_session_io_service_id];
+  _next_session_io_service_id = (_next_session_io_service_id + 1) % _session_io_services.size();
+  return session_io_service;
+}
+
 uint16_t Server::get_port_number() { return _acceptor.local_endpoint().port(); }
 
 }  // namespace opossum
@@ -3,23 +3,48 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "server_session.hpp"
 
 namespace opossum {
 
+/**
+ * Accepts the connections on the given io_service. The sessions of the connections are spread round-robin across
+ * io_thread_count I/O threads, each of which runs its own io_service. This way, sending and receiving the messages of
+ * many clients is not limited to a single thread. All operations of a session run on the thread of its io_service, so
+ * sessions do not need to be synchronized. If io_thread_count is 0, the sessions run on the given io_service as well.
+ */
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  Server(boost::asio::io_service& io_service, uint16_t port, size_t io_thread_count = 0);
+
+  // Stops the I/O threads. Sessions that are still running are aborted.
+  ~Server();
 
   uint16_t get_port_number();
 
  protected:
   void _accept_next_connection();
-  void _start_session(boost::system::error_code error);
+  void _start_session(boost::asio::io_service& session_io_service, const boost::system::error_code& error);
+
+  // Returns the io_service that runs the next session
+  boost::asio::io_service& _next_session_io_service();
 
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
+
+  // The io_services of the I/O threads are kept running by a work object until the server is destroyed
+  std::vector<std::unique_ptr<boost::asio::io_service>> _session_io_services;
+  std::vector<std::unique_ptr<boost::asio::io_service::work>> _session_io_service_works;
+  std::vector<std::thread> _io_threads;
+  size_t _next_session_io_service_id{0};
+
+  // The socket of the next connection, which belongs to the io_service of its session. It is declared after the
+  // io_services, so that it is destroyed first.
+  std::unique_ptr<boost::asio::ip::tcp::socket> _socket;
 };
 
 }  // namespace opossum
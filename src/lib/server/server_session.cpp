@@ -1,5 +1,6 @@
 #include "server_session.hpp"
 
+#include <boost/algorithm/string/case_conv.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/asio/placeholders.hpp>
 #include <boost/asio/write.hpp>
@@ -7,16 +8,20 @@
 
 #include <chrono>
 #include <iostream>
+#include <optional>
+#include <regex>
+#include <string>
 #include <thread>
 
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
-#include "storage/storage_manager.hpp"
-#include "tasks/server/bind_server_prepared_statement_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
+#include "tasks/server/encode_server_query_result_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
@@ -30,15 +35,51 @@
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
+namespace {
+
+// Returns the timeout if @param sql is `SET statement_timeout = <value>` (or `TO <value>`). As in PostgreSQL, the value
+// is given in milliseconds unless it has one of the units s or min.
+std::optional<std::chrono::milliseconds> parse_set_statement_timeout(const std::string& sql) {
+  static const auto set_statement_timeout_regex = std::regex{
+      R"(\s*SET\s+statement_timeout\s*(?:=|\s+TO)\s*'?\s*(\d+)\s*(ms|s|min)?\s*'?\s*;?\s*)", std::regex::icase};
+
+  // The SQL string of a SimpleQueryCommand is terminated by a \0-byte
+  const auto statement = sql.substr(0, sql.find('\0'));
+
+  auto match = std::smatch{};
+  if (!std::regex_match(statement, match, set_statement_timeout_regex)) return std::nullopt;
+
+  auto timeout = std::chrono::milliseconds{std::stoll(match[1].str())};
+  const auto unit = boost::algorithm::to_lower_copy(match[2].str());
+  if (unit == "s") {
+    timeout *= 1'000;
+  } else if (unit == "min") {
+    timeout *= 60'000;
+  }
+  return timeout;
+}
+
+}  // namespace
+
 namespace opossum {
 
 using opossum::then_operator::then;
 
+template <typename TConnection, typename TTaskRunner>
+ServerSessionImpl<TConnection, TTaskRunner>::~ServerSessionImpl() {
+  if (_backend_key) CancelRequestRegistry::get().unregister_session(_backend_key->process_id);
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
   // We need a copy of this session to outlive the async operation
   auto self = this->shared_from_this();
-  return (_perform_session_startup() >> then >> [this, self]() { return _handle_client_requests(); })
+  return (_perform_session_startup() >> then >>
+          [this, self]() {
+            // A CancelRequest is the only message sent on its connection
+            if (_is_cancel_request) return boost::make_ready_future();
+            return _handle_client_requests();
+          })
       // Use .then instead of >> then >> to be able to handle exceptions
       .then(boost::launch::sync, [self](boost::future<void> f) {
         try {
@@ -57,12 +98,29 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_sessio
       return _connection->send_ssl_denied() >> then >> [=]() { return _perform_session_startup(); };
     }
 
+    if (startup_packet_length == PostgresWireHandler::CANCEL_REQUEST) return _handle_cancel_request();
+
     return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
            [=]() { return _connection->send_auth(); } >> then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_parameter_status("client_encoding", "UTF8"); } >> then >>
-           [=]() { return _connection->send_ready_for_query(); };
+           [=]() {
+             // The client needs the key to cancel the statements of this session
+             _backend_key = CancelRequestRegistry::get().register_session();
+             return _connection->send_backend_key_data(_backend_key->process_id, _backend_key->secret_key);
+           } >>
+           then >> [=]() { return _connection->send_ready_for_query(); };
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_cancel_request() {
+  _is_cancel_request = true;
+
+  // The server does not reply to a CancelRequest, so that clients cannot learn whether the key was valid
+  return _connection->receive_cancel_request_body() >> then >> [](CancelRequestPacket cancel_request) {
+    CancelRequestRegistry::get().cancel(BackendKey{cancel_request.process_id, cancel_request.secret_key});
   };
 }
 
@@ -119,11 +177,16 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
       return boost::make_ready_future();
     }
 
+    if (_skip_until_sync && request.message_type != NetworkMessageType::SyncCommand) {
+      return _connection->discard_packet_body(request.payload_length) >> then >>
+             [this, self]() { return _handle_client_requests(); };
+    }
+
     // Handle any exceptions that have occurred during process_command. For this, we need to call .then() explicitly,
     // because >> then >> does not handle exceptions
     return process_command(request)
                .then(boost::launch::sync,
-                     [this, self](boost::future<void> result) {
+                     [this, self, request](boost::future<void> result) {
                        try {
                          result.get();
                          return boost::make_ready_future();
@@ -134,8 +197,14 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                            _transaction.reset();
                          }
 
-                         return _connection->send_error(e.what()) >> then >>
-                                [this, self]() { return _connection->send_ready_for_query(); };
+                         if (request.message_type == NetworkMessageType::SimpleQueryCommand) {
+                           return _connection->send_error(e.what()) >> then >>
+                                  [this, self]() { return _connection->send_ready_for_query(); };
+                         }
+
+                         // The client continues with the next Sync, which is answered with ReadyForQuery
+                         _skip_until_sync = true;
+                         return _connection->send_error(e.what());
                        }
                      })
                .unwrap()
@@ -155,10 +224,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 
     auto row_description = QueryResponseBuilder::build_row_description(sql_pipeline->get_result_table());
 
-    return _connection->send_row_description(row_description) >> then >> [=]() {
-      return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-    };
+    return _connection->send_row_description(row_description) >> then >>
+           [=]() { return _send_query_result(result_table); };
   };
 
   auto send_command_complete = [=](uint64_t row_count) {
@@ -173,10 +240,63 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<uint64_t> ServerSessionImpl<TConnection, TTaskRunner>::_send_query_result(
+    const std::shared_ptr<const Table>& result_table) {
+  const auto row_count = static_cast<uint64_t>(result_table->row_count());
+  if (result_table->chunk_count() == 0) return boost::make_ready_future<uint64_t>(row_count);
+
+  return _send_query_result_batches(result_table, ChunkID{0}, _encode_query_result_batch(result_table, ChunkID{0})) >>
+         then >> [=]() { return row_count; };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<std::shared_ptr<const std::vector<OutputPacket>>>
+ServerSessionImpl<TConnection, TTaskRunner>::_encode_query_result_batch(
+    const std::shared_ptr<const Table>& result_table, const ChunkID begin_chunk_id) {
+  // The rows are encoded by a scheduler worker, so that the I/O thread of the session is only busy with sending them
+  auto task = std::make_shared<EncodeServerQueryResultTask>(result_table, begin_chunk_id);
+  return _task_runner->dispatch_server_task(task);
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_query_result_batches(
+    const std::shared_ptr<const Table>& result_table, const ChunkID begin_chunk_id,
+    boost::future<std::shared_ptr<const std::vector<OutputPacket>>> encoded_batch) {
+  const auto end_chunk_id = EncodeServerQueryResultTask::end_chunk_id(*result_table, begin_chunk_id);
+
+  return std::move(encoded_batch) >> then >> [=](std::shared_ptr<const std::vector<OutputPacket>> data_rows) {
+    if (end_chunk_id == result_table->chunk_count()) return _connection->send_data_rows(data_rows);
+
+    // The next batch is encoded while this one is sent. The future is held in a shared_ptr, as the continuation has
+    // to be copyable.
+    auto next_encoded_batch = std::make_shared<boost::future<std::shared_ptr<const std::vector<OutputPacket>>>>(
+        _encode_query_result_batch(result_table, end_chunk_id));
+    return _connection->send_data_rows(data_rows) >> then >> [=]() {
+      return _send_query_result_batches(result_table, end_chunk_id, std::move(*next_encoded_batch));
+    };
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+std::shared_ptr<CancellationToken> ServerSessionImpl<TConnection, TTaskRunner>::_create_cancellation_token() {
+  auto cancellation_token = std::make_shared<CancellationToken>(_statement_timeout);
+  if (_backend_key) CancelRequestRegistry::get().set_running_statement(_backend_key->process_id, cancellation_token);
+  return cancellation_token;
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
+  // Session settings are not part of the SQL dialect of the SQLParser. statement_timeout is the only one supported.
+  if (const auto statement_timeout = parse_set_statement_timeout(sql)) {
+    _statement_timeout = *statement_timeout;
+    return _connection->send_command_complete("SET");
+  }
+
+  const auto cancellation_token = _create_cancellation_token();
+
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, cancellation_token));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -191,7 +311,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   };
 
   // A simple query command invalidates unnamed statements and portals
-  if (StorageManager::get().has_prepared_plan("")) StorageManager::get().drop_prepared_plan("");
+  _prepared_statements.erase("");
   _portals.erase("");
 
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
@@ -208,19 +328,26 @@ template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_command(const ParsePacket& parse_info) {
   // Named prepared statements must be explicitly closed before they can be redefined by another Parse message
   // https://www.postgresql.org/docs/10/static/protocol-flow.html
-  if (StorageManager::get().has_prepared_plan(parse_info.statement_name)) {
+  const auto prepared_statement_it = _prepared_statements.find(parse_info.statement_name);
+  if (prepared_statement_it != _prepared_statements.end()) {
     // Not using Assert() since it includes file:line info that we don't want to hard code in tests
     if (!parse_info.statement_name.empty()) {
       Fail("Named prepared statements must be explicitly closed before they can be redefined.");
     }
-    StorageManager::get().drop_prepared_plan(parse_info.statement_name);
+    _prepared_statements.erase(prepared_statement_it);
+  }
+
+  // If another session has prepared the same query before, its plan is used without scheduling a task
+  if (const auto cached_prepared_plan = SQLPreparedPlanCache::get().try_get(parse_info.query)) {
+    _prepared_statements.emplace(parse_info.statement_name, PreparedStatement{parse_info.query, *cached_prepared_plan});
+    return _connection->send_status_message(NetworkMessageType::ParseComplete);
   }
 
   auto task = std::make_shared<ParseServerPreparedStatementTask>(parse_info.query);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::unique_ptr<PreparedPlan> prepared_plan) {
-           // We know that SQLPipeline is set because the load table command is not allowed in this context
-           StorageManager::get().add_prepared_plan(parse_info.statement_name, std::move(prepared_plan));
+         [=](std::shared_ptr<PreparedPlan> prepared_plan) {
+           _prepared_statements.emplace(parse_info.statement_name,
+                                        PreparedStatement{parse_info.query, std::move(prepared_plan)});
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
@@ -228,13 +355,14 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_command(const BindPacket& packet) {
   // Not using Assert() since it includes file:line info that we don't want to hard code in tests
-  if (!StorageManager::get().has_prepared_plan(packet.statement_name)) {
+  const auto prepared_statement_it = _prepared_statements.find(packet.statement_name);
+  if (prepared_statement_it == _prepared_statements.end()) {
     Fail("The specified statement does not exist.");
   }
 
-  const auto prepared_plan = StorageManager::get().get_prepared_plan(packet.statement_name);
+  const auto prepared_statement = prepared_statement_it->second;
 
-  if (packet.statement_name.empty()) StorageManager::get().drop_prepared_plan(packet.statement_name);
+  if (packet.statement_name.empty()) _prepared_statements.erase(prepared_statement_it);
 
   auto portal_name = packet.destination_portal;
 
@@ -248,10 +376,14 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
     _portals.erase(portal_it);
   }
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
-  return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
-         then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
+  // The parameters are bound when the portal is executed. Only their number is checked here, so that a mismatch is
+  // reported for the Bind message.
+  if (packet.params.size() != prepared_statement.prepared_plan->parameter_ids.size()) {
+    Fail("Prepared statement parameter count mismatch");
+  }
+
+  _portals.emplace(portal_name, Portal{prepared_statement, packet.params});
+  return _connection->send_status_message(NetworkMessageType::BindComplete);
 }
 
 template <typename TConnection, typename TTaskRunner>
@@ -263,6 +395,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_describ
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_command() {
+  _skip_until_sync = false;
+
   if (!_transaction) return boost::make_ready_future();
 
   _transaction->commit();
@@ -273,8 +407,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_co
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_flush_command() {
-  // Ignore this because this message is received in a batch with other commands that handle the response.
-  return boost::make_ready_future();
+  // The responses to the extended query protocol are buffered until the next Sync, unless the client asks for them
+  return _connection->flush();
 }
 
 template <typename TConnection, typename TTaskRunner>
@@ -283,33 +417,37 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
   auto portal_it = _portals.find(portal_name);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  const auto portal = portal_it->second;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
   if (!_transaction) _transaction = TransactionManager::get().new_transaction_context();
 
-  physical_plan->set_transaction_context_recursively(_transaction);
-
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
-         [=](std::shared_ptr<const Table> result_table) {
-           // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
-           if (!result_table) {
-             return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
-                    []() { return uint64_t(0); };
-           }
-
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
-           return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-           };
-         } >>
-         then >> [=](uint64_t row_count) {
-           auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
-           return _connection->send_command_complete(complete_message);
-         };
+  // Binding the parameters and executing the plan are fused into a single task
+  const auto& prepared_statement = portal.prepared_statement;
+  auto task = std::make_shared<ExecuteServerPreparedStatementTask>(
+      prepared_statement.query, prepared_statement.prepared_plan, portal.params, _transaction,
+      _create_cancellation_token());
+  return _task_runner->dispatch_server_task(task) >> then >> [=](std::shared_ptr<AbstractOperator> physical_plan) {
+    const auto result_table = physical_plan->get_output();
+
+    auto send_row_data = [=]() {
+      // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
+      if (!result_table) {
+        return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
+               []() { return uint64_t(0); };
+      }
+
+      const auto row_description = QueryResponseBuilder::build_row_description(result_table);
+      return _connection->send_row_description(row_description) >> then >>
+             [=]() { return _send_query_result(result_table); };
+    };
+
+    return send_row_data() >> then >> [=](uint64_t row_count) {
+      auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
+      return _connection->send_command_complete(complete_message);
+    };
+  };
 }
 
 template class ServerSessionImpl<ClientConnection, TaskRunner>;
@@ -4,11 +4,19 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "all_type_variant.hpp"
+#include "cancel_request_registry.hpp"
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "storage/prepared_plan.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
 
@@ -20,10 +28,26 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
       : _connection(connection), _task_runner(task_runner) {}
 
+  ~ServerSessionImpl();
+
   boost::future<void> start();
 
  protected:
+  // A prepared statement, created by a Parse message. Its query is the key of its plans in the plan caches.
+  struct PreparedStatement {
+    std::string query;
+    std::shared_ptr<PreparedPlan> prepared_plan;
+  };
+
+  // A prepared statement with the values of its parameters, created by a Bind message. The parameters are only bound
+  // when the portal is executed, so that binding and executing it is a single task.
+  struct Portal {
+    PreparedStatement prepared_statement;
+    std::vector<AllTypeVariant> params;
+  };
+
   boost::future<void> _perform_session_startup();
+  boost::future<void> _handle_cancel_request();
 
   boost::future<void> _handle_client_requests();
   boost::future<void> _handle_simple_query_command(const std::string& sql);
@@ -36,12 +60,43 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
+  // Sends the rows of the result and returns their number
+  boost::future<uint64_t> _send_query_result(const std::shared_ptr<const Table>& result_table);
+
+  // Encodes the DataRow messages of the batch of chunks that begins with @param begin_chunk_id (see
+  // EncodeServerQueryResultTask)
+  boost::future<std::shared_ptr<const std::vector<OutputPacket>>> _encode_query_result_batch(
+      const std::shared_ptr<const Table>& result_table, const ChunkID begin_chunk_id);
+
+  // Sends the batch that begins with @param begin_chunk_id once it is encoded, and the following batches
+  boost::future<void> _send_query_result_batches(
+      const std::shared_ptr<const Table>& result_table, const ChunkID begin_chunk_id,
+      boost::future<std::shared_ptr<const std::vector<OutputPacket>>> encoded_batch);
+
+  // Creates the token for the next statement and registers it, so that the statement can be cancelled by the client
+  std::shared_ptr<CancellationToken> _create_cancellation_token();
+
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  // The names of prepared statements are private to the session (as in PostgreSQL). Keeping them here instead of in
+  // the StorageManager also means that sessions on different I/O threads do not need to synchronize. The plans
+  // themselves are shared between the sessions through the SQLPreparedPlanCache and the SQLPhysicalPlanCache.
+  std::unordered_map<std::string, PreparedStatement> _prepared_statements;
+  std::unordered_map<std::string, Portal> _portals;
+
+  // After an error in the extended query protocol, the messages up to the next Sync are discarded (as in PostgreSQL),
+  // so that the messages that the client has pipelined after the failed one are not executed
+  bool _skip_until_sync{false};
+
+  // Set once the startup has completed, unless the connection was only opened for a CancelRequest
+  std::optional<BackendKey> _backend_key;
+  bool _is_cancel_request{false};
+
+  // Set by `SET statement_timeout = ...`. Zero disables the timeout.
+  std::chrono::milliseconds _statement_timeout{0};
 };
 
 // The corresponding template instantiation takes place in the .cpp
@@ -35,9 +35,10 @@ auto TaskRunner::dispatch_server_task(std::shared_ptr<TResult> task) -> decltype
   return task->get_future()
       .then(boost::launch::sync,
             [=](auto result) {
-              // This result comes in on the scheduler thread, so we want to dispatch it back to the io_service
+              // This result comes in on the scheduler thread, so we want to dispatch it back to the io_service of
+              // the session
               return _io_service.post(boost::asio::use_boost_future)
-                     // Make sure to be on the main thread before re-throwing the exceptions
+                     // Make sure to be on the session's I/O thread before re-throwing the exceptions
                      >> then >> [result = std::move(result)]() mutable { return result.get(); };
             })
       .unwrap();
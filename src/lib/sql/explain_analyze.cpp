@@ -0,0 +1,90 @@
+#include "explain_analyze.hpp"
+
+#include <cctype>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+#include "operators/abstract_operator.hpp"
+#include "statistics/estimate_operator_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void append_operator_rows(const std::shared_ptr<const AbstractOperator>& op, const size_t depth,
+                          std::unordered_set<std::shared_ptr<const AbstractOperator>>& visited_ops, Table& table) {
+  if (!op || !visited_ops.emplace(op).second) return;
+
+  const auto& performance_data = op->performance_data();
+
+  auto estimated_row_count = AllTypeVariant{NullValue{}};
+  if (const auto estimate = estimate_output_row_count(*op)) {
+    estimated_row_count = static_cast<double>(*estimate);
+  }
+
+  auto output_memory_usage = AllTypeVariant{NullValue{}};
+  if (performance_data.output_memory_usage) {
+    output_memory_usage = static_cast<int64_t>(*performance_data.output_memory_usage);
+  }
+
+  table.append({pmr_string(depth * 2, ' ') + pmr_string{op->name()},
+                pmr_string{op->description(DescriptionMode::SingleLine)},
+                static_cast<int64_t>(performance_data.input_row_count),
+                static_cast<int64_t>(performance_data.output_row_count), estimated_row_count,
+                static_cast<int64_t>(performance_data.output_chunk_count), output_memory_usage,
+                static_cast<int64_t>(performance_data.walltime.count()),
+                pmr_string{performance_data.to_string(DescriptionMode::SingleLine)}});
+
+  append_operator_rows(op->input_left(), depth + 1, visited_ops, table);
+  append_operator_rows(op->input_right(), depth + 1, visited_ops, table);
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<std::string> strip_explain_analyze_prefix(const std::string& sql) {
+  auto position = size_t{0};
+
+  // Matches the next word case-insensitively and skips the whitespace in front of it
+  const auto consume_word = [&](const std::string& word) {
+    while (position < sql.size() && std::isspace(static_cast<unsigned char>(sql[position]))) ++position;
+    if (sql.size() - position < word.size()) return false;
+
+    for (auto char_idx = size_t{0}; char_idx < word.size(); ++char_idx) {
+      if (std::toupper(static_cast<unsigned char>(sql[position + char_idx])) != word[char_idx]) return false;
+    }
+    position += word.size();
+
+    // The word must not be the prefix of a longer identifier
+    return position == sql.size() || std::isspace(static_cast<unsigned char>(sql[position]));
+  };
+
+  if (!consume_word("EXPLAIN") || !consume_word("ANALYZE")) return std::nullopt;
+
+  while (position < sql.size() && std::isspace(static_cast<unsigned char>(sql[position]))) ++position;
+  return sql.substr(position);
+}
+
+std::shared_ptr<Table> create_explain_analyze_table(const std::shared_ptr<const AbstractOperator>& pqp) {
+  const auto column_definitions = TableColumnDefinitions{{"operator", DataType::String},
+                                                         {"description", DataType::String},
+                                                         {"rows_in", DataType::Long},
+                                                         {"rows_out", DataType::Long},
+                                                         {"estimated_rows", DataType::Double, true},
+                                                         {"chunks_out", DataType::Long},
+                                                         {"output_bytes", DataType::Long, true},
+                                                         {"walltime_ns", DataType::Long},
+                                                         {"details", DataType::String}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  auto visited_ops = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  append_operator_rows(pqp, 0, visited_ops, *table);
+
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Support for `EXPLAIN ANALYZE <statement>`: The statement is executed as usual, but instead of its result, the
+ * executed PQP is returned as a table with one row per operator. Each row contains
+ *  - the name of the operator, indented by its depth in the PQP, and its description
+ *  - the number of input and output rows, the number of output chunks, and the estimated size of the output in bytes
+ *    (NULL for GetTable and TableWrapper, which output existing tables)
+ *  - the cardinality estimated by the optimizer's TableStatistics (NULL if the operator was not translated from an
+ *    LQP node or if the statistics of its LQP cannot be estimated, see estimate_output_row_count())
+ *  - the walltime and the operator-specific PerformanceData, e.g., the durations of the steps of JoinHash
+ *
+ * Operators that are the input of multiple operators are listed once. The PQPs of subqueries are not listed.
+ */
+
+// Returns the statement without its `EXPLAIN ANALYZE` prefix (case-insensitive) or std::nullopt if it has none
+std::optional<std::string> strip_explain_analyze_prefix(const std::string& sql);
+
+// Creates the table described above from the executed PQP
+std::shared_ptr<Table> create_explain_analyze_table(const std::shared_ptr<const AbstractOperator>& pqp);
+
+}  // namespace opossum
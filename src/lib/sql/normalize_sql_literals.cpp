@@ -0,0 +1,237 @@
+#include "normalize_sql_literals.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "boost/algorithm/string/case_conv.hpp"
+
+#include "constant_mappings.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Keywords that start a clause in which literals are kept
+const auto KEEP_LITERALS_CLAUSE_KEYWORDS = std::unordered_set<std::string>{
+    "SELECT", "FROM", "JOIN", "ON", "USING", "GROUP", "ORDER", "LIMIT", "OFFSET", "UNION", "INTERSECT", "EXCEPT"};
+
+// Keywords that start a clause in which literals are replaced
+const auto REPLACE_LITERALS_CLAUSE_KEYWORDS = std::unordered_set<std::string>{"WHERE", "HAVING"};
+
+// Keywords whose following literal is part of a typed literal (e.g., `DATE '2000-01-01'`)
+const auto LITERAL_PREFIX_KEYWORDS = std::unordered_set<std::string>{"DATE", "TIME", "TIMESTAMP", "INTERVAL"};
+
+// Keywords after which a '-' can only be the sign of the following operand
+const auto OPERAND_PREFIX_KEYWORDS =
+    std::unordered_set<std::string>{"AND", "OR", "NOT", "WHERE", "HAVING", "BETWEEN", "WHEN", "THEN", "ELSE"};
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+// A parenthesized part of the statement
+struct Scope {
+  bool replaces_literals{false};
+  bool is_subquery{false};
+};
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  auto& output = normalized_sql.sql;
+  output.reserve(sql.size());
+  auto literal_data_types = std::vector<DataType>{};
+
+  auto scopes = std::vector<Scope>{Scope{}};
+  auto is_first_token = true;
+  auto statement_ended = false;
+  auto keep_next_literal = false;
+  // Used to tell a sign from a binary '-'
+  auto previous_token_is_operand = false;
+
+  const auto append_separator = [&]() {
+    if (!output.empty() && output.back() != ' ') output += ' ';
+  };
+
+  const auto size = sql.size();
+  auto position = size_t{0};
+
+  while (position < size) {
+    const auto character = sql[position];
+    const auto next_character = position + 1 < size ? sql[position + 1] : '\0';
+
+    // Whitespace and comments
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      append_separator();
+      ++position;
+      continue;
+    }
+    if (character == '-' && next_character == '-') {
+      position = sql.find('\n', position);
+      if (position == std::string::npos) position = size;
+      append_separator();
+      continue;
+    }
+    if (character == '/' && next_character == '*') {
+      const auto comment_end = sql.find("*/", position + 2);
+      if (comment_end == std::string::npos) return std::nullopt;
+      position = comment_end + 2;
+      append_separator();
+      continue;
+    }
+
+    // Only a single statement is normalized. The terminating ';' is dropped.
+    if (statement_ended) return std::nullopt;
+    if (character == ';') {
+      statement_ended = true;
+      ++position;
+      continue;
+    }
+
+    const auto is_word = std::isalpha(static_cast<unsigned char>(character)) || character == '_';
+    if (is_first_token && !is_word) return std::nullopt;
+
+    auto& scope = scopes.back();
+    const auto replace_literal = scope.replaces_literals && !scope.is_subquery && !keep_next_literal;
+    keep_next_literal = false;
+
+    if (is_word) {
+      auto word_end = position;
+      while (word_end < size && is_identifier_character(sql[word_end])) ++word_end;
+      const auto word = boost::to_upper_copy(sql.substr(position, word_end - position));
+
+      if (is_first_token && word != "SELECT") return std::nullopt;
+      is_first_token = false;
+
+      if (REPLACE_LITERALS_CLAUSE_KEYWORDS.count(word)) {
+        scope.replaces_literals = true;
+      } else if (KEEP_LITERALS_CLAUSE_KEYWORDS.count(word)) {
+        scope.replaces_literals = false;
+      }
+      if (word == "SELECT" && scopes.size() > 1) scope.is_subquery = true;
+
+      keep_next_literal = LITERAL_PREFIX_KEYWORDS.count(word) > 0;
+      previous_token_is_operand = OPERAND_PREFIX_KEYWORDS.count(word) == 0;
+
+      output.append(sql, position, word_end - position);
+      position = word_end;
+      continue;
+    }
+
+    // String literals and quoted identifiers
+    if (character == '\'' || character == '"' || character == '`') {
+      const auto quote_end = sql.find(character, position + 1);
+      if (quote_end == std::string::npos) return std::nullopt;
+      // Leave escaped quotes to the SQLParser
+      if (quote_end + 1 < size && sql[quote_end + 1] == character) return std::nullopt;
+
+      if (character == '\'' && replace_literal) {
+        output += '?';
+        normalized_sql.literals.emplace_back(pmr_string{sql.substr(position + 1, quote_end - position - 1)});
+        literal_data_types.emplace_back(DataType::String);
+      } else {
+        output.append(sql, position, quote_end + 1 - position);
+      }
+
+      previous_token_is_operand = true;
+      position = quote_end + 1;
+      continue;
+    }
+
+    // Numeric literals, including their sign if they are replaced
+    const auto is_sign = character == '-' && replace_literal && !previous_token_is_operand;
+    const auto number_start = is_sign ? position + 1 : position;
+    const auto starts_number = number_start < size && (is_digit(sql[number_start]) ||
+                                                       (sql[number_start] == '.' && number_start + 1 < size &&
+                                                        is_digit(sql[number_start + 1])));
+    if (starts_number) {
+      auto number_end = number_start;
+      while (number_end < size && is_digit(sql[number_end])) ++number_end;
+      const auto is_decimal = number_end < size && sql[number_end] == '.';
+      if (is_decimal) {
+        ++number_end;
+        while (number_end < size && is_digit(sql[number_end])) ++number_end;
+      }
+      // Exponents and malformed numbers are left to the SQLParser
+      if (number_end < size && (is_identifier_character(sql[number_end]) || sql[number_end] == '.')) {
+        return std::nullopt;
+      }
+
+      const auto number = sql.substr(position, number_end - position);
+
+      if (!replace_literal) {
+        output += number;
+      } else if (is_decimal) {
+        output += '?';
+        normalized_sql.literals.emplace_back(std::strtod(number.c_str(), nullptr));
+        literal_data_types.emplace_back(DataType::Double);
+      } else {
+        errno = 0;
+        const auto value = std::strtoll(number.c_str(), nullptr, 10);
+        if (errno == ERANGE) return std::nullopt;
+
+        output += '?';
+        if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+          normalized_sql.literals.emplace_back(static_cast<int32_t>(value));
+          literal_data_types.emplace_back(DataType::Int);
+        } else {
+          normalized_sql.literals.emplace_back(static_cast<int64_t>(value));
+          literal_data_types.emplace_back(DataType::Long);
+        }
+      }
+
+      previous_token_is_operand = true;
+      position = number_end;
+      continue;
+    }
+
+    switch (character) {
+      case '?':
+        // The statement is already parameterized
+        return std::nullopt;
+
+      case '(':
+        scopes.emplace_back(Scope{scope.replaces_literals, scope.is_subquery});
+        previous_token_is_operand = false;
+        break;
+
+      case ')':
+        if (scopes.size() == 1) return std::nullopt;
+        scopes.pop_back();
+        previous_token_is_operand = true;
+        break;
+
+      default:
+        previous_token_is_operand = false;
+    }
+
+    output += character;
+    ++position;
+  }
+
+  if (scopes.size() != 1 || normalized_sql.literals.empty()) return std::nullopt;
+
+  if (output.back() == ' ') output.pop_back();
+
+  normalized_sql.cache_key = "[";
+  for (auto literal_idx = size_t{0}; literal_idx < literal_data_types.size(); ++literal_idx) {
+    if (literal_idx > 0) normalized_sql.cache_key += ", ";
+    normalized_sql.cache_key += data_type_to_string.left.at(literal_data_types[literal_idx]);
+  }
+  normalized_sql.cache_key += "] ";
+  normalized_sql.cache_key += output;
+
+  return normalized_sql;
+}
+
+}  // namespace opossum
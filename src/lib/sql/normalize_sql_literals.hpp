@@ -0,0 +1,41 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+struct NormalizedSQL {
+  // The statement with its parameterized literals replaced by `?`
+  std::string sql;
+
+  // The replaced literals, in the order of their placeholders
+  std::vector<AllTypeVariant> literals;
+
+  // Key of the plans for this statement in the SQLLogicalPlanCache and the SQLPhysicalPlanCache. It contains the
+  // data types of the literals, as the parameters of a cached plan have a fixed data type.
+  std::string cache_key;
+};
+
+/**
+ * Lexically replaces the literals of a SELECT statement with placeholders, so that statements that only differ in
+ * their literals (e.g., `SELECT * FROM t WHERE a > 5` and `SELECT * FROM t WHERE a > 7`) share their plans. Comments
+ * are dropped and whitespace is collapsed. Numeric literals (including their sign) and string literals are replaced
+ * if they are part of a WHERE or HAVING clause of the outermost query. The data types of the literals follow the
+ * SQLTranslator, i.e., integers become Int (or Long if they do not fit), decimals become Double.
+ *
+ * Literals that determine the shape of the plan and literals that are bound to a keyword are kept:
+ *  - the SELECT list, GROUP BY, ORDER BY, LIMIT, and OFFSET
+ *  - join conditions (ON), as the join operators do not take parameters
+ *  - subqueries, as the optimizer treats parameters in subqueries as correlated values of the outer query
+ *  - literals after DATE, TIME, TIMESTAMP, and INTERVAL
+ *
+ * Returns std::nullopt if the statement is not a single SELECT statement, already contains placeholders, contains no
+ * literal to replace, or cannot be tokenized. Such statements are cached by their SQL string.
+ */
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql);
+
+}  // namespace opossum
@@ -0,0 +1,170 @@
+#include "query_result_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "cache/sampled_lfu_cache.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/pqp_subquery_expression.hpp"
+#include "operators/get_table.hpp"
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Operators whose output only depends on their inputs, their parameters, and the tables read by GetTable
+bool is_cacheable_operator_type(const OperatorType type) {
+  switch (type) {
+    case OperatorType::Aggregate:
+    case OperatorType::Alias:
+    case OperatorType::Difference:
+    case OperatorType::GetTable:
+    case OperatorType::IndexScan:
+    case OperatorType::JoinHash:
+    case OperatorType::JoinIndex:
+    case OperatorType::JoinMPSM:
+    case OperatorType::JoinNestedLoop:
+    case OperatorType::JoinSortMerge:
+    case OperatorType::Limit:
+    case OperatorType::Product:
+    case OperatorType::Projection:
+    case OperatorType::Sort:
+    case OperatorType::TableScan:
+    case OperatorType::TableWrapper:
+    case OperatorType::UnionAll:
+    case OperatorType::UnionPositions:
+    case OperatorType::Validate:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+// Collects the names of the tables read by the PQP and its subqueries. Returns false if the PQP contains an operator
+// whose result must not be cached.
+bool collect_table_names(const std::shared_ptr<const AbstractOperator>& op,
+                         std::unordered_set<std::shared_ptr<const AbstractOperator>>& visited_ops,
+                         std::vector<std::string>& table_names) {
+  if (!op || !visited_ops.emplace(op).second) return true;
+  if (!is_cacheable_operator_type(op->type())) return false;
+
+  if (op->type() == OperatorType::GetTable) {
+    table_names.emplace_back(std::static_pointer_cast<const GetTable>(op)->table_name());
+  }
+
+  auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  switch (op->type()) {
+    case OperatorType::Projection:
+      expressions = std::static_pointer_cast<const Projection>(op)->expressions;
+      break;
+    case OperatorType::TableScan:
+      expressions.emplace_back(std::static_pointer_cast<const TableScan>(op)->predicate());
+      break;
+    case OperatorType::Limit:
+      expressions.emplace_back(std::static_pointer_cast<const Limit>(op)->row_count_expression());
+      break;
+    default: {}  // OperatorType has no expressions
+  }
+
+  auto cacheable = true;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      const auto pqp_subquery_expression = std::dynamic_pointer_cast<PQPSubqueryExpression>(sub_expression);
+      if (pqp_subquery_expression) {
+        cacheable &= collect_table_names(pqp_subquery_expression->pqp, visited_ops, table_names);
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  return cacheable && collect_table_names(op->input_left(), visited_ops, table_names) &&
+         collect_table_names(op->input_right(), visited_ops, table_names);
+}
+
+}  // namespace
+
+namespace opossum {
+
+QueryResultCache::QueryResultCache() : _cache(0) {}
+
+std::optional<QueryResultCache::ResultKey> QueryResultCache::create_key(
+    const std::string& plan_key, const std::vector<AllTypeVariant>& parameters,
+    const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto visited_ops = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto table_names = std::vector<std::string>{};
+  if (!collect_table_names(pqp, visited_ops, table_names)) return std::nullopt;
+
+  std::sort(table_names.begin(), table_names.end());
+  table_names.erase(std::unique(table_names.begin(), table_names.end()), table_names.end());
+
+  auto result_key = ResultKey{plan_key, {}};
+
+  // The length of each value is prepended, so that string parameters cannot be mistaken for the separators
+  for (const auto& parameter : parameters) {
+    const auto value = type_cast_variant<pmr_string>(parameter);
+    result_key.key += " | " + std::to_string(value.size()) + ":";
+    result_key.key.append(value.data(), value.size());
+  }
+
+  const auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : table_names) {
+    if (!storage_manager.has_table(table_name)) return std::nullopt;
+
+    const auto table = storage_manager.get_table(table_name);
+    result_key.key += " | " + table_name + "@" + std::to_string(table->version());
+    result_key.tables.emplace_back(table);
+  }
+
+  return result_key;
+}
+
+std::shared_ptr<const Table> QueryResultCache::try_get(const ResultKey& result_key,
+                                                       const CommitID snapshot_commit_id) {
+  const auto entry = _cache.try_get(result_key.key);
+  if (!entry) return nullptr;
+
+  // A table of the same name might have been dropped and added again
+  if ((*entry)->tables != result_key.tables) return nullptr;
+
+  const auto oldest_snapshot_commit_id = std::min((*entry)->snapshot_commit_id, snapshot_commit_id);
+  for (const auto& table : result_key.tables) {
+    if (table->last_commit_id() > oldest_snapshot_commit_id) return nullptr;
+  }
+
+  return (*entry)->result;
+}
+
+void QueryResultCache::set(const ResultKey& result_key, const std::shared_ptr<const Table>& result,
+                           const CommitID snapshot_commit_id) {
+  const auto entry = std::make_shared<const Entry>(Entry{result, snapshot_commit_id, result_key.tables});
+  _cache.set(result_key.key, entry, static_cast<double>(result->estimate_memory_usage()));
+}
+
+void QueryResultCache::resize(size_t capacity) {
+  _capacity = capacity;
+  _cache.replace_cache_impl<SampledLFUCache<std::string, std::shared_ptr<const Entry>>>(capacity);
+  _cache.set_memory_budget(_memory_budget);
+}
+
+void QueryResultCache::set_memory_budget(size_t memory_budget) {
+  _memory_budget = memory_budget;
+  _cache.set_memory_budget(memory_budget);
+}
+
+bool QueryResultCache::is_enabled() const { return _capacity > 0; }
+
+size_t QueryResultCache::size() const { return _cache.size(); }
+
+void QueryResultCache::clear() { _cache.clear(); }
+
+}  // namespace opossum
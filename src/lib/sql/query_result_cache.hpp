@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "cache/cache.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Caches the result tables of read-only statements, so that a repeated statement is answered without executing its
+ * plan. Results are looked up by the key of the plan, the values of its parameters, and the names and versions of all
+ * tables the plan reads (see Table::version()). Thus, a commit to one of these tables or a replaced chunk makes the
+ * result unreachable.
+ *
+ * Since the result was produced for the snapshot of a transaction, it is only reused by transactions for which no
+ * commit to the tables read is missing or additional, i.e., if the last commit to each table (Table::last_commit_id())
+ * precedes both snapshots.
+ *
+ * The cache is disabled by default (its capacity is 0). Like the plan caches, it is bounded by the number of entries
+ * and by the estimated memory usage of the cached tables.
+ */
+class QueryResultCache : public Singleton<QueryResultCache> {
+ public:
+  // Identifies the result of a plan for the current versions of the tables it reads
+  struct ResultKey {
+    std::string key;
+
+    // Tables read by the plan. Their current last_commit_id() decides whether a cached result is still valid.
+    std::vector<std::shared_ptr<const Table>> tables;
+  };
+
+  // Returns std::nullopt if the result of the (not executed) plan cannot be cached, e.g., because it modifies tables.
+  // plan_key identifies the plan without its parameters, e.g., the normalized SQL statement.
+  static std::optional<ResultKey> create_key(const std::string& plan_key, const std::vector<AllTypeVariant>& parameters,
+                                             const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // Returns the cached result if it is valid for a transaction with the given snapshot, nullptr otherwise.
+  std::shared_ptr<const Table> try_get(const ResultKey& result_key, const CommitID snapshot_commit_id);
+
+  // Caches the result produced by a transaction with the given snapshot
+  void set(const ResultKey& result_key, const std::shared_ptr<const Table>& result, const CommitID snapshot_commit_id);
+
+  // A capacity of 0 disables the cache. Purges all entries and is not thread-safe.
+  void resize(size_t capacity);
+
+  void set_memory_budget(size_t memory_budget);
+
+  bool is_enabled() const;
+
+  size_t size() const;
+
+  void clear();
+
+ protected:
+  friend class Singleton;
+
+  QueryResultCache();
+
+  struct Entry {
+    std::shared_ptr<const Table> result;
+    CommitID snapshot_commit_id;
+    std::vector<std::shared_ptr<const Table>> tables;
+  };
+
+  size_t _capacity{0};
+  size_t _memory_budget{DefaultCacheMemoryBudget};
+  Cache<std::shared_ptr<const Entry>, std::string> _cache;
+};
+
+}  // namespace opossum
@@ -3,11 +3,14 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "explain_analyze.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -15,24 +18,32 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
+                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                         const std::string& workload_class,
+                         const std::shared_ptr<CancellationToken>& cancellation_token)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
 
+  // EXPLAIN ANALYZE is not part of the SQL dialect of the SQLParser. It is removed here and handled by the
+  // SQLPipelineStatement.
+  const auto explained_sql = strip_explain_analyze_prefix(sql);
+  const auto& parsed_sql = explained_sql ? *explained_sql : sql;
+
   hsql::SQLParserResult parse_result;
 
   const auto start = std::chrono::high_resolution_clock::now();
-  hsql::SQLParser::parse(sql, &parse_result);
+  hsql::SQLParser::parse(parsed_sql, &parse_result);
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics.parse_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - start);
-  DTRACE_PROBE2(HYRISE, SQL_PARSING, sql.c_str(), _metrics.parse_time_nanos.count());
+  DTRACE_PROBE2(HYRISE, SQL_PARSING, parsed_sql.c_str(), _metrics.parse_time_nanos.count());
 
-  AssertInput(parse_result.isValid(), create_sql_parser_error_message(sql, parse_result));
+  AssertInput(parse_result.isValid(), create_sql_parser_error_message(parsed_sql, parse_result));
   DebugAssert(parse_result.size() > 0, "Cannot create empty SQLPipeline.");
+  AssertInput(!explained_sql || parse_result.size() == 1, "EXPLAIN ANALYZE expects a single statement");
 
   _sql_pipeline_statements.reserve(parse_result.size());
 
@@ -70,12 +81,13 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     // Get the statement string from the original query string, so we can pass it to the SQLPipelineStatement
     const auto statement_string_length = statement->stringLength;
-    const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
+    auto statement_string = boost::trim_copy(parsed_sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
+    if (explained_sql) statement_string = "EXPLAIN ANALYZE " + statement_string;
 
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
+        cleanup_temporaries, workload_class, cancellation_token);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -233,11 +245,21 @@ const SQLPipelineMetrics& SQLPipeline::metrics() {
   return _metrics;
 }
 
+double SQLPipelineMetrics::query_plan_cache_hit_rate() const {
+  if (statement_metrics.empty()) return 0.0;
+
+  const auto num_cache_hits =
+      std::count_if(statement_metrics.begin(), statement_metrics.end(),
+                    [](const auto& statement_metric) { return statement_metric->query_plan_cache_hit; });
+  return static_cast<double>(num_cache_hits) / static_cast<double>(statement_metrics.size());
+}
+
 std::string SQLPipelineMetrics::to_string() const {
   auto total_sql_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_optimize_nanos = std::chrono::nanoseconds::zero();
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
+  auto peak_memory_usage = size_t{0};
   std::vector<bool> query_plan_cache_hits;
 
   for (const auto& statement_metric : statement_metrics) {
@@ -245,6 +267,7 @@ std::string SQLPipelineMetrics::to_string() const {
     total_optimize_nanos += statement_metric->optimize_time_nanos;
     total_lqp_translate_nanos += statement_metric->lqp_translate_time_nanos;
     total_execute_nanos += statement_metric->execution_time_nanos;
+    peak_memory_usage = std::max(peak_memory_usage, statement_metric->peak_memory_usage);
 
     query_plan_cache_hits.push_back(statement_metric->query_plan_cache_hit);
   }
@@ -258,7 +281,9 @@ std::string SQLPipelineMetrics::to_string() const {
   info_string << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
   info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
-  info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
+  info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s) ("
+              << std::round(query_plan_cache_hit_rate() * 100) << " %) | ";
+  info_string << "PEAK MEMORY: " << format_bytes(peak_memory_usage);
   info_string << "]\n";
 
   return info_string.str();
@@ -20,6 +20,10 @@ struct SQLPipelineMetrics {
   // This is different from the other measured times as we only get this for all statements at once
   std::chrono::nanoseconds parse_time_nanos{0};
 
+  // Share of the statements whose physical plan was retrieved from the SQLPhysicalPlanCache. Statements that only
+  // differ in their literals share a cached plan (see SQLPipelineStatement).
+  double query_plan_cache_hit_rate() const;
+
   std::string to_string() const;
 };
 
@@ -35,7 +39,8 @@ class SQLPipeline : public Noncopyable {
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const std::string& workload_class,
+              const std::shared_ptr<CancellationToken>& cancellation_token);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -10,6 +10,7 @@
 
 namespace opossum {
 
+class CancellationToken;
 class Optimizer;
 
 /**
@@ -28,6 +29,8 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - The WorkloadManager's default WorkloadClass
+ *  - No cancellation
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +45,17 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Assigns the statements to a WorkloadClass of the WorkloadManager. Without it, they belong to the default class.
+   */
+  SQLPipelineBuilder& with_workload_class(const std::string& workload_class);
+
+  /**
+   * Lets the statements be cancelled through the token (or by its timeout). Once it is cancelled, get_result_table()
+   * throws a QueryCancelledException.
+   */
+  SQLPipelineBuilder& with_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token);
+
   /**
    * Short for with_mvcc(UseMvcc::No)
    */
@@ -68,6 +82,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   CleanupTemporaries _cleanup_temporaries{true};
+  std::string _workload_class;
+  std::shared_ptr<CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
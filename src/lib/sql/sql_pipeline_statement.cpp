@@ -3,21 +3,55 @@
 #include <boost/algorithm/string.hpp>
 
 #include <iomanip>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
 #include "create_sql_parser_error_message.hpp"
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/query_memory_usage.hpp"
+#include "scheduler/workload_manager.hpp"
+#include "sql/explain_analyze.hpp"
+#include "sql/query_result_cache.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "storage/prepared_plan.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Plans of normalized statements are only cached if the literals use the first ParameterIDs (in the order of the
+// literals), so that statements that retrieve them from the cache can bind their literals without translating the
+// statement. This is not the case if a correlated subquery is translated before a literal.
+bool literals_use_first_parameter_ids(const std::vector<ParameterID>& literal_parameter_ids) {
+  for (auto literal_idx = size_t{0}; literal_idx < literal_parameter_ids.size(); ++literal_idx) {
+    if (literal_parameter_ids[literal_idx] != ParameterID{literal_idx}) return false;
+  }
+  return true;
+}
+
+std::vector<ParameterID> first_parameter_ids(const size_t count) {
+  auto parameter_ids = std::vector<ParameterID>(count);
+  for (auto parameter_idx = size_t{0}; parameter_idx < count; ++parameter_idx) {
+    parameter_ids[parameter_idx] = ParameterID{parameter_idx};
+  }
+  return parameter_ids;
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
@@ -25,16 +59,22 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
-    : _sql_string(sql),
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const std::string& workload_class,
+                                           const std::shared_ptr<CancellationToken>& cancellation_token)
+    : _sql_string(strip_explain_analyze_prefix(sql).value_or(sql)),
+      _explain_analyze(strip_explain_analyze_prefix(sql).has_value()),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _lqp_translator(lqp_translator),
       _optimizer(optimizer),
+      _normalized_sql(normalize_sql_literals(_sql_string)),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _workload_class(workload_class),
+      _cancellation_token(cancellation_token) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -120,7 +160,8 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   _unoptimized_logical_plan = nullptr;
 
   // Cache newly created plan for the according sql statement
-  SQLLogicalPlanCache::get().set(_sql_string, _optimized_logical_plan);
+  SQLLogicalPlanCache::get().set(_sql_string, _optimized_logical_plan,
+                                 estimate_plan_memory_usage(_optimized_logical_plan));
 
   return _optimized_logical_plan;
 }
@@ -139,7 +180,7 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
-  if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string)) {
+  if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_plan_cache_key())) {
     if ((*cached_physical_plan)->transaction_context_is_set()) {
       Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
     } else {
@@ -149,9 +190,12 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     _physical_plan = (*cached_physical_plan)->deep_copy();
     _metrics->query_plan_cache_hit = true;
 
+    if (_normalized_sql) _literal_parameter_ids = first_parameter_ids(_normalized_sql->literals.size());
+
   } else {
     // "Normal" mode in which the query plan is created
-    const auto& lqp = get_optimized_logical_plan();
+    auto lqp = _normalized_sql ? _get_parameterized_logical_plan() : nullptr;
+    if (!lqp) lqp = get_optimized_logical_plan();
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
@@ -162,9 +206,22 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  // Cache newly created plan for the according sql statement (only if not already cached)
-  if (!_metrics->query_plan_cache_hit) {
-    SQLPhysicalPlanCache::get().set(_sql_string, _physical_plan);
+  // Cache newly created plan for the according sql statement (only if not already cached). The cache receives an
+  // unbound copy, which is never executed, as concurrent statements deep-copy it while this plan is bound and executed.
+  if (!_metrics->query_plan_cache_hit &&
+      (!_normalized_sql || literals_use_first_parameter_ids(_literal_parameter_ids))) {
+    const auto cached_physical_plan = _physical_plan->deep_copy();
+    SQLPhysicalPlanCache::get().set(_plan_cache_key(), cached_physical_plan,
+                                    estimate_plan_memory_usage(cached_physical_plan));
+  }
+
+  // Bind the literals. Only this statement's private plan is bound, never the plan in the cache.
+  if (_normalized_sql) {
+    auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+    for (auto literal_idx = size_t{0}; literal_idx < _literal_parameter_ids.size(); ++literal_idx) {
+      parameters.emplace(_literal_parameter_ids[literal_idx], _normalized_sql->literals[literal_idx]);
+    }
+    _physical_plan->set_parameters(parameters);
   }
 
   _metrics->lqp_translate_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
@@ -186,13 +243,64 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
+  // Read-only statements that run in their own transaction are answered from the QueryResultCache if possible. The
+  // key is created after the transaction (and, thus, its snapshot) was created by get_physical_plan().
+  auto result_key = std::optional<QueryResultCache::ResultKey>{};
+  if (_auto_commit && !_explain_analyze && QueryResultCache::get().is_enabled()) {
+    const auto& plan = get_physical_plan();
+    result_key = QueryResultCache::create_key(
+        _plan_cache_key(), _normalized_sql ? _normalized_sql->literals : std::vector<AllTypeVariant>{}, plan);
+
+    if (result_key) {
+      const auto started = std::chrono::high_resolution_clock::now();
+
+      if (const auto cached_result =
+              QueryResultCache::get().try_get(*result_key, _transaction_context->snapshot_commit_id())) {
+        _transaction_context->commit();
+        _result_table = cached_result;
+        _metrics->query_result_cache_hit = true;
+
+        const auto done = std::chrono::high_resolution_clock::now();
+        _metrics->execution_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+        return _result_table;
+      }
+    }
+  }
+
   const auto& tasks = get_tasks();
+  const auto query_memory_usage = std::make_shared<QueryMemoryUsage>();
+  for (const auto& task : tasks) {
+    task->set_query_memory_usage(query_memory_usage);
+    if (_cancellation_token) task->set_cancellation_token(_cancellation_token);
+  }
 
   const auto started = std::chrono::high_resolution_clock::now();
 
+  // The admission is released once the statement is committed
+  auto admission = std::unique_ptr<QueryAdmission>{};
+  if (WorkloadManager::get().is_enabled()) {
+    admission = WorkloadManager::get().admit(_workload_class);
+    for (const auto& task : tasks) {
+      task->set_query_group(admission->query_group());
+    }
+  }
+
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  _metrics->peak_memory_usage = query_memory_usage->peak();
+
+  if (_cancellation_token && _cancellation_token->is_cancelled()) {
+    // The outputs of the cancelled operators are incomplete. Release them right away instead of keeping them until the
+    // statement is destroyed.
+    for (const auto& task : tasks) {
+      task->get_operator()->clear_output();
+    }
+    if (_transaction_context && _transaction_context->phase() == TransactionPhase::Active) {
+      _transaction_context->rollback();
+    }
+    _cancellation_token->throw_if_cancelled();
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -203,7 +311,15 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
-  if (_result_table == nullptr) _query_has_output = false;
+  if (_explain_analyze) {
+    _result_table = create_explain_analyze_table(get_physical_plan());
+  } else if (_result_table == nullptr) {
+    _query_has_output = false;
+  }
+
+  if (result_key && _result_table) {
+    QueryResultCache::get().set(*result_key, _result_table, _transaction_context->snapshot_commit_id());
+  }
 
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translate_time_nanos.count(),
                 _metrics->optimize_time_nanos.count(), _metrics->lqp_translate_time_nanos.count(),
@@ -217,4 +333,68 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_get_parameterized_logical_plan() {
+  const auto& literals = _normalized_sql->literals;
+
+  // Handle logical query plan if the normalized statement has been cached
+  if (const auto cached_plan = SQLLogicalPlanCache::get().try_get(_normalized_sql->cache_key)) {
+    const auto plan = *cached_plan;
+    DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
+    // MVCC-enabled and MVCC-disabled LQPs will evict each other
+    if (lqp_is_validated(plan) == (_use_mvcc == UseMvcc::Yes)) {
+      _literal_parameter_ids = first_parameter_ids(literals.size());
+      return plan;
+    }
+  }
+
+  const auto translate_started = std::chrono::high_resolution_clock::now();
+
+  // The normalized statement is parsed by itself, as the placeholders are not part of the parsed original statement.
+  // If a placeholder ended up where the SQLParser does not accept one, the original statement is used instead.
+  hsql::SQLParserResult parse_result;
+  hsql::SQLParser::parse(_normalized_sql->sql, &parse_result);
+  if (!parse_result.isValid() || parse_result.size() != 1 ||
+      !parse_result.getStatement(0)->isType(hsql::kStmtSelect)) {
+    _normalized_sql.reset();
+    return nullptr;
+  }
+
+  auto sql_translator = SQLTranslator{_use_mvcc};
+  const auto lqp_with_placeholders = sql_translator.translate_parser_result(parse_result).at(0);
+  _literal_parameter_ids = sql_translator.parameter_ids_of_value_placeholders();
+  Assert(_literal_parameter_ids.size() == literals.size(), "Expected one placeholder per literal");
+
+  // Parameters are set during execution. Thus, the optimizer does not make decisions that depend on the literals (e.g.,
+  // the ChunkPruningRule); those are left to the operators (e.g., TableScan::_prune_chunks_at_runtime()).
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>(literals.size());
+  for (auto literal_idx = size_t{0}; literal_idx < literals.size(); ++literal_idx) {
+    const auto parameter_id = _literal_parameter_ids[literal_idx];
+    const auto referenced_expression_info = CorrelatedParameterExpression::ReferencedExpressionInfo{
+        data_type_from_all_type_variant(literals[literal_idx]), "?"};
+    parameters[literal_idx] = std::make_shared<CorrelatedParameterExpression>(parameter_id, referenced_expression_info);
+  }
+  const auto unoptimized_lqp = PreparedPlan{lqp_with_placeholders, _literal_parameter_ids}.instantiate(parameters);
+
+  const auto optimize_started = std::chrono::high_resolution_clock::now();
+  _metrics->sql_translate_time_nanos =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(optimize_started - translate_started);
+
+  const auto optimized_lqp = _optimizer->optimize(unoptimized_lqp);
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - optimize_started);
+
+  if (literals_use_first_parameter_ids(_literal_parameter_ids)) {
+    SQLLogicalPlanCache::get().set(_normalized_sql->cache_key, optimized_lqp,
+                                   estimate_plan_memory_usage(optimized_lqp));
+  }
+
+  return optimized_lqp;
+}
+
+const std::string& SQLPipelineStatement::_plan_cache_key() const {
+  return _normalized_sql ? _normalized_sql->cache_key : _sql_string;
+}
+
 }  // namespace opossum
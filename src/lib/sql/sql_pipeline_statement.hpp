@@ -1,16 +1,21 @@
 #pragma once
 
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "SQLParserResult.h"
 #include "cache/cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "sql/normalize_sql_literals.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+class CancellationToken;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translate_time_nanos{};
@@ -18,7 +23,12 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds lqp_translate_time_nanos{};
   std::chrono::nanoseconds execution_time_nanos{};
 
+  // Maximum size of the intermediate results that were held at the same time during the execution, in bytes. Outputs
+  // of GetTable and TableWrapper are not counted, the final result is.
+  size_t peak_memory_usage = 0;
+
   bool query_plan_cache_hit = false;
+  bool query_result_cache_hit = false;
 };
 
 /**
@@ -33,6 +43,27 @@ struct SQLPipelineStatementMetrics {
  * NOTE:
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the optimized
  *  LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be different.
+ *
+ *  For SELECT statements with literals in their WHERE or HAVING clauses, the physical plan is built from the statement
+ *  with these literals replaced by parameters (see normalize_sql_literals()). The logical and physical plan of this
+ *  normalized statement are cached under its normalized form, so that statements that only differ in their literals
+ *  share them. The literals are bound to a copy of the (cached) plan via AbstractOperator::set_parameters().
+ *  get_unoptimized_logical_plan() and get_optimized_logical_plan() still return the plans with the literals.
+ *
+ *  If the QueryResultCache is enabled, the results of read-only statements that run in their own transaction are
+ *  cached. A repeated statement then only retrieves its physical plan (to determine the tables it reads), while
+ *  get_tasks() is not called and nothing is executed.
+ *
+ *  If the WorkloadManager is enabled, get_result_table() waits until the statement is admitted to its WorkloadClass
+ *  before its tasks are scheduled. The waiting time is part of the execution time.
+ *
+ *  For `EXPLAIN ANALYZE <statement>`, the statement is executed and get_result_table() returns the executed PQP with
+ *  the metrics of its operators instead of the statement's result (see explain_analyze.hpp). Its result is neither
+ *  taken from nor added to the QueryResultCache.
+ *
+ *  If the statement is cancelled through its CancellationToken, get_result_table() stops the execution at the next
+ *  chunk or job boundary of the running operators, releases their outputs, rolls back the transaction, and throws a
+ *  QueryCancelledException.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -40,9 +71,11 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                       const std::string& workload_class,
+                       const std::shared_ptr<CancellationToken>& cancellation_token);
 
-  // Returns the raw SQL string.
+  // Returns the raw SQL string, without a leading EXPLAIN ANALYZE.
   const std::string& get_sql_string();
 
   // Returns the parsed SQL string.
@@ -72,7 +105,15 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
  private:
+  // Returns the optimized LQP of the normalized statement, with CorrelatedParameterExpressions (using
+  // _literal_parameter_ids) in place of the literals. Returns nullptr if the normalized statement cannot be translated.
+  std::shared_ptr<AbstractLQPNode> _get_parameterized_logical_plan();
+
+  // Key of this statement in the SQLLogicalPlanCache and the SQLPhysicalPlanCache
+  const std::string& _plan_cache_key() const;
+
   const std::string _sql_string;
+  const bool _explain_analyze;
   const UseMvcc _use_mvcc;
 
   // Perform MVCC commit right after the Statement was executed
@@ -84,6 +125,11 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<LQPTranslator> _lqp_translator;
   const std::shared_ptr<Optimizer> _optimizer;
 
+  // Set if the statement's literals are parameterized
+  std::optional<NormalizedSQL> _normalized_sql;
+  // The ParameterIDs the literals of _normalized_sql are bound to
+  std::vector<ParameterID> _literal_parameter_ids;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
@@ -98,6 +144,12 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Name of the WorkloadClass, empty for the default class
+  const std::string _workload_class;
+
+  // nullptr if the statement cannot be cancelled
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
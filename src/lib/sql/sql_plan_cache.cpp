@@ -0,0 +1,51 @@
+#include "sql_plan_cache.hpp"
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_operator.hpp"
+
+namespace {
+
+// Rough size of an operator or LQP node object including its bookkeeping, without its expressions
+constexpr auto PLAN_NODE_MEMORY_USAGE = size_t{512};
+
+}  // namespace
+
+namespace opossum {
+
+size_t estimate_plan_memory_usage(const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto memory_usage = size_t{0};
+
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto operator_stack = std::vector<std::shared_ptr<const AbstractOperator>>{pqp};
+
+  while (!operator_stack.empty()) {
+    const auto op = operator_stack.back();
+    operator_stack.pop_back();
+
+    if (!op || !visited_operators.emplace(op).second) continue;
+
+    memory_usage += PLAN_NODE_MEMORY_USAGE + op->description().size();
+    operator_stack.emplace_back(op->input_left());
+    operator_stack.emplace_back(op->input_right());
+  }
+
+  return memory_usage;
+}
+
+size_t estimate_plan_memory_usage(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto memory_usage = size_t{0};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    memory_usage += PLAN_NODE_MEMORY_USAGE + node->description().size();
+    return LQPVisitation::VisitInputs;
+  });
+
+  return memory_usage;
+}
+
+}  // namespace opossum
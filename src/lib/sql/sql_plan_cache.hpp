@@ -9,8 +9,19 @@ namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class PreparedPlan;
 
 using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
 using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
 
+// Prepared statements of the server, keyed by their query. The plans are shared by all sessions that prepare the same
+// query, which is safe because PreparedPlan::instantiate() does not modify the plan.
+using SQLPreparedPlanCache = Cache<std::shared_ptr<PreparedPlan>, std::string>;
+
+// Estimate the memory used by a plan before it is executed, i.e., without results. This is the size of its entry in
+// the plan caches, which are bounded by DefaultCacheMemoryBudget. Each operator or node is accounted for with a fixed
+// size plus the length of its description, which grows with its expressions.
+size_t estimate_plan_memory_usage(const std::shared_ptr<const AbstractOperator>& pqp);
+size_t estimate_plan_memory_usage(const std::shared_ptr<AbstractLQPNode>& lqp);
+
 }  // namespace opossum
@@ -0,0 +1,59 @@
+#include "chunk_pruning_utils.hpp"
+
+#include <memory>
+
+#include "chunk_statistics.hpp"
+#include "resolve_type.hpp"
+#include "segment_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<const SegmentStatistics> resolve_segment_statistics(const Table& table, const ChunkID chunk_id,
+                                                                    const ColumnID column_id) {
+  auto data_chunk = table.get_chunk(chunk_id);
+  auto data_column_id = column_id;
+
+  if (table.type() == TableType::References) {
+    const auto reference_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(data_chunk->get_segment(column_id));
+    DebugAssert(reference_segment, "Expected ReferenceSegment in reference table");
+
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) return nullptr;
+
+    const auto common_chunk_id = pos_list.common_chunk_id();
+    // ReferenceSegments created by outer joins may only consist of NULL_ROW_IDs
+    if (common_chunk_id == INVALID_CHUNK_ID) return nullptr;
+
+    const auto& referenced_table = *reference_segment->referenced_table();
+    if (referenced_table.type() != TableType::Data) return nullptr;
+
+    data_chunk = referenced_table.get_chunk(common_chunk_id);
+    data_column_id = reference_segment->referenced_column_id();
+  }
+
+  const auto chunk_statistics = data_chunk->statistics();
+  if (!chunk_statistics) return nullptr;
+
+  DebugAssert(data_column_id < chunk_statistics->statistics().size(), "ColumnID out of range of the ChunkStatistics");
+  return chunk_statistics->statistics()[data_column_id];
+}
+
+bool chunk_can_be_pruned(const Table& table, const ChunkID chunk_id, const ColumnID column_id,
+                         const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2) {
+  const auto column_data_type = table.column_data_type(column_id);
+  if (data_type_from_all_type_variant(value) != column_data_type) return false;
+  if (value2 && data_type_from_all_type_variant(*value2) != column_data_type) return false;
+
+  const auto segment_statistics = resolve_segment_statistics(table, chunk_id, column_id);
+  if (!segment_statistics) return false;
+
+  return segment_statistics->can_prune(predicate_condition, value, value2);
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class SegmentStatistics;
+class Table;
+
+/**
+ * Returns the SegmentStatistics that describe the values of the segment at @param column_id in chunk @param chunk_id of
+ * @param table, or nullptr if there are none (e.g., because the chunk is still mutable).
+ * For reference tables, the statistics of the referenced data segment are returned, but only if the ReferenceSegment
+ * is guaranteed to reference a single chunk. As the referenced positions are a subset of that chunk, its statistics
+ * remain a valid (if less tight) description of the ReferenceSegment.
+ */
+std::shared_ptr<const SegmentStatistics> resolve_segment_statistics(const Table& table, const ChunkID chunk_id,
+                                                                    const ColumnID column_id);
+
+/**
+ * Runtime counterpart of the ChunkPruningRule: While the rule only sees literals at optimization time, operators can
+ * use this to skip chunks once the values of their predicates are known (e.g., bound parameters or the value range of
+ * a join's build side).
+ *
+ * @return true if the statistics prove that `column <predicate_condition> value [AND value2]` does not match any row
+ *         of the chunk. Returns false if no statistics are available or if the data type of the value differs from
+ *         that of the column, as the filters would then compare truncated values.
+ */
+bool chunk_can_be_pruned(const Table& table, const ChunkID chunk_id, const ColumnID column_id,
+                         const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                         const std::optional<AllTypeVariant>& value2 = std::nullopt);
+
+}  // namespace opossum
@@ -604,6 +604,63 @@ float AbstractHistogram<T>::estimate_selectivity(const PredicateCondition predic
   return estimate_cardinality(predicate_type, variant_value, variant_value2) / total_count();
 }
 
+template <typename T>
+float AbstractHistogram<T>::estimate_equi_join_cardinality(const AbstractHistogram<T>& right_histogram) const {
+  auto cardinality = 0.0;
+
+  auto left_bin_id = BinID{0};
+  auto right_bin_id = BinID{0};
+  while (left_bin_id < bin_count() && right_bin_id < right_histogram.bin_count()) {
+    const auto left_minimum = _bin_minimum(left_bin_id);
+    const auto left_maximum = _bin_maximum(left_bin_id);
+    const auto right_minimum = right_histogram._bin_minimum(right_bin_id);
+    const auto right_maximum = right_histogram._bin_maximum(right_bin_id);
+
+    if (left_maximum < right_minimum) {
+      ++left_bin_id;
+      continue;
+    }
+    if (right_maximum < left_minimum) {
+      ++right_bin_id;
+      continue;
+    }
+
+    // The overlap lies within a single bin of each histogram, so estimating the range on the whole histogram yields
+    // the share of that bin.
+    const auto overlap_minimum = AllTypeVariant{std::max(left_minimum, right_minimum)};
+    const auto overlap_maximum = AllTypeVariant{std::min(left_maximum, right_maximum)};
+    const auto left_count = static_cast<double>(
+        estimate_cardinality(PredicateCondition::Between, overlap_minimum, overlap_maximum));
+    const auto right_count = static_cast<double>(
+        right_histogram.estimate_cardinality(PredicateCondition::Between, overlap_minimum, overlap_maximum));
+
+    if (left_count > 0.0 && right_count > 0.0) {
+      // The distinct values of a bin are assumed to be spread like its values
+      const auto left_distinct_count = left_count * _bin_distinct_count(left_bin_id) / _bin_height(left_bin_id);
+      const auto right_distinct_count = right_count * right_histogram._bin_distinct_count(right_bin_id) /
+                                        right_histogram._bin_height(right_bin_id);
+      cardinality += left_count * right_count / std::max({left_distinct_count, right_distinct_count, 1.0});
+    }
+
+    // Continue with the bin(s) that end with the overlap
+    if (left_maximum <= right_maximum) ++left_bin_id;
+    if (right_maximum <= left_maximum) ++right_bin_id;
+  }
+
+  return static_cast<float>(cardinality);
+}
+
+template <typename T>
+bool AbstractHistogram<T>::supports_value(const AllTypeVariant& variant_value) const {
+  if (variant_is_null(variant_value)) return false;
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    return type_cast_variant<pmr_string>(variant_value).find_first_not_of(_supported_characters) == pmr_string::npos;
+  } else {
+    return true;
+  }
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(AbstractHistogram);
 
 }  // namespace opossum
@@ -90,6 +90,20 @@ class AbstractHistogram : public AbstractFilter {
   float estimate_cardinality(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                              const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Returns the estimated cardinality of an equi-join between the values represented by this histogram and those
+   * represented by `right_histogram`. The bins of both histograms are aligned: for each range in which a bin of this
+   * histogram and a bin of `right_histogram` overlap, the values of both bins in that range are estimated. Within the
+   * range, the side with fewer distinct values is assumed to be contained in the other side.
+   */
+  float estimate_equi_join_cardinality(const AbstractHistogram<T>& right_histogram) const;
+
+  /**
+   * Returns whether predicates with the given value can be estimated (or pruned).
+   * This is not the case for NULL values and, for string histograms, for values with unsupported characters.
+   */
+  bool supports_value(const AllTypeVariant& variant_value) const;
+
   /**
    * Returns whether a given predicate type and its parameter(s) can be pruned.
    * This method is specialized for strings to handle predicates uniquely applicable to string columns.
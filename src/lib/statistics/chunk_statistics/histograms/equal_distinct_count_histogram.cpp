@@ -1,5 +1,6 @@
 #include "equal_distinct_count_histogram.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -112,7 +113,17 @@ template <typename T>
 std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_segment(
     const std::shared_ptr<const BaseSegment>& segment, const BinID max_bin_count,
     const std::optional<pmr_string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
-  const auto value_counts = AbstractHistogram<T>::_gather_value_distribution(segment);
+  return from_distribution(AbstractHistogram<T>::_gather_value_distribution(segment), max_bin_count,
+                           supported_characters, string_prefix_length);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_distribution(
+    const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+    const std::optional<pmr_string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
+  DebugAssert(std::is_sorted(value_counts.cbegin(), value_counts.cend(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }),
+              "Value distribution has to be sorted by value");
 
   if (value_counts.empty()) {
     return nullptr;
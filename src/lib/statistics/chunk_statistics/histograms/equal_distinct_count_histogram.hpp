@@ -62,6 +62,17 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
       const std::optional<pmr_string>& supported_characters = std::nullopt,
       const std::optional<uint32_t>& string_prefix_length = std::nullopt);
 
+  /**
+   * Create a histogram based on a value distribution, i.e., the distinct values and their number of occurrences,
+   * sorted by value. This allows building a histogram on more than one segment, e.g., on a column of a table.
+   * Returns nullptr if the distribution is empty.
+   * See from_segment() for the other parameters.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_distribution(
+      const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+      const std::optional<pmr_string>& supported_characters = std::nullopt,
+      const std::optional<uint32_t>& string_prefix_length = std::nullopt);
+
   HistogramType histogram_type() const override;
   std::string histogram_name() const override;
   HistogramCountType total_distinct_count() const override;
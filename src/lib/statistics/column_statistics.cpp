@@ -1,5 +1,7 @@
 #include "column_statistics.hpp"
 
+#include <algorithm>
+#include <optional>
 #include <sstream>
 
 #include "resolve_type.hpp"
@@ -18,15 +20,77 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max,
+                                                            _histogram);
 }
 
 template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_value(
     const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
     const std::optional<AllTypeVariant>& value2) const {
+  // The column statistics of the result are derived from min, max and distinct count either way, the histogram only
+  // replaces the selectivity
+  auto estimate = _estimate_predicate_with_value_from_min_max(predicate_condition, variant_value, value2);
+
+  const auto histogram_selectivity = _estimate_selectivity_with_histogram(predicate_condition, variant_value, value2);
+  if (histogram_selectivity) {
+    estimate.selectivity = *histogram_selectivity;
+  }
+
+  return estimate;
+}
+
+template <typename ColumnDataType>
+std::optional<float> ColumnStatistics<ColumnDataType>::_estimate_selectivity_with_histogram(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& value2) const {
+  if (!_histogram) return std::nullopt;
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      break;
+    default:
+      return std::nullopt;
+  }
+
+  if (!_histogram->supports_value(variant_value) || (value2 && !_histogram->supports_value(*value2))) {
+    return std::nullopt;
+  }
+
+  // The histogram only represents the non-NULL values
+  const auto cardinality = _histogram->estimate_cardinality(predicate_condition, variant_value, value2);
+  const auto non_null_selectivity = std::clamp(cardinality / static_cast<float>(_histogram->total_count()), 0.f, 1.f);
+  return non_null_value_ratio() * non_null_selectivity;
+}
+
+template <typename ColumnDataType>
+std::optional<float> ColumnStatistics<ColumnDataType>::_estimate_equal_values_ratio_with_histograms(
+    const ColumnStatistics<ColumnDataType>& right_column_statistics) const {
+  const auto& right_histogram = right_column_statistics._histogram;
+  if (!_histogram || !right_histogram) return std::nullopt;
+
+  const auto pair_count =
+      static_cast<float>(_histogram->total_count()) * static_cast<float>(right_histogram->total_count());
+  return std::min(_histogram->estimate_equi_join_cardinality(*right_histogram) / pair_count, 1.f);
+}
+
+template <typename ColumnDataType>
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::_estimate_predicate_with_value_from_min_max(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& value2) const {
   const auto value = type_cast_variant<ColumnDataType>(variant_value);
 
   switch (predicate_condition) {
@@ -79,7 +143,7 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_
  * Specialization for strings as they cannot be used in subtractions.
  */
 template <>
-FilterByValueEstimate ColumnStatistics<pmr_string>::estimate_predicate_with_value(
+FilterByValueEstimate ColumnStatistics<pmr_string>::_estimate_predicate_with_value_from_min_max(
     const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
     const std::optional<AllTypeVariant>& value2) const {
   // if column has no distinct values, it can only have null values which cannot be selected with this predicate
@@ -289,6 +353,11 @@ FilterByColumnComparisonEstimate ColumnStatistics<ColumnDataType>::estimate_pred
   //
   // TODO(Anyone): Fix issue mentioned above.
 
+  // If both columns have a histogram, the aligned bins give a better estimation of (not) equal values. As the
+  // estimation of the open-ended predicates below combines equal_values_ratio with the overlapping ratios, which are
+  // based on min and max, it is only replaced for Equals and NotEquals.
+  const auto histogram_equal_values_ratio = _estimate_equal_values_ratio_with_histograms(right_column_statistics);
+
   switch (predicate_condition) {
     case PredicateCondition::Equals: {
       auto overlapping_distinct_count = std::min(left_overlapping_distinct_count, right_overlapping_distinct_count);
@@ -297,13 +366,15 @@ FilterByColumnComparisonEstimate ColumnStatistics<ColumnDataType>::estimate_pred
                                                                       overlapping_range_min, overlapping_range_max);
       auto new_right_column_stats = std::make_shared<ColumnStatistics>(0.0f, overlapping_distinct_count,
                                                                        overlapping_range_min, overlapping_range_max);
-      return {combined_non_null_ratio * equal_values_ratio, new_left_column_stats, new_right_column_stats};
+      return {combined_non_null_ratio * histogram_equal_values_ratio.value_or(equal_values_ratio),
+              new_left_column_stats, new_right_column_stats};
     }
     case PredicateCondition::NotEquals: {
       auto new_left_column_stats = std::make_shared<ColumnStatistics>(0.0f, distinct_count(), _min, _max);
       auto new_right_column_stats = std::make_shared<ColumnStatistics>(
           0.0f, right_column_statistics.distinct_count(), right_column_statistics._min, right_column_statistics._max);
-      return {combined_non_null_ratio * (1.f - equal_values_ratio), new_left_column_stats, new_right_column_stats};
+      return {combined_non_null_ratio * (1.f - histogram_equal_values_ratio.value_or(equal_values_ratio)),
+              new_left_column_stats, new_right_column_stats};
     }
     case PredicateCondition::LessThan: {
       return estimate_selectivity_for_open_ended_operators(left_below_overlapping_ratio, right_above_overlapping_ratio,
@@ -342,8 +413,29 @@ FilterByColumnComparisonEstimate ColumnStatistics<pmr_string>::estimate_predicat
     return {0.f, without_null_values(), right_column_statistics.without_null_values()};
   }
 
-  return {non_null_value_ratio() * right_column_statistics.non_null_value_ratio(), without_null_values(),
-          right_column_statistics.without_null_values()};
+  const auto combined_non_null_ratio = non_null_value_ratio() * right_column_statistics.non_null_value_ratio();
+
+  const auto histogram_equal_values_ratio = _estimate_equal_values_ratio_with_histograms(right_column_statistics);
+  if (histogram_equal_values_ratio && predicate_condition == PredicateCondition::Equals) {
+    const auto overlapping_distinct_count = std::min(distinct_count(), right_column_statistics.distinct_count());
+    const auto overlapping_range_min = std::max(_min, right_column_statistics._min);
+    const auto overlapping_range_max = std::min(_max, right_column_statistics._max);
+
+    auto new_left_column_stats = std::make_shared<ColumnStatistics>(0.0f, overlapping_distinct_count,
+                                                                    overlapping_range_min, overlapping_range_max);
+    auto new_right_column_stats = std::make_shared<ColumnStatistics>(0.0f, overlapping_distinct_count,
+                                                                     overlapping_range_min, overlapping_range_max);
+    return {combined_non_null_ratio * *histogram_equal_values_ratio, new_left_column_stats, new_right_column_stats};
+  }
+  if (histogram_equal_values_ratio && predicate_condition == PredicateCondition::NotEquals) {
+    auto new_left_column_stats = std::make_shared<ColumnStatistics>(0.0f, distinct_count(), _min, _max);
+    auto new_right_column_stats = std::make_shared<ColumnStatistics>(
+        0.0f, right_column_statistics.distinct_count(), right_column_statistics._min, right_column_statistics._max);
+    return {combined_non_null_ratio * (1.f - *histogram_equal_values_ratio), new_left_column_stats,
+            new_right_column_stats};
+  }
+
+  return {combined_non_null_ratio, without_null_values(), right_column_statistics.without_null_values()};
 }
 
 template <typename ColumnDataType>
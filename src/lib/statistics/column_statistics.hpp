@@ -8,20 +8,28 @@
 #include "all_type_variant.hpp"
 #include "base_column_statistics.hpp"
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
 
 namespace opossum {
 
 /**
  * @tparam ColumnDataType   the DataType of the values in the Column that these statistics represent
+ *
+ * Without a histogram, selectivities are estimated from min, max and distinct count, assuming that the values are
+ * distributed uniformly. If a histogram of the non-NULL values is given (see generate_table_statistics()), it is used
+ * instead for the predicates it supports and for equi-joins with columns that have a histogram as well. The statistics
+ * created by an estimation do not carry a histogram, since it would not describe the filtered values anymore.
  */
 template <typename ColumnDataType>
 class ColumnStatistics : public BaseColumnStatistics {
  public:
   ColumnStatistics(const float null_value_ratio, const float distinct_count, const ColumnDataType min,
-                   const ColumnDataType max)
+                   const ColumnDataType max,
+                   const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram = nullptr)
       : BaseColumnStatistics(data_type_from_type<ColumnDataType>(), null_value_ratio, distinct_count),
         _min(min),
-        _max(max) {
+        _max(max),
+        _histogram(histogram) {
     Assert(null_value_ratio >= 0.0f && null_value_ratio <= 1.0f, "NullValueRatio out of range");
   }
 
@@ -40,6 +48,7 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+  const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram() const;
   /** @} */
 
   /**
@@ -89,8 +98,31 @@ class ColumnStatistics : public BaseColumnStatistics {
   /** @} */
 
  private:
+  /**
+   * Estimate a Column-Value Predicate from min, max and distinct count
+   */
+  FilterByValueEstimate _estimate_predicate_with_value_from_min_max(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& value2) const;
+
+  /**
+   * @return the selectivity of a Column-Value Predicate estimated by the histogram, or std::nullopt if there is no
+   *         histogram or it cannot estimate the predicate
+   */
+  std::optional<float> _estimate_selectivity_with_histogram(const PredicateCondition predicate_condition,
+                                                            const AllTypeVariant& variant_value,
+                                                            const std::optional<AllTypeVariant>& value2) const;
+
+  /**
+   * @return the ratio of value pairs of this and the right column that are equal, estimated by the histograms of both
+   *         columns, or std::nullopt if one of them has no histogram
+   */
+  std::optional<float> _estimate_equal_values_ratio_with_histograms(
+      const ColumnStatistics<ColumnDataType>& right_column_statistics) const;
+
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const AbstractHistogram<ColumnDataType>> _histogram;
 };
 
 }  // namespace opossum
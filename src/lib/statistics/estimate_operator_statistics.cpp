@@ -0,0 +1,47 @@
+#include "estimate_operator_statistics.hpp"
+
+#include <memory>
+#include <optional>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/base_column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+bool has_statistics(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (!node) return true;
+
+  switch (node->type) {
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Alias:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+      return has_statistics(node->left_input()) && has_statistics(node->right_input());
+
+    default:
+      return false;
+  }
+}
+
+std::optional<float> estimate_output_row_count(const AbstractOperator& op) {
+  if (!op.lqp_node || !has_statistics(op.lqp_node)) return std::nullopt;
+  return op.lqp_node->get_statistics()->row_count();
+}
+
+std::optional<float> estimate_distinct_count(const AbstractOperator& op, const ColumnID column_id) {
+  if (!op.lqp_node || !has_statistics(op.lqp_node)) return std::nullopt;
+
+  const auto& column_statistics = op.lqp_node->get_statistics()->column_statistics();
+  if (static_cast<size_t>(column_id) >= column_statistics.size()) return std::nullopt;
+  return column_statistics[column_id]->distinct_count();
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+
+// Returns true if the statistics of all nodes of the LQP can be derived. Other nodes (e.g., DummyTable or the
+// maintenance nodes) do not implement derive_statistics_from().
+bool has_statistics(const std::shared_ptr<AbstractLQPNode>& node);
+
+// Returns the output cardinality of the operator as estimated by the optimizer's TableStatistics or std::nullopt if the
+// operator was not translated from an LQP node or if the statistics of its LQP cannot be estimated
+std::optional<float> estimate_output_row_count(const AbstractOperator& op);
+
+// Returns the number of distinct values in a column of the operator's output as estimated by the optimizer's
+// TableStatistics or std::nullopt if it cannot be estimated (see above)
+std::optional<float> estimate_distinct_count(const AbstractOperator& op, const ColumnID column_id);
+
+}  // namespace opossum
@@ -1,64 +1,155 @@
 #pragma once
 
-#include <boost/container/pmr/monotonic_buffer_resource.hpp>
-#include <boost/container/scoped_allocator.hpp>
-#include <unordered_set>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base_column_statistics.hpp"
 #include "column_statistics.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/chunk_statistics/histograms/equal_distinct_count_histogram.hpp"
+#include "statistics/chunk_statistics/histograms/histogram_utils.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+/**
+ * Merges two value distributions (i.e., distinct values and their number of occurrences, sorted by value) into one
+ */
+template <typename ColumnDataType>
+std::vector<std::pair<ColumnDataType, HistogramCountType>> merge_value_distributions(
+    const std::vector<std::pair<ColumnDataType, HistogramCountType>>& left,
+    const std::vector<std::pair<ColumnDataType, HistogramCountType>>& right) {
+  auto merged = std::vector<std::pair<ColumnDataType, HistogramCountType>>{};
+  merged.reserve(std::max(left.size(), right.size()));
+
+  auto left_iter = left.cbegin();
+  auto right_iter = right.cbegin();
+  while (left_iter != left.cend() && right_iter != right.cend()) {
+    if (left_iter->first < right_iter->first) {
+      merged.emplace_back(*left_iter++);
+    } else if (right_iter->first < left_iter->first) {
+      merged.emplace_back(*right_iter++);
+    } else {
+      merged.emplace_back(left_iter->first, left_iter->second + right_iter->second);
+      ++left_iter;
+      ++right_iter;
+    }
+  }
+  merged.insert(merged.end(), left_iter, left.cend());
+  merged.insert(merged.end(), right_iter, right.cend());
+
+  return merged;
+}
+
 /**
  * Generate the statistics of a single column. Used by generate_table_statistics()
+ *
+ * The value distributions of the chunks are gathered in parallel and merged pairwise (again in parallel) into the
+ * distribution of the column, from which the distinct count, min and max are taken. If histogram_bin_count is set, an
+ * EqualDistinctCountHistogram with at most that many bins is built from the distribution as well. String columns only
+ * get a histogram if all values consist of the characters supported by string histograms.
  */
 template <typename ColumnDataType>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id) {
-  // distinct_set is thrown away at the end of this method, so we don't want proper heap allocations for the strings
-  // stored within. The initial size of the buffer is a completely random guess, but better than zero.
-
-  auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(table.row_count() * sizeof(ColumnDataType));
-  auto distinct_set =
-      std::unordered_set<ColumnDataType, std::hash<ColumnDataType>, std::equal_to<ColumnDataType>,
-                         PolymorphicAllocator<ColumnDataType>>(PolymorphicAllocator<ColumnDataType>{&temp_buffer});
-  distinct_set.reserve(table.row_count());
-
-  auto null_value_count = size_t{0};
-
-  auto min = std::numeric_limits<ColumnDataType>::max();
-  auto max = std::numeric_limits<ColumnDataType>::lowest();
-
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto base_segment = table.get_chunk(chunk_id)->get_segment(column_id);
-
-    segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
-      if (position.is_null()) {
-        ++null_value_count;
-      } else {
-        distinct_set.insert(position.value());
-        min = std::min(min, position.value());
-        max = std::max(max, position.value());
-      }
-    });
+std::shared_ptr<BaseColumnStatistics> generate_column_statistics(
+    const Table& table, const ColumnID column_id, const std::optional<BinID>& histogram_bin_count = std::nullopt) {
+  using ValueDistribution = std::vector<std::pair<ColumnDataType, HistogramCountType>>;
+
+  const auto chunk_count = table.chunk_count();
+  auto value_distributions = std::vector<ValueDistribution>(chunk_count);
+  auto null_value_counts = std::vector<size_t>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto value_counts = std::unordered_map<ColumnDataType, HistogramCountType>{};
+      auto null_value_count = size_t{0};
+
+      segment_iterate<ColumnDataType>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          ++null_value_count;
+        } else {
+          ++value_counts[position.value()];
+        }
+      });
+
+      auto& value_distribution = value_distributions[chunk_id];
+      value_distribution.assign(value_counts.cbegin(), value_counts.cend());
+      std::sort(value_distribution.begin(), value_distribution.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+      null_value_counts[chunk_id] = null_value_count;
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  while (value_distributions.size() > 1) {
+    auto merged_value_distributions = std::vector<ValueDistribution>((value_distributions.size() + 1) / 2);
+
+    jobs.clear();
+    for (auto merged_idx = size_t{0}; merged_idx < merged_value_distributions.size(); ++merged_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, merged_idx]() {
+        const auto left_idx = 2 * merged_idx;
+        if (left_idx + 1 == value_distributions.size()) {
+          merged_value_distributions[merged_idx] = std::move(value_distributions[left_idx]);
+        } else {
+          merged_value_distributions[merged_idx] =
+              merge_value_distributions(value_distributions[left_idx], value_distributions[left_idx + 1]);
+        }
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    value_distributions = std::move(merged_value_distributions);
   }
 
+  auto value_distribution = ValueDistribution{};
+  if (!value_distributions.empty()) value_distribution = std::move(value_distributions.front());
+
+  const auto null_value_count = std::accumulate(null_value_counts.cbegin(), null_value_counts.cend(), size_t{0});
   const auto null_value_ratio =
       table.row_count() > 0 ? static_cast<float>(null_value_count) / static_cast<float>(table.row_count()) : 0.0f;
-  const auto distinct_count = static_cast<float>(distinct_set.size());
+  const auto distinct_count = static_cast<float>(value_distribution.size());
 
-  if (distinct_count == 0.0f) {
+  auto min = ColumnDataType{};
+  auto max = ColumnDataType{};
+  if (!value_distribution.empty()) {
+    min = value_distribution.front().first;
+    max = value_distribution.back().first;
+  } else if constexpr (!std::is_same_v<ColumnDataType, pmr_string>) {  // NOLINT(readability/braces)
     min = std::numeric_limits<ColumnDataType>::min();
     max = std::numeric_limits<ColumnDataType>::max();
   }
 
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
-}
+  auto column_histogram = std::shared_ptr<const AbstractHistogram<ColumnDataType>>{};
+  if (histogram_bin_count) {
+    auto values_supported = true;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      const auto supported_characters = histogram::get_default_or_check_string_histogram_prefix_settings().first;
+      values_supported =
+          std::all_of(value_distribution.cbegin(), value_distribution.cend(), [&](const auto& value_and_count) {
+            return value_and_count.first.find_first_not_of(supported_characters) == pmr_string::npos;
+          });
+    }
 
-template <>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics<pmr_string>(const Table& table,
-                                                                             const ColumnID column_id);
+    if (values_supported) {
+      column_histogram =
+          EqualDistinctCountHistogram<ColumnDataType>::from_distribution(value_distribution, *histogram_bin_count);
+    }
+  }
+
+  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max,
+                                                            column_histogram);
+}
 
 }  // namespace opossum
@@ -1,17 +1,25 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_set>
 
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
 #include "table_statistics.hpp"
 
 namespace opossum {
 
 class Table;
 
+// The number of bins of the histograms that are generated for the columns of a table by default
+constexpr auto DEFAULT_HISTOGRAM_BIN_COUNT = BinID{100};
+
 /**
  * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution.
+ * Unless histogram_bin_count is std::nullopt, the statistics of each column include an EqualDistinctCountHistogram with
+ * at most that many bins, which is used for cardinality estimation (see ColumnStatistics).
  */
-TableStatistics generate_table_statistics(const Table& table);
+TableStatistics generate_table_statistics(
+    const Table& table, const std::optional<BinID>& histogram_bin_count = DEFAULT_HISTOGRAM_BIN_COUNT);
 
 }  // namespace opossum
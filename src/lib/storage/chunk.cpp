@@ -119,6 +119,8 @@ void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
   _indices.erase(it);
 }
 
+bool Chunk::has_indices() const { return !_indices.empty(); }
+
 bool Chunk::references_exactly_one_table() const {
   if (column_count() == 0) return false;
 
@@ -139,7 +141,7 @@ bool Chunk::references_exactly_one_table() const {
   return true;
 }
 
-void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
+void Chunk::migrate(boost::container::pmr::memory_resource* memory_source, const NodeID node_id) {
   // Migrating chunks with indices is not implemented yet.
   if (!_indices.empty()) {
     Fail("Cannot migrate Chunk with Indices.");
@@ -151,8 +153,11 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
     new_segments.push_back(segment->copy_using_allocator(_alloc));
   }
   _segments = std::move(new_segments);
+  _node_id = node_id;
 }
 
+NodeID Chunk::node_id() const { return _node_id; }
+
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
 size_t Chunk::estimate_memory_usage() const {
@@ -131,7 +131,17 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<BaseIndex>& index);
 
-  void migrate(boost::container::pmr::memory_resource* memory_source);
+  bool has_indices() const;
+
+  /**
+   * Copies all segments using memory_source, e.g., to place the chunk on another NUMA node. node_id is recorded as
+   * the chunk's home node so that per-chunk work can be scheduled there (see NUMAPlacementManager).
+   * Not thread-safe: The chunk must not be accessed concurrently.
+   */
+  void migrate(boost::container::pmr::memory_resource* memory_source, const NodeID node_id = INVALID_NODE_ID);
+
+  // The NUMA node the chunk was migrated to, INVALID_NODE_ID if it was never migrated
+  NodeID node_id() const;
 
   bool references_exactly_one_table() const;
 
@@ -156,6 +166,7 @@ class Chunk : private Noncopyable {
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
+  NodeID _node_id = INVALID_NODE_ID;
 };
 
 }  // namespace opossum
@@ -69,6 +69,8 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
 
     encode_chunk(chunk, column_data_types, chunk_encoding_spec);
   }
+
+  table->increment_version();
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
@@ -81,6 +83,8 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
 
     encode_chunk(chunk, column_data_types, segment_encoding_spec);
   }
+
+  table->increment_version();
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -95,6 +99,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     encode_chunk(chunk, column_types, chunk_encoding_spec);
   }
+
+  table->increment_version();
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -107,6 +113,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     auto chunk = table->get_chunk(chunk_id);
     encode_chunk(chunk, column_types, chunk_encoding_spec);
   }
+
+  table->increment_version();
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -118,6 +126,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     encode_chunk(chunk, column_types, segment_encoding_spec);
   }
+
+  table->increment_version();
 }
 
 }  // namespace opossum
@@ -0,0 +1,160 @@
+#include "unique_constraint_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+UniqueConstraintIndex::UniqueConstraintIndex(const TableConstraintDefinition& definition) : _definition(definition) {
+  Assert(!_definition.columns.empty(), "A constraint needs at least one column");
+}
+
+const TableConstraintDefinition& UniqueConstraintIndex::definition() const { return _definition; }
+
+bool UniqueConstraintIndex::insert_table(const Table& table) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto success = true;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count() && success; ++chunk_id) {
+    _for_each_key(table, chunk_id, nullptr, [&](const Key& key, const RowID& row_id) {
+      success &= _add_row(table, key, row_id, TransactionManager::INVALID_TRANSACTION_ID);
+    });
+  }
+  return success;
+}
+
+bool UniqueConstraintIndex::insert(const Table& table, const PosList& row_ids, const TransactionID transaction_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Split row_ids into runs of the same chunk so that the keys of each run can be materialized together
+  auto run_begin = row_ids.begin();
+  while (run_begin != row_ids.end()) {
+    const auto chunk_id = run_begin->chunk_id;
+    const auto run_end = std::find_if(run_begin, row_ids.end(),
+                                      [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto position_filter = std::make_shared<PosList>(run_begin, run_end);
+    position_filter->guarantee_single_chunk();
+
+    auto success = true;
+    _for_each_key(table, chunk_id, position_filter, [&](const Key& key, const RowID& row_id) {
+      if (success) success = _add_row(table, key, row_id, transaction_id);
+    });
+    if (!success) return false;
+
+    run_begin = run_end;
+  }
+
+  return true;
+}
+
+void UniqueConstraintIndex::erase(const Table& table, const PosList& row_ids) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (const auto& row_id : row_ids) {
+    const auto position_filter = std::make_shared<PosList>(PosList{row_id});
+    position_filter->guarantee_single_chunk();
+
+    _for_each_key(table, row_id.chunk_id, position_filter, [&](const Key& key, const RowID& /*row_id*/) {
+      const auto iter = _rows_by_key.find(key);
+      if (iter == _rows_by_key.end()) return;
+
+      auto& rows = iter->second;
+      rows.erase(std::remove(rows.begin(), rows.end(), row_id), rows.end());
+      if (rows.empty()) _rows_by_key.erase(iter);
+    });
+  }
+}
+
+size_t UniqueConstraintIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+template <typename Functor>
+void UniqueConstraintIndex::_for_each_key(const Table& table, const ChunkID chunk_id,
+                                          const std::shared_ptr<const PosList>& position_filter,
+                                          const Functor& functor) const {
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto row_count = position_filter ? position_filter->size() : size_t{chunk->size()};
+
+  auto keys = std::vector<Key>(row_count, Key(_definition.columns.size()));
+  auto key_contains_null = std::vector<bool>(row_count);
+
+  for (auto column_idx = size_t{0}; column_idx < _definition.columns.size(); ++column_idx) {
+    const auto segment = chunk->get_segment(_definition.columns[column_idx]);
+
+    // With a position_filter, chunk_offset() is the offset into the filter
+    segment_iterate_filtered(*segment, position_filter, [&](const auto& position) {
+      const auto offset = position.chunk_offset();
+      if (offset >= row_count) return;
+
+      if (position.is_null()) {
+        key_contains_null[offset] = true;
+      } else {
+        keys[offset][column_idx] = position.value();
+      }
+    });
+  }
+
+  for (auto offset = size_t{0}; offset < row_count; ++offset) {
+    if (key_contains_null[offset]) continue;
+    functor(keys[offset],
+            position_filter ? (*position_filter)[offset] : RowID{chunk_id, static_cast<ChunkOffset>(offset)});
+  }
+}
+
+bool UniqueConstraintIndex::_add_row(const Table& table, const Key& key, const RowID& row_id,
+                                     const TransactionID transaction_id) {
+  const auto iter = _rows_by_key.find(key);
+  if (iter == _rows_by_key.end()) {
+    _rows_by_key.emplace(key, std::vector<RowID>{row_id});
+    return true;
+  }
+
+  auto& rows = iter->second;
+  const auto has_conflict = std::any_of(rows.begin(), rows.end(), [&](const auto& existing_row_id) {
+    return _holds_key(table, existing_row_id, transaction_id);
+  });
+  if (has_conflict) return false;
+
+  rows.emplace_back(row_id);
+  return true;
+}
+
+bool UniqueConstraintIndex::_holds_key(const Table& table, const RowID& row_id, const TransactionID transaction_id) {
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (!chunk->has_mvcc_data()) return true;
+
+  const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  const auto tid = mvcc_data->tids[row_id.chunk_offset].load();
+  const auto begin_cid = mvcc_data->begin_cids[row_id.chunk_offset];
+  const auto end_cid = mvcc_data->end_cids[row_id.chunk_offset];
+
+  // Deleted by a committed transaction or insert rolled back
+  if (end_cid != MvccData::MAX_COMMIT_ID) return false;
+
+  // Inserted and deleted again by the same, uncommitted transaction (see Delete::_on_execute)
+  if (begin_cid == MvccData::MAX_COMMIT_ID && tid == TransactionManager::INVALID_TRANSACTION_ID) return false;
+
+  // Committed row that is being deleted by the current transaction
+  if (transaction_id != TransactionManager::INVALID_TRANSACTION_ID && begin_cid != MvccData::MAX_COMMIT_ID &&
+      tid == transaction_id) {
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
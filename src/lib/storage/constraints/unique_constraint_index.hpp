@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/table_constraint_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Hash index that enforces a UNIQUE or PRIMARY KEY constraint of a table. It maps each key (i.e., the values of the
+ * constrained columns) to the rows that hold it. Like table indexes, it contains all physically present rows and uses
+ * the MVCC data to decide which of them still hold their key:
+ *
+ *   - Rows deleted by a committed transaction and rows of rolled-back inserts do not.
+ *   - Rows deleted by the inserting transaction itself do not. This allows an UPDATE to keep the key of a row.
+ *   - Committed rows and uncommitted rows of any transaction (including pending deletes by other transactions) do.
+ *
+ * Because uncommitted rows already count as conflicts, the second of two transactions inserting the same key fails
+ * right away (first writer wins, as for concurrent deletes). Thus, no further check is necessary when committing.
+ */
+class UniqueConstraintIndex : private Noncopyable {
+ public:
+  explicit UniqueConstraintIndex(const TableConstraintDefinition& definition);
+
+  const TableConstraintDefinition& definition() const;
+
+  /**
+   * Adds all rows of the table. Returns false if the table already violates the constraint.
+   */
+  bool insert_table(const Table& table);
+
+  /**
+   * Adds the given rows one by one, checking each for conflicts with the rows added before. Stops and returns false
+   * at the first row that violates the constraint. In that case, the transaction has to be rolled back and erase()
+   * needs to be called for all rows passed to insert().
+   */
+  bool insert(const Table& table, const PosList& row_ids, const TransactionID transaction_id);
+
+  /**
+   * Removes the given rows. Rows that are not part of the index are ignored.
+   */
+  void erase(const Table& table, const PosList& row_ids);
+
+ protected:
+  using Key = std::vector<AllTypeVariant>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  // Calls functor(key, row_id) for all rows that have no NULL in any of the constrained columns.
+  template <typename Functor>
+  void _for_each_key(const Table& table, const ChunkID chunk_id, const std::shared_ptr<const PosList>& position_filter,
+                     const Functor& functor) const;
+
+  bool _add_row(const Table& table, const Key& key, const RowID& row_id, const TransactionID transaction_id);
+
+  // Returns whether the row still holds its key for the given transaction (see class comment)
+  static bool _holds_key(const Table& table, const RowID& row_id, const TransactionID transaction_id);
+
+  const TableConstraintDefinition _definition;
+  std::unordered_map<Key, std::vector<RowID>, KeyHash> _rows_by_key;
+  std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -76,6 +76,8 @@ size_t FixedStringVector::size() const {
   return _string_length == 0u ? 1u : _chars.size() / _string_length;
 }
 
+size_t FixedStringVector::string_length() const { return _string_length; }
+
 size_t FixedStringVector::capacity() const { return _chars.capacity(); }
 
 void FixedStringVector::erase(const FixedStringIterator<false> start, const FixedStringIterator<false> end) {
@@ -62,6 +62,9 @@ class FixedStringVector {
   // Return the number of entries in the vector.
   size_t size() const;
 
+  // Return the (maximum) length of the strings in the vector
+  size_t string_length() const;
+
   // Return the amount of allocated memory
   size_t capacity() const;
 
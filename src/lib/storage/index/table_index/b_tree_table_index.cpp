@@ -0,0 +1,147 @@
+#include "b_tree_table_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename DataType>
+BTreeTableIndex<DataType>::BTreeTableIndex(const ColumnID column_id) : BaseTableIndex(column_id) {}
+
+template <typename DataType>
+void BTreeTableIndex<DataType>::insert_chunk(const Table& table, const ChunkID chunk_id) {
+  const auto segment = table.get_chunk(chunk_id)->get_segment(column_id());
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  segment_iterate<DataType>(*segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    _btree.insert(std::make_pair(position.value(), RowID{chunk_id, position.chunk_offset()}));
+  });
+}
+
+template <typename DataType>
+void BTreeTableIndex<DataType>::insert(const Table& table, const PosList& row_ids) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _for_each_value(table, row_ids,
+                  [&](const DataType& value, const RowID& row_id) { _btree.insert(std::make_pair(value, row_id)); });
+}
+
+template <typename DataType>
+void BTreeTableIndex<DataType>::erase(const Table& table, const PosList& row_ids) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _for_each_value(table, row_ids, [&](const DataType& value, const RowID& row_id) {
+    const auto range = _btree.equal_range(value);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+      if (iter->second == row_id) {
+        _btree.erase(iter);
+        return;
+      }
+    }
+  });
+}
+
+template <typename DataType>
+void BTreeTableIndex<DataType>::append_matches(const PredicateCondition predicate_condition,
+                                               const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2,
+                                               PosList& matches) const {
+  // Comparisons with NULL never evaluate to true
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return;
+
+  const auto typed_value = type_cast_variant<DataType>(value);
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  const auto append_range = [&](const auto range_begin, const auto range_end) {
+    for (auto iter = range_begin; iter != range_end; ++iter) {
+      matches.emplace_back(iter->second);
+    }
+  };
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals: {
+      const auto range = _btree.equal_range(typed_value);
+      append_range(range.first, range.second);
+    } break;
+    case PredicateCondition::NotEquals: {
+      append_range(_btree.begin(), _btree.lower_bound(typed_value));
+      append_range(_btree.upper_bound(typed_value), _btree.end());
+    } break;
+    case PredicateCondition::LessThan:
+      append_range(_btree.begin(), _btree.lower_bound(typed_value));
+      break;
+    case PredicateCondition::LessThanEquals:
+      append_range(_btree.begin(), _btree.upper_bound(typed_value));
+      break;
+    case PredicateCondition::GreaterThan:
+      append_range(_btree.upper_bound(typed_value), _btree.end());
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      append_range(_btree.lower_bound(typed_value), _btree.end());
+      break;
+    case PredicateCondition::Between: {
+      Assert(value2, "Between requires a second value");
+      const auto typed_value2 = type_cast_variant<DataType>(*value2);
+      if (typed_value2 < typed_value) return;
+      append_range(_btree.lower_bound(typed_value), _btree.upper_bound(typed_value2));
+    } break;
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
+template <typename DataType>
+size_t BTreeTableIndex<DataType>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _btree.size();
+}
+
+template <typename DataType>
+size_t BTreeTableIndex<DataType>::memory_consumption() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return sizeof(*this) + _btree.bytes_used();
+}
+
+template <typename DataType>
+template <typename Functor>
+void BTreeTableIndex<DataType>::_for_each_value(const Table& table, const PosList& row_ids,
+                                                const Functor& functor) const {
+  // Split row_ids into runs of the same chunk so that each run can be resolved with a single segment iteration
+  auto run_begin = row_ids.begin();
+  while (run_begin != row_ids.end()) {
+    const auto chunk_id = run_begin->chunk_id;
+    const auto run_end = std::find_if(run_begin, row_ids.end(),
+                                      [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto position_filter = std::make_shared<PosList>(run_begin, run_end);
+    position_filter->guarantee_single_chunk();
+    const auto segment = table.get_chunk(chunk_id)->get_segment(column_id());
+
+    segment_iterate_filtered<DataType>(*segment, position_filter, [&](const auto& position) {
+      if (position.is_null()) return;
+      functor(position.value(), (*position_filter)[position.chunk_offset()]);
+    });
+
+    run_begin = run_end;
+  }
+}
+
+std::shared_ptr<BaseTableIndex> make_table_index(const Table& table, const ColumnID column_id) {
+  std::shared_ptr<BaseTableIndex> table_index;
+  resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    table_index = std::make_shared<BTreeTableIndex<ColumnDataType>>(column_id);
+  });
+  return table_index;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BTreeTableIndex);
+
+}  // namespace opossum
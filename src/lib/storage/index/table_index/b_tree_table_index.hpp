@@ -0,0 +1,60 @@
+#pragma once
+
+#include <shared_mutex>
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wall"
+#include <btree_map.h>
+#pragma clang diagnostic pop
+#elif __GNUC__
+#pragma GCC system_header
+#include <btree_map.h>
+#endif
+
+#include <memory>
+#include <optional>
+
+#include "base_table_index.hpp"
+
+namespace opossum {
+
+class BTreeTableIndexTest;
+
+/**
+ * Table index backed by a B+-tree (https://code.google.com/archive/p/cpp-btree/) that maps values to RowIDs.
+ * Duplicates are stored as separate entries. Readers share a lock, modifications hold it exclusively.
+ */
+template <typename DataType>
+class BTreeTableIndex : public BaseTableIndex {
+  friend BTreeTableIndexTest;
+
+ public:
+  explicit BTreeTableIndex(const ColumnID column_id);
+
+  void insert_chunk(const Table& table, const ChunkID chunk_id) override;
+  void insert(const Table& table, const PosList& row_ids) override;
+  void erase(const Table& table, const PosList& row_ids) override;
+
+  void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                      const std::optional<AllTypeVariant>& value2, PosList& matches) const override;
+
+  size_t size() const override;
+  size_t memory_consumption() const override;
+
+ protected:
+  using BTree = btree::btree_multimap<DataType, RowID>;
+
+  // Calls functor(value, row_id) for all non-NULL values at the given rows.
+  template <typename Functor>
+  void _for_each_value(const Table& table, const PosList& row_ids, const Functor& functor) const;
+
+  BTree _btree;
+  mutable std::shared_mutex _mutex;
+};
+
+/**
+ * Creates an empty BTreeTableIndex on the given column of table, resolving the column's data type.
+ */
+std::shared_ptr<BaseTableIndex> make_table_index(const Table& table, const ColumnID column_id);
+
+}  // namespace opossum
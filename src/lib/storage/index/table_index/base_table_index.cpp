@@ -0,0 +1,9 @@
+#include "base_table_index.hpp"
+
+namespace opossum {
+
+BaseTableIndex::BaseTableIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BaseTableIndex::column_id() const { return _column_id; }
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * BaseTableIndex is the abstract super class for indexes that span all chunks of a table. In contrast to the
+ * chunk-level indexes (see BaseIndex), which are built once per (usually immutable) chunk and only return
+ * ChunkOffsets, a table index maps the values of a single column to the RowIDs of the entire table. This includes
+ * the mutable chunks, which are covered because the Insert operator adds every new row to the index.
+ *
+ * A table index contains all physically present rows and does not consider MVCC visibility. Rows that were
+ * invalidated by a Delete remain in the index, as transactions with an older snapshot might still see them. Rows
+ * of rolled-back inserts, which can never become visible, are removed. Consequently, the results of a lookup have to
+ * be validated just like the output of a GetTable. NULL values are not indexed.
+ *
+ * Lookups, insertions, and removals may happen concurrently.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  explicit BaseTableIndex(const ColumnID column_id);
+  BaseTableIndex(BaseTableIndex&&) = default;
+  BaseTableIndex& operator=(BaseTableIndex&&) = default;
+  virtual ~BaseTableIndex() = default;
+
+  ColumnID column_id() const;
+
+  /**
+   * Adds all rows of the given chunk to the index. Used when the index is created on an existing table.
+   */
+  virtual void insert_chunk(const Table& table, const ChunkID chunk_id) = 0;
+
+  /**
+   * Adds or removes the given rows. The values are read from the table, so rows have to be written before they are
+   * inserted and must not have been modified when they are erased.
+   */
+  virtual void insert(const Table& table, const PosList& row_ids) = 0;
+  virtual void erase(const Table& table, const PosList& row_ids) = 0;
+
+  /**
+   * Appends the RowIDs of all entries satisfying `column <predicate_condition> value [AND value2]` to `matches`.
+   * Matches are ordered by their value. Supports all comparisons and (inclusive) Between.
+   */
+  virtual void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                              const std::optional<AllTypeVariant>& value2, PosList& matches) const = 0;
+
+  /**
+   * Returns the number of indexed (i.e., non-NULL) entries
+   */
+  virtual size_t size() const = 0;
+
+  virtual size_t memory_consumption() const = 0;
+
+ private:
+  ColumnID _column_id;
+};
+
+}  // namespace opossum
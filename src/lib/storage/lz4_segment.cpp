@@ -52,6 +52,11 @@ const std::optional<T> LZ4Segment<T>::get_typed_value(const ChunkOffset chunk_of
   return decompressed_segment[chunk_offset];
 }
 
+template <typename T>
+const pmr_vector<char>& LZ4Segment<T>::compressed_data() const {
+  return _compressed_data;
+}
+
 template <typename T>
 const pmr_vector<bool>& LZ4Segment<T>::null_values() const {
   return _null_values;
@@ -62,6 +67,11 @@ const std::optional<const pmr_vector<size_t>> LZ4Segment<T>::offsets() const {
   return _offsets;
 }
 
+template <typename T>
+size_t LZ4Segment<T>::decompressed_size() const {
+  return _decompressed_size;
+}
+
 template <typename T>
 size_t LZ4Segment<T>::size() const {
   return _null_values.size();
@@ -41,8 +41,10 @@ class LZ4Segment : public BaseEncodedSegment {
   explicit LZ4Segment(pmr_vector<char>&& compressed_data, pmr_vector<bool>&& null_values,
                       const size_t decompressed_size);
 
+  const pmr_vector<char>& compressed_data() const;
   const pmr_vector<bool>& null_values() const;
   const std::optional<const pmr_vector<size_t>> offsets() const;
+  size_t decompressed_size() const;
 
   /**
    * @defgroup BaseSegment interface
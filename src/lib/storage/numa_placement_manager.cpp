@@ -0,0 +1,107 @@
+#include "numa_placement_manager.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void NUMAPlacementManager::set_policy(const NUMAPlacementPolicy policy, const ChunkID min_chunk_count) {
+  _policy = policy;
+  _min_chunk_count = min_chunk_count;
+}
+
+NUMAPlacementPolicy NUMAPlacementManager::policy() const { return _policy; }
+
+void NUMAPlacementManager::place_table(Table& table) const {
+  const auto node_count = Topology::get().nodes().size();
+  const auto chunk_count = table.chunk_count();
+  if (_policy == NUMAPlacementPolicy::None || node_count < 2 || chunk_count < _min_chunk_count) return;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto node_id = _target_node_id(chunk_id, chunk_count, node_count);
+    if (chunk->is_mutable() || chunk->node_id() == node_id || chunk->has_indices()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>(
+        [chunk, node_id]() { chunk->migrate(Topology::get().get_memory_resource(node_id), node_id); }));
+    jobs.back()->schedule(node_id);
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+NodeID NUMAPlacementManager::home_node_id(const Table& table, const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  auto node_id = chunk->node_id();
+
+  if (node_id == INVALID_NODE_ID && table.type() == TableType::References && chunk->column_count() > 0) {
+    const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.references_single_chunk() && !pos_list.empty() && pos_list[0].chunk_id != INVALID_CHUNK_ID) {
+      node_id = reference_segment->referenced_table()->get_chunk(pos_list[0].chunk_id)->node_id();
+    }
+  }
+
+  // The data might have been placed using a different Topology
+  if (node_id == INVALID_NODE_ID || static_cast<size_t>(node_id) >= Topology::get().nodes().size()) {
+    return CURRENT_NODE_ID;
+  }
+  return node_id;
+}
+
+void NUMAPlacementManager::record_access(const NodeID home_node_id) {
+  if (home_node_id == CURRENT_NODE_ID) return;
+
+  const auto worker = Worker::get_this_thread_worker();
+  if (!worker) return;
+
+  if (worker->queue()->node_id() == home_node_id) {
+    _local_accesses.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    _remote_accesses.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+NUMAAccessCounters NUMAPlacementManager::access_counters() const {
+  return NUMAAccessCounters{_local_accesses.load(), _remote_accesses.load()};
+}
+
+void NUMAPlacementManager::reset_access_counters() {
+  _local_accesses = 0;
+  _remote_accesses = 0;
+}
+
+void NUMAPlacementManager::reset() {
+  auto& manager = get();
+  manager.set_policy(NUMAPlacementPolicy::None);
+  manager.reset_access_counters();
+}
+
+NodeID NUMAPlacementManager::_target_node_id(const ChunkID chunk_id, const ChunkID chunk_count,
+                                             const size_t node_count) const {
+  switch (_policy) {
+    case NUMAPlacementPolicy::RoundRobin:
+      return NodeID{static_cast<NodeID::base_type>(chunk_id % node_count)};
+    case NUMAPlacementPolicy::Range:
+      return NodeID{static_cast<NodeID::base_type>(size_t{chunk_id} * node_count / chunk_count)};
+    case NUMAPlacementPolicy::None:
+      Fail("No target node without a placement policy");
+  }
+  Fail("Invalid enum value");
+}
+
+}  // namespace opossum
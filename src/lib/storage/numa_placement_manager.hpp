@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class NUMAPlacementPolicy {
+  None,        // Chunks stay where they were allocated
+  RoundRobin,  // Chunk i is placed on node i % node_count
+  Range        // The chunks are split into node_count consecutive ranges of (almost) equal size
+};
+
+struct NUMAAccessCounters {
+  // Per-chunk jobs that were executed on the home node of their chunk
+  uint64_t local_accesses{0};
+  // Per-chunk jobs that were executed on another node, e.g., because they were stolen
+  uint64_t remote_accesses{0};
+};
+
+/**
+ * Spreads the chunks of large tables across the NUMA nodes of the current Topology using Chunk::migrate. Each chunk
+ * records its home node, which operators use to schedule their per-chunk jobs on the node that owns the data
+ * (see home_node_id()). To verify that this works, those jobs report whether they actually ran on the home node of
+ * their chunk, which is exposed via access_counters().
+ *
+ * The placement is performed by StorageManager::add_table() and is disabled (NUMAPlacementPolicy::None) by default.
+ */
+class NUMAPlacementManager : public Singleton<NUMAPlacementManager> {
+ public:
+  // Tables with fewer chunks are not worth spreading
+  static constexpr auto DEFAULT_MIN_CHUNK_COUNT = ChunkID{8};
+
+  void set_policy(const NUMAPlacementPolicy policy, const ChunkID min_chunk_count = DEFAULT_MIN_CHUNK_COUNT);
+  NUMAPlacementPolicy policy() const;
+
+  /**
+   * Migrates the immutable chunks of the table to their node according to the policy. Mutable chunks (which might
+   * still be appended to) and chunks with indexes are left in place. Each migration runs as a job on the target node
+   * so that the new segments are allocated and first touched there. The table must not be accessed concurrently.
+   */
+  void place_table(Table& table) const;
+
+  /**
+   * Returns the node the chunk's data is placed on. For reference tables, the node of the chunk that is referenced
+   * by the first position is used if the chunk only references a single chunk. Returns CURRENT_NODE_ID if the data
+   * has not been placed, so that the result can be passed to AbstractTask::schedule() directly.
+   */
+  static NodeID home_node_id(const Table& table, const ChunkID chunk_id);
+
+  /**
+   * Called by per-chunk jobs with the result of home_node_id(). Counts whether the calling worker runs on that node.
+   * Does nothing for unplaced data or when no scheduler is active.
+   */
+  void record_access(const NodeID home_node_id);
+
+  NUMAAccessCounters access_counters() const;
+  void reset_access_counters();
+
+  static void reset();
+
+ protected:
+  friend class Singleton;
+
+  NUMAPlacementManager() = default;
+
+  NodeID _target_node_id(const ChunkID chunk_id, const ChunkID chunk_count, const size_t node_count) const;
+
+  NUMAPlacementPolicy _policy{NUMAPlacementPolicy::None};
+  ChunkID _min_chunk_count{DEFAULT_MIN_CHUNK_COUNT};
+
+  std::atomic<uint64_t> _local_accesses{0};
+  std::atomic<uint64_t> _remote_accesses{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Reads the values that a range of positions of a ReferenceSegment point to and writes them to a contiguous output
+ * buffer. Unlike the MultipleChunkReferenceSegmentAccessor, which resolves one position at a time through a virtual
+ * accessor, the positions are processed in blocks of BLOCK_SIZE:
+ *   1. The non-NULL positions of a block are sorted by their RowID (unless they already are), which groups them by
+ *      referenced chunk and lets the reads within a chunk advance in ascending order.
+ *   2. For each group, the referenced segment is resolved once and its values are decoded by the typed segment,
+ *      without virtual calls. For ValueSegments, whose values can be addressed directly, the values PREFETCH_DISTANCE
+ *      positions ahead are prefetched, which hides the cache misses of scattered PosLists (e.g., after a hash join).
+ * The referenced segments are cached per ChunkID across calls. A ReferenceSegmentGather must not be used by multiple
+ * threads concurrently.
+ *
+ * Use like:
+ *
+ * ```c++
+ *   auto values = std::vector<std::optional<T>>(segment.size());
+ *   ReferenceSegmentGather<T>{segment}.gather(ChunkOffset{0}, segment.size(), values.data());
+ * ```
+ */
+template <typename T>
+class ReferenceSegmentGather {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{1024};
+  static constexpr auto PREFETCH_DISTANCE = size_t{8};
+
+  explicit ReferenceSegmentGather(const ReferenceSegment& segment) : _segment{segment} { _block.reserve(BLOCK_SIZE); }
+
+  // Writes the value of the position begin_offset + i to output[i] for all positions in [begin_offset, end_offset).
+  // NULL values (both NULL positions and NULLs in the referenced segment) are written as std::nullopt.
+  void gather(const ChunkOffset begin_offset, const ChunkOffset end_offset, std::optional<T>* output) {
+    DebugAssert(begin_offset <= end_offset && end_offset <= _segment.size(), "Invalid range of positions");
+    const auto& pos_list = *_segment.pos_list();
+
+    for (auto block_begin = begin_offset; block_begin < end_offset; block_begin += BLOCK_SIZE) {
+      const auto block_end = std::min(end_offset, static_cast<ChunkOffset>(block_begin + BLOCK_SIZE));
+
+      _block.clear();
+      for (auto offset = block_begin; offset < block_end; ++offset) {
+        const auto& row_id = pos_list[offset];
+        if (row_id.is_null()) {
+          output[offset - begin_offset] = std::nullopt;
+        } else {
+          _block.emplace_back(row_id, offset - begin_offset);
+        }
+      }
+
+      const auto compare_row_ids = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+      if (!std::is_sorted(_block.cbegin(), _block.cend(), compare_row_ids)) {
+        std::sort(_block.begin(), _block.end(), compare_row_ids);
+      }
+
+      for (auto group_begin = _block.cbegin(); group_begin != _block.cend();) {
+        const auto chunk_id = group_begin->first.chunk_id;
+        const auto group_end = std::find_if(group_begin, _block.cend(),
+                                            [&](const auto& position) { return position.first.chunk_id != chunk_id; });
+        _gather_from_segment(_referenced_segment(chunk_id), group_begin, group_end, output);
+        group_begin = group_end;
+      }
+    }
+  }
+
+  // Calls functor(offset, value) for each position in [begin_offset, end_offset) in ascending order of offsets, where
+  // value is a std::optional<T> that is std::nullopt for NULLs. The values are gathered one block at a time.
+  template <typename Functor>
+  void for_each(const ChunkOffset begin_offset, const ChunkOffset end_offset, const Functor& functor) {
+    auto values = std::vector<std::optional<T>>(BLOCK_SIZE);
+
+    for (auto block_begin = begin_offset; block_begin < end_offset; block_begin += BLOCK_SIZE) {
+      const auto block_end = std::min(end_offset, static_cast<ChunkOffset>(block_begin + BLOCK_SIZE));
+      gather(block_begin, block_end, values.data());
+
+      for (auto offset = block_begin; offset < block_end; ++offset) {
+        functor(offset, values[offset - block_begin]);
+      }
+    }
+  }
+
+ private:
+  // A referenced RowID and the index in the output buffer that its value is written to
+  using Position = std::pair<RowID, ChunkOffset>;
+  using PositionIterator = typename std::vector<Position>::const_iterator;
+
+  const BaseSegment& _referenced_segment(const ChunkID chunk_id) {
+    // Grown on demand, as a gather often only reads from a few chunks
+    if (static_cast<size_t>(chunk_id) >= _referenced_segments.size()) _referenced_segments.resize(chunk_id + 1);
+
+    auto& referenced_segment = _referenced_segments[chunk_id];
+    if (!referenced_segment) {
+      referenced_segment =
+          _segment.referenced_table()->get_chunk(chunk_id)->get_segment(_segment.referenced_column_id());
+    }
+    return *referenced_segment;
+  }
+
+  void _gather_from_segment(const BaseSegment& segment, const PositionIterator group_begin,
+                            const PositionIterator group_end, std::optional<T>* output) const {
+    resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        Fail("Found ReferenceSegment pointing to ReferenceSegment");
+      } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {  // NOLINT(readability/braces)
+        const auto& values = typed_segment.values();
+        const auto* null_values = typed_segment.is_nullable() ? &typed_segment.null_values() : nullptr;
+
+        for (auto position = group_begin; position != group_end; ++position) {
+          if (static_cast<size_t>(std::distance(position, group_end)) > PREFETCH_DISTANCE) {
+            __builtin_prefetch(&values[(position + PREFETCH_DISTANCE)->first.chunk_offset]);
+          }
+
+          const auto chunk_offset = position->first.chunk_offset;
+          if (null_values && (*null_values)[chunk_offset]) {
+            output[position->second] = std::nullopt;
+          } else {
+            output[position->second] = values[chunk_offset];
+          }
+        }
+      } else {
+        // The positions of the values in encoded segments depend on their (compressed) layout, so they are not
+        // prefetched. Reading them in ascending order still benefits from the hardware prefetcher.
+        for (auto position = group_begin; position != group_end; ++position) {
+          output[position->second] = typed_segment.get_typed_value(position->first.chunk_offset);
+        }
+      }
+    });
+  }
+
+  const ReferenceSegment& _segment;
+  std::vector<std::shared_ptr<const BaseSegment>> _referenced_segments;
+  std::vector<Position> _block;
+};
+
+}  // namespace opossum
@@ -3,6 +3,8 @@
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "resolve_type.hpp"
 #include "storage/base_segment_accessor.hpp"
@@ -52,32 +54,48 @@ class SegmentAccessor : public BaseSegmentAccessor<T> {
 
 /**
  * For ReferenceSegments, we don't use the SegmentAccessor but either the MultipleChunkReferenceSegmentAccessor or the.
- * SingleChunkReferenceSegmentAccessor. The first one is generally applicable. For each offset that is accessed, a new
- * accessor has to be created. This is because we cannot be sure that two consecutive offsets reference the same chunk.
- * In the SingleChunkReferenceSegmentAccessor, we know that the same chunk is referenced, so we create the accessor
- * only once.
+ * SingleChunkReferenceSegmentAccessor. The first one is generally applicable. As we cannot be sure that two consecutive
+ * offsets reference the same chunk, it keeps one accessor per referenced chunk, which is created when the chunk is
+ * accessed for the first time. In the SingleChunkReferenceSegmentAccessor, we know that the same chunk is referenced,
+ * so we create the accessor only once.
+ * The accessors are cached in a mutable member, so a MultipleChunkReferenceSegmentAccessor must not be used by multiple
+ * threads concurrently (access() is not thread-safe). For reading many positions at once, see ReferenceSegmentGather.
  */
 template <typename T>
 class MultipleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
  public:
   explicit MultipleChunkReferenceSegmentAccessor(const ReferenceSegment& segment) : _segment{segment} {}
 
+  // Not thread-safe, as it creates and caches the accessor of a chunk when the chunk is accessed for the first time
   const std::optional<T> access(ChunkOffset offset) const final {
     const auto& referenced_row_id = (*_segment.pos_list())[offset];
     if (referenced_row_id.is_null()) return std::nullopt;
 
-    const auto& table = _segment.referenced_table();
-    const auto referenced_column_id = _segment.referenced_column_id();
     const auto referenced_chunk_id = referenced_row_id.chunk_id;
     const auto referenced_chunk_offset = referenced_row_id.chunk_offset;
 
-    const auto accessor =
-        create_segment_accessor<T>(table->get_chunk(referenced_chunk_id)->get_segment(referenced_column_id));
-    return accessor->access(referenced_chunk_offset);
+    // Consecutive positions often reference the same chunk, so the last accessor is used without a lookup
+    if (referenced_chunk_id != _last_chunk_id || !_last_accessor) {
+      auto& accessor = _accessors[referenced_chunk_id];
+      if (!accessor) {
+        const auto& table = _segment.referenced_table();
+        accessor = create_segment_accessor<T>(table->get_chunk(referenced_chunk_id)->get_segment(
+            _segment.referenced_column_id()));
+      }
+      _last_chunk_id = referenced_chunk_id;
+      _last_accessor = accessor.get();
+    }
+    return _last_accessor->access(referenced_chunk_offset);
   }
 
  protected:
   const ReferenceSegment& _segment;
+
+  // Only the accessors of referenced chunks are created, so that the accessor does not take up memory proportional to
+  // the size of the referenced table
+  mutable std::unordered_map<ChunkID, std::unique_ptr<BaseSegmentAccessor<T>>> _accessors;
+  mutable ChunkID _last_chunk_id{INVALID_CHUNK_ID};
+  mutable const BaseSegmentAccessor<T>* _last_accessor{nullptr};
 };
 
 // Accessor for ReferenceSegments that reference single chunks - see comment above
@@ -12,6 +12,7 @@
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/numa_placement_manager.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -24,6 +25,8 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
+  NUMAPlacementManager::get().place_table(*table);
+
   table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
   _tables.emplace(name, std::move(table));
 }
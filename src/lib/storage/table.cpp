@@ -9,6 +9,8 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/constraints/unique_constraint_index.hpp"
+#include "storage/index/table_index/b_tree_table_index.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -184,6 +186,65 @@ std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_
 
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
+void Table::create_table_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "Table indexes can only be created on data tables");
+  Assert(column_id < column_count(), "ColumnID out of range");
+  Assert(!get_table_index(column_id), "There already is a table index on column " + column_name(column_id));
+
+  const auto table_index = make_table_index(*this, column_id);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count(); ++chunk_id) {
+    table_index->insert_chunk(*this, chunk_id);
+  }
+  _table_indexes.emplace_back(table_index);
+}
+
+std::shared_ptr<BaseTableIndex> Table::get_table_index(const ColumnID column_id) const {
+  const auto iter = std::find_if(_table_indexes.begin(), _table_indexes.end(),
+                                 [&](const auto& table_index) { return table_index->column_id() == column_id; });
+  return iter != _table_indexes.end() ? *iter : nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseTableIndex>>& Table::table_indexes() const { return _table_indexes; }
+
+void Table::add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key) {
+  Assert(_type == TableType::Data, "Constraints can only be added to data tables");
+  Assert(!column_ids.empty(), "A constraint needs at least one column");
+
+  for (const auto column_id : column_ids) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+    Assert(std::count(column_ids.begin(), column_ids.end(), column_id) == 1, "Constraint contains a column twice");
+    Assert(is_primary_key == IsPrimaryKey::No || !column_is_nullable(column_id),
+           "Primary key column '" + column_name(column_id) + "' must not be nullable");
+  }
+
+  if (is_primary_key == IsPrimaryKey::Yes) {
+    const auto constraints = get_unique_constraints();
+    Assert(std::none_of(constraints.begin(), constraints.end(),
+                        [](const auto& constraint) { return constraint.is_primary_key == IsPrimaryKey::Yes; }),
+           "Table already has a primary key");
+  }
+
+  const auto constraint_index =
+      std::make_shared<UniqueConstraintIndex>(TableConstraintDefinition{column_ids, is_primary_key});
+  const auto existing_rows_are_valid = constraint_index->insert_table(*this);
+  Assert(existing_rows_are_valid, "Existing rows violate the constraint");
+
+  _unique_constraint_indexes.emplace_back(constraint_index);
+}
+
+TableConstraintDefinitions Table::get_unique_constraints() const {
+  auto constraints = TableConstraintDefinitions{};
+  constraints.reserve(_unique_constraint_indexes.size());
+  for (const auto& constraint_index : _unique_constraint_indexes) {
+    constraints.emplace_back(constraint_index->definition());
+  }
+  return constraints;
+}
+
+const std::vector<std::shared_ptr<UniqueConstraintIndex>>& Table::unique_constraint_indexes() const {
+  return _unique_constraint_indexes;
+}
+
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -195,10 +256,28 @@ size_t Table::estimate_memory_usage() const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_index : _table_indexes) {
+    bytes += table_index->memory_consumption();
+  }
+
   // TODO(anybody) Statistics and Indices missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
   return bytes;
 }
 
+uint64_t Table::version() const { return _version.load(); }
+
+void Table::increment_version() { ++_version; }
+
+CommitID Table::last_commit_id() const { return _last_commit_id.load(); }
+
+void Table::register_commit(const CommitID commit_id) const {
+  // Commits are applied concurrently, so a later commit might have been registered already
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {
+  }
+  ++_version;
+}
+
 }  // namespace opossum
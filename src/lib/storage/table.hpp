@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -10,6 +11,7 @@
 #include "chunk.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -17,7 +19,9 @@
 
 namespace opossum {
 
+class BaseTableIndex;
 class TableStatistics;
+class UniqueConstraintIndex;
 
 /**
  * A Table is partitioned horizontally into a number of chunks.
@@ -157,11 +161,59 @@ class Table : private Noncopyable {
     _indexes.emplace_back(i);
   }
 
+  /**
+   * @defgroup Table-wide indexes, see BaseTableIndex. In contrast to the chunk indexes created by create_index(),
+   * they cover all chunks (including mutable ones) and are maintained by the Insert operator. Creating a table index
+   * while rows are being inserted is not supported.
+   * @{
+   */
+
+  // Creates a table index on the given column, indexing all existing rows. Fails if one already exists.
+  void create_table_index(const ColumnID column_id);
+
+  // Returns the table index on the given column or nullptr if there is none
+  std::shared_ptr<BaseTableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseTableIndex>>& table_indexes() const;
+
+  /** @} */
+
+  /**
+   * @defgroup UNIQUE and PRIMARY KEY constraints. They are enforced by the Insert operator, see UniqueConstraintIndex.
+   * @{
+   */
+
+  // Fail()s if the existing rows violate the constraint or if a second primary key is added
+  void add_unique_constraint(const std::vector<ColumnID>& column_ids,
+                             const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+
+  TableConstraintDefinitions get_unique_constraints() const;
+
+  const std::vector<std::shared_ptr<UniqueConstraintIndex>>& unique_constraint_indexes() const;
+
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
   size_t estimate_memory_usage() const;
 
+  /**
+   * @defgroup Versioning, used by the QueryResultCache to decide whether a cached result is still valid.
+   * @{
+   */
+
+  // Incremented whenever the table changes, i.e., when rows are committed or chunks are replaced
+  uint64_t version() const;
+  void increment_version();
+
+  // Commit ID of the most recent commit that inserted or deleted rows. It is set (and the version incremented) while
+  // the commit is being applied, i.e., before the commit ID becomes visible to new transactions.
+  CommitID last_commit_id() const;
+  void register_commit(const CommitID commit_id) const;
+
+  /** @} */
+
  protected:
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
@@ -171,5 +223,10 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::vector<std::shared_ptr<BaseTableIndex>> _table_indexes;
+  std::vector<std::shared_ptr<UniqueConstraintIndex>> _unique_constraint_indexes;
+  // Mutable, as Delete registers its commit with the const tables referenced by its input
+  mutable std::atomic<uint64_t> _version{0};
+  mutable std::atomic<CommitID> _last_commit_id{0};
 };
 }  // namespace opossum
@@ -0,0 +1,13 @@
+#include "table_constraint_definition.hpp"
+
+namespace opossum {
+
+TableConstraintDefinition::TableConstraintDefinition(const std::vector<ColumnID>& columns,
+                                                     const IsPrimaryKey is_primary_key)
+    : columns(columns), is_primary_key(is_primary_key) {}
+
+bool TableConstraintDefinition::operator==(const TableConstraintDefinition& rhs) const {
+  return columns == rhs.columns && is_primary_key == rhs.is_primary_key;
+}
+
+}  // namespace opossum
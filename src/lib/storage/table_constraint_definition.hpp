@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class IsPrimaryKey : bool { Yes = true, No = false };
+
+/**
+ * Declares the values of a set of columns to be unique (UNIQUE) or, additionally, to not contain NULLs (PRIMARY KEY).
+ * As in SQL, a UNIQUE constraint does not prevent multiple rows with NULL in one of the columns.
+ */
+struct TableConstraintDefinition final {
+  TableConstraintDefinition() = default;
+  TableConstraintDefinition(const std::vector<ColumnID>& columns,  // NOLINT - Implicit conversion is intended
+                            const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+
+  bool operator==(const TableConstraintDefinition& rhs) const;
+
+  std::vector<ColumnID> columns;
+  IsPrimaryKey is_primary_key{IsPrimaryKey::No};
+};
+
+// So that google test, e.g., prints readable error messages
+inline std::ostream& operator<<(std::ostream& stream, const TableConstraintDefinition& definition) {
+  stream << (definition.is_primary_key == IsPrimaryKey::Yes ? "PRIMARY KEY (" : "UNIQUE (");
+  for (auto column_idx = size_t{0}; column_idx < definition.columns.size(); ++column_idx) {
+    stream << definition.columns[column_idx];
+    if (column_idx + 1 < definition.columns.size()) stream << ", ";
+  }
+  stream << ")";
+  return stream;
+}
+
+using TableConstraintDefinitions = std::vector<TableConstraintDefinition>;
+
+}  // namespace opossum
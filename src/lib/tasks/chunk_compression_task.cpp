@@ -34,6 +34,8 @@ void ChunkCompressionTask::_on_execute() {
 
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
   }
+
+  table->increment_version();
 }
 
 bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
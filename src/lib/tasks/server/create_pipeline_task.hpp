@@ -6,6 +6,7 @@
 
 namespace opossum {
 
+class CancellationToken;
 class SQLPipeline;
 
 struct CreatePipelineResult {
@@ -18,8 +19,9 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::shared_ptr<CancellationToken> cancellation_token = nullptr)
+      : _sql(sql), _allow_load_table(allow_load_table), _cancellation_token(std::move(cancellation_token)) {}
 
  protected:
   void _on_execute() override;
@@ -31,6 +33,7 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
 
   const std::string _sql;
   const bool _allow_load_table;
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 
   std::string _file_name;
   std::string _table_name;
@@ -0,0 +1,110 @@
+#include "encode_server_query_result_task.hpp"
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "server/postgres_wire_handler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_gather.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+EncodeServerQueryResultTask::EncodeServerQueryResultTask(std::shared_ptr<const Table> table,
+                                                         const ChunkID begin_chunk_id)
+    : _table(std::move(table)), _begin_chunk_id(begin_chunk_id), _end_chunk_id(end_chunk_id(*_table, begin_chunk_id)) {}
+
+ChunkID EncodeServerQueryResultTask::end_chunk_id(const Table& table, const ChunkID begin_chunk_id) {
+  const auto chunk_count = table.chunk_count();
+
+  auto row_count = size_t{0};
+  auto chunk_id = begin_chunk_id;
+  while (chunk_id < chunk_count && row_count < BATCH_ROW_COUNT) {
+    row_count += table.get_chunk(chunk_id)->size();
+    ++chunk_id;
+  }
+  return chunk_id;
+}
+
+void EncodeServerQueryResultTask::_on_execute() {
+  try {
+    const auto batch_chunk_count = _end_chunk_id - _begin_chunk_id;
+    auto data_rows = std::make_shared<std::vector<OutputPacket>>(batch_chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(batch_chunk_count);
+    for (auto chunk_id = _begin_chunk_id; chunk_id < _end_chunk_id; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        _encode_chunk(*_table->get_chunk(chunk_id), (*data_rows)[chunk_id - _begin_chunk_id]);
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    _promise.set_value(std::move(data_rows));
+  } catch (const std::exception&) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+void EncodeServerQueryResultTask::_encode_chunk(const Chunk& chunk, OutputPacket& packet) {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+
+  // The values are converted to strings segment by segment, so that each segment is resolved only once instead of
+  // creating an AllTypeVariant for each value. Values are converted as type_cast_variant<pmr_string>() would do it.
+  auto value_strings = std::vector<std::string>(row_count * column_count);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+
+    resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      // @param value is nullptr for NULLs
+      const auto write_value_string = [&](const ChunkOffset chunk_offset, const ColumnDataType* value) {
+        auto& value_string = value_strings[chunk_offset * column_count + column_id];
+        if (!value) {
+          value_string = "NULL";
+        } else if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          value_string.assign(value->cbegin(), value->cend());
+        } else {
+          value_string = std::to_string(*value);
+        }
+      };
+
+      // Positions that are scattered across the referenced chunks (e.g., in the output of a join) are read by the
+      // ReferenceSegmentGather, which groups them by chunk instead of resolving each position through an accessor
+      const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+      if (reference_segment && !reference_segment->pos_list()->references_single_chunk()) {
+        auto gather = ReferenceSegmentGather<ColumnDataType>{*reference_segment};
+        gather.for_each(ChunkOffset{0}, static_cast<ChunkOffset>(row_count),
+                        [&](const auto chunk_offset, const auto& value) {
+                          write_value_string(chunk_offset, value ? &*value : nullptr);
+                        });
+        return;
+      }
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        write_value_string(position.chunk_offset(), position.is_null() ? nullptr : &position.value());
+      });
+    });
+  }
+
+  auto row_strings = std::vector<std::string>(column_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      row_strings[column_id] = std::move(value_strings[chunk_offset * column_count + column_id]);
+    }
+    PostgresWireHandler::write_data_row(packet, row_strings);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_server_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+struct OutputPacket;
+
+// This task encodes the rows of a batch of chunks of a result table as DataRow messages, so that the thread that runs
+// the session only has to send them. The session sends a result batch by batch, so that the encoded messages do not
+// have to be held in memory for the whole result and the first rows can be sent while the next batch is encoded. The
+// chunks of a batch are encoded in parallel, the future holds one packet with the messages of each chunk.
+class EncodeServerQueryResultTask : public AbstractServerTask<std::shared_ptr<const std::vector<OutputPacket>>> {
+ public:
+  // Batches are cut after the chunk that reaches this number of rows
+  static constexpr auto BATCH_ROW_COUNT = size_t{100'000};
+
+  // Encodes the chunks [begin_chunk_id, end_chunk_id(*table, begin_chunk_id))
+  EncodeServerQueryResultTask(std::shared_ptr<const Table> table, const ChunkID begin_chunk_id);
+
+  // Returns the end of the batch that begins with @param begin_chunk_id
+  static ChunkID end_chunk_id(const Table& table, const ChunkID begin_chunk_id);
+
+ protected:
+  void _on_execute() override;
+
+  static void _encode_chunk(const Chunk& chunk, OutputPacket& packet);
+
+  const std::shared_ptr<const Table> _table;
+  const ChunkID _begin_chunk_id;
+  const ChunkID _end_chunk_id;
+};
+
+}  // namespace opossum
@@ -1,22 +1,114 @@
 #include "execute_server_prepared_statement_task.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "concurrency/transaction_context.hpp"
-#include "concurrency/transaction_manager.hpp"
+#include "constant_mappings.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
 #include "operators/abstract_operator.hpp"
+#include "optimizer/optimizer.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/prepared_plan.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Key of the physical plan of a prepared statement in the SQLPhysicalPlanCache. As the key of a normalized statement
+// (see NormalizedSQL::cache_key), it contains the data types of the parameters. The prefix keeps it apart from the
+// keys of SQLPipelineStatements.
+std::string prepared_plan_cache_key(const std::string& query, const std::vector<AllTypeVariant>& params) {
+  auto cache_key = std::string{"PREPARED ["};
+  for (auto parameter_idx = size_t{0}; parameter_idx < params.size(); ++parameter_idx) {
+    if (parameter_idx > 0) cache_key += ", ";
+    cache_key += data_type_to_string.left.at(data_type_from_all_type_variant(params[parameter_idx]));
+  }
+  cache_key += "] ";
+  cache_key += query;
+  return cache_key;
+}
+
+}  // namespace
 
 namespace opossum {
 
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
-    const auto tasks = OperatorTask::make_tasks_from_operator(_prepared_plan, CleanupTemporaries::Yes);
+    Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
+
+    const auto pqp = _bind_parameters();
+    if (_transaction_context) pqp->set_transaction_context_recursively(_transaction_context);
+
+    const auto tasks = OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes);
+    if (_cancellation_token) {
+      for (const auto& task : tasks) {
+        task->set_cancellation_token(_cancellation_token);
+      }
+    }
     CurrentScheduler::schedule_and_wait_for_tasks(tasks);
-    auto result_table = tasks.back()->get_operator()->get_output();
-    _promise.set_value(std::move(result_table));
+
+    if (_cancellation_token && _cancellation_token->is_cancelled()) {
+      // The session rolls back the transaction
+      pqp->clear_output();
+      _cancellation_token->throw_if_cancelled();
+    }
+
+    _promise.set_value(pqp);
   } catch (const std::exception&) {
     _promise.set_exception(boost::current_exception());
   }
 }
 
+std::shared_ptr<AbstractOperator> ExecuteServerPreparedStatementTask::_bind_parameters() const {
+  // NULL has no data type that a plan could be specialized for. As for EXECUTE statements (see SQLTranslator), such
+  // values are filled into the LQP before it is optimized, and the resulting plan is not cached.
+  if (std::any_of(_params.cbegin(), _params.cend(), [](const auto& param) { return variant_is_null(param); })) {
+    auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>(_params.size());
+    for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+      parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
+    }
+
+    const auto lqp = _prepared_plan->instantiate(parameter_expressions);
+    return LQPTranslator{}.translate_node(Optimizer::create_default_optimizer()->optimize(lqp));
+  }
+
+  const auto cache_key = prepared_plan_cache_key(_query, _params);
+  auto cached_pqp = SQLPhysicalPlanCache::get().try_get(cache_key);
+  if (!cached_pqp) {
+    // Parameters are set during execution. Thus, the optimizer does not make decisions that depend on their values
+    // (see SQLPipelineStatement::_get_parameterized_logical_plan()).
+    auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>(_params.size());
+    for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+      const auto referenced_expression_info = CorrelatedParameterExpression::ReferencedExpressionInfo{
+          data_type_from_all_type_variant(_params[parameter_idx]), "?"};
+      parameter_expressions[parameter_idx] = std::make_shared<CorrelatedParameterExpression>(
+          _prepared_plan->parameter_ids[parameter_idx], referenced_expression_info);
+    }
+
+    const auto lqp = _prepared_plan->instantiate(parameter_expressions);
+    const auto pqp = LQPTranslator{}.translate_node(Optimizer::create_default_optimizer()->optimize(lqp));
+    SQLPhysicalPlanCache::get().set(cache_key, pqp, estimate_plan_memory_usage(pqp));
+    cached_pqp = pqp;
+  }
+
+  // The cached plan is never bound or executed, as other executions of the statement deep-copy it concurrently
+  const auto pqp = (*cached_pqp)->deep_copy();
+
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+    parameters.emplace(_prepared_plan->parameter_ids[parameter_idx], _params[parameter_idx]);
+  }
+  pqp->set_parameters(parameters);
+
+  return pqp;
+}
+
 }  // namespace opossum
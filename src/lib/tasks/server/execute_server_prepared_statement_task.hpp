@@ -1,23 +1,50 @@
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "abstract_server_task.hpp"
 
+#include "all_type_variant.hpp"
+
 namespace opossum {
 
 class AbstractOperator;
+class CancellationToken;
+class PreparedPlan;
 class TransactionContext;
-class Table;
 
-// This task takes a query plan of a prepared statement and executes it.
-class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
+// This task binds the parameters of a prepared statement and executes the resulting query plan. Both steps are done in
+// a single task, so that a prepared statement is only dispatched to the scheduler once per execution. The statement is
+// optimized and translated once per data types of its parameters. The physical plan, in which the parameters are
+// CorrelatedParameterExpressions, is stored in the SQLPhysicalPlanCache, keyed by these data types and the query. An
+// execution only deep-copies the cached plan and sets the values of the parameters. The future holds the root operator
+// of the executed plan, from which the result table can be retrieved. If the statement is cancelled through the token,
+// the future holds a QueryCancelledException.
+class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<AbstractOperator>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  ExecuteServerPreparedStatementTask(std::string query, std::shared_ptr<PreparedPlan> prepared_plan,
+                                     std::vector<AllTypeVariant> params,
+                                     std::shared_ptr<TransactionContext> transaction_context,
+                                     std::shared_ptr<CancellationToken> cancellation_token = nullptr)
+      : _query(std::move(query)),
+        _prepared_plan(std::move(prepared_plan)),
+        _params(std::move(params)),
+        _transaction_context(std::move(transaction_context)),
+        _cancellation_token(std::move(cancellation_token)) {}
 
  protected:
   void _on_execute() override;
 
-  std::shared_ptr<AbstractOperator> _prepared_plan;
+  // Returns a plan that is private to this execution and in which the parameters are bound
+  std::shared_ptr<AbstractOperator> _bind_parameters() const;
+
+  const std::string _query;
+  const std::shared_ptr<PreparedPlan> _prepared_plan;
+  const std::vector<AllTypeVariant> _params;
+  const std::shared_ptr<TransactionContext> _transaction_context;
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "parse_server_prepared_statement_task.hpp"
 
 #include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/prepared_plan.hpp"
 
@@ -14,7 +15,8 @@ void ParseServerPreparedStatementTask::_on_execute() {
     Assert(prepared_plans.size() == 1u, "Only a single statement allowed in prepared statement");
 
     auto prepared_plan =
-        std::make_unique<PreparedPlan>(prepared_plans[0], sql_translator.parameter_ids_of_value_placeholders());
+        std::make_shared<PreparedPlan>(prepared_plans[0], sql_translator.parameter_ids_of_value_placeholders());
+    SQLPreparedPlanCache::get().set(_query, prepared_plan, estimate_plan_memory_usage(prepared_plan->lqp));
 
     _promise.set_value(std::move(prepared_plan));
   } catch (const std::exception&) {
@@ -8,7 +8,9 @@ namespace opossum {
 
 class PreparedPlan;
 
-class ParseServerPreparedStatementTask : public AbstractServerTask<std::unique_ptr<PreparedPlan>> {
+// This task translates the query of a prepared statement into a PreparedPlan. The plan is added to the
+// SQLPreparedPlanCache, so that other sessions that prepare the same query can use it without scheduling this task.
+class ParseServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<PreparedPlan>> {
  public:
   explicit ParseServerPreparedStatementTask(const std::string& query) : _query(query) {}
 
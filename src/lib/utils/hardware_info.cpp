@@ -0,0 +1,101 @@
+#include "hardware_info.hpp"
+
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "utils/format_bytes.hpp"
+
+namespace {
+
+// Parses sizes as sysfs reports them, e.g., "48K" or "2048K"
+size_t parse_size(const std::string& size_string) {
+  auto stream = std::stringstream{size_string};
+  auto size = size_t{0};
+  auto unit = char{0};
+  stream >> size >> unit;
+
+  if (unit == 'K') return size * 1024;
+  if (unit == 'M') return size * 1024 * 1024;
+  if (unit == 'G') return size * 1024 * 1024 * 1024;
+  return size;
+}
+
+// Returns the first line of the file or an empty string if it cannot be read
+std::string read_line(const std::string& path) {
+  auto file = std::ifstream{path};
+  auto line = std::string{};
+  std::getline(file, line);
+  return line;
+}
+
+}  // namespace
+
+namespace opossum {
+
+HardwareInfo::HardwareInfo() {
+  // sysfs lists the caches of a core as index0, index1, ... The first level is split into a data and an instruction
+  // cache, the other levels are unified.
+  for (auto cache_index = 0; cache_index < 8; ++cache_index) {
+    const auto cache_directory = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(cache_index) + "/";
+    const auto level = read_line(cache_directory + "level");
+    const auto type = read_line(cache_directory + "type");
+    const auto size = parse_size(read_line(cache_directory + "size"));
+    if (level.empty() || size == 0) continue;
+
+    if (level == "1" && type == "Data") {
+      _l1_data_cache_size = size;
+    } else if (level == "2" && type != "Instruction") {
+      _l2_cache_size = size;
+    } else if (level == "3" && type != "Instruction") {
+      _l3_cache_size = size;
+    }
+  }
+
+  const auto base_page_size = sysconf(_SC_PAGESIZE);
+  if (base_page_size > 0) _page_size = static_cast<size_t>(base_page_size);
+
+  // The active setting is marked by brackets, e.g., "always [madvise] never"
+  if (read_line("/sys/kernel/mm/transparent_hugepage/enabled").find("[always]") != std::string::npos) {
+    const auto huge_page_size = parse_size(read_line("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size"));
+    if (huge_page_size > 0) _page_size = huge_page_size;
+  }
+
+  // E.g., "TLB size        : 3072 4K pages"
+  auto cpuinfo = std::ifstream{"/proc/cpuinfo"};
+  auto line = std::string{};
+  while (std::getline(cpuinfo, line)) {
+    if (line.compare(0, 8, "TLB size") != 0) continue;
+
+    const auto colon_position = line.find(':');
+    if (colon_position == std::string::npos) break;
+
+    auto stream = std::stringstream{line.substr(colon_position + 1)};
+    auto tlb_entries = size_t{0};
+    if (stream >> tlb_entries && tlb_entries > 0) _tlb_entries = tlb_entries;
+    break;
+  }
+}
+
+size_t HardwareInfo::l1_data_cache_size() const { return _l1_data_cache_size; }
+
+size_t HardwareInfo::l2_cache_size() const { return _l2_cache_size; }
+
+size_t HardwareInfo::l3_cache_size() const { return _l3_cache_size; }
+
+size_t HardwareInfo::page_size() const { return _page_size; }
+
+size_t HardwareInfo::tlb_entries() const { return _tlb_entries; }
+
+size_t HardwareInfo::tlb_reach() const { return _tlb_entries * _page_size; }
+
+std::string HardwareInfo::to_string() const {
+  auto stream = std::stringstream{};
+  stream << "L1d " << format_bytes(_l1_data_cache_size) << ", L2 " << format_bytes(_l2_cache_size) << ", L3 "
+         << format_bytes(_l3_cache_size) << ", " << _tlb_entries << " TLB entries of " << format_bytes(_page_size);
+  return stream.str();
+}
+
+}  // namespace opossum
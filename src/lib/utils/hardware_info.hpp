@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Sizes of the caches and the TLB of the machine, as needed to size cache-conscious data structures such as the
+ * partitions of JoinHash. They are read once, on the first call to get():
+ *  - The cache sizes are read from sysfs (/sys/devices/system/cpu/cpu0/cache). We assume that all cores are equal.
+ *  - The page size of large allocations is the size of transparent huge pages if the kernel backs all large
+ *    allocations with them (i.e., /sys/kernel/mm/transparent_hugepage/enabled is "always"), and the base page size
+ *    otherwise.
+ *  - The number of TLB entries is not exposed by sysfs. We take it from /proc/cpuinfo where available (AMD CPUs report
+ *    the size of their second level TLB there) and otherwise assume the 1536 entries of the second level TLB of
+ *    current Intel cores.
+ *
+ * Values that cannot be read (e.g., on macOS) fall back to conservative defaults.
+ */
+class HardwareInfo : public Singleton<HardwareInfo> {
+ public:
+  size_t l1_data_cache_size() const;
+  size_t l2_cache_size() const;
+  size_t l3_cache_size() const;
+
+  size_t page_size() const;
+  size_t tlb_entries() const;
+
+  // The memory that the TLB covers when large allocations are accessed, i.e., tlb_entries() * page_size()
+  size_t tlb_reach() const;
+
+  std::string to_string() const;
+
+ protected:
+  friend class Singleton;
+  HardwareInfo();
+
+  size_t _l1_data_cache_size = 32 * 1024;
+  size_t _l2_cache_size = 256 * 1024;
+  size_t _l3_cache_size = 8 * 1024 * 1024;
+  size_t _page_size = 4096;
+  size_t _tlb_entries = 1536;
+};
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFile::MappedFile(const std::string& filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  if (file_descriptor < 0) throw std::system_error(errno, std::generic_category(), "Could not open file " + filename);
+
+  struct stat file_stat {};
+  const auto stat_result = fstat(file_descriptor, &file_stat);
+  if (stat_result == 0 && file_stat.st_size > 0) {
+    _size = static_cast<size_t>(file_stat.st_size);
+    _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  }
+  const auto error = std::string{std::strerror(errno)};
+
+  // The mapping stays valid after the file is closed
+  close(file_descriptor);
+
+  Assert(stat_result == 0 && _data != MAP_FAILED, "Could not map file " + filename + ": " + error);
+  if (_data) madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+MappedFile::~MappedFile() {
+  if (_data) munmap(_data, _size);
+}
+
+std::string_view MappedFile::content() const { return {static_cast<const char*>(_data), _size}; }
+
+void MappedFile::release(const size_t end) const {
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto release_size = std::min(end, _size) / page_size * page_size;
+  if (release_size > 0) madvise(_data, release_size, MADV_DONTNEED);
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Read-only memory mapping of a file. Instead of copying the file into memory up front, its pages are read by the
+ * operating system when they are first accessed. Pages that are not needed anymore can be handed back with release().
+ */
+class MappedFile final : private Noncopyable {
+ public:
+  // Throws std::system_error if the file cannot be opened, so that callers can handle missing files
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  // The content of the file, valid as long as the MappedFile exists
+  std::string_view content() const;
+
+  /**
+   * Allows the operating system to drop the pages before the given position. They are transparently read from the
+   * file again if they are accessed later.
+   */
+  void release(const size_t end) const;
+
+ private:
+  void* _data{nullptr};
+  size_t _size{0};
+};
+
+}  // namespace opossum
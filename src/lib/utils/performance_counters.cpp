@@ -0,0 +1,214 @@
+#include "performance_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The members of PerformanceCounterValues in the order of PerformanceCounters::Sample::counts
+constexpr auto COUNTER_MEMBERS = std::array<std::optional<uint64_t> PerformanceCounterValues::*,
+                                            PerformanceCounters::COUNTER_COUNT>{
+    &PerformanceCounterValues::cycles, &PerformanceCounterValues::instructions, &PerformanceCounterValues::llc_misses,
+    &PerformanceCounterValues::branch_misses, &PerformanceCounterValues::dtlb_misses};
+
+std::atomic_bool performance_counters_enabled{false};
+
+#if defined(__linux__)
+
+struct PerfEvent {
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr auto PERF_EVENTS = std::array<PerfEvent, PerformanceCounters::COUNTER_COUNT>{
+    {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+     // The kernel maps the generic cache misses to the misses of the last level cache
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+     {PERF_TYPE_HW_CACHE,
+      PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)}}};
+
+// The counters of one thread. They are opened on the first use in a thread and closed when the thread exits.
+class ThreadCounterGroup {
+ public:
+  ThreadCounterGroup() {
+    for (auto counter_id = size_t{0}; counter_id < PerformanceCounters::COUNTER_COUNT; ++counter_id) {
+      auto attributes = perf_event_attr{};
+      attributes.size = sizeof(perf_event_attr);
+      attributes.type = PERF_EVENTS[counter_id].type;
+      attributes.config = PERF_EVENTS[counter_id].config;
+      // Excluding the kernel is required for unprivileged users with the default perf_event_paranoid level
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format =
+          PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      // Counters that cannot be opened are skipped. The first counter that can be opened leads the group.
+      const auto fd = static_cast<int>(
+          syscall(__NR_perf_event_open, &attributes, 0, -1, _leader_fd, static_cast<unsigned>(PERF_FLAG_FD_CLOEXEC)));
+      if (fd == -1) continue;
+
+      auto id = uint64_t{0};
+      if (ioctl(fd, PERF_EVENT_IOC_ID, &id) == -1) {
+        close(fd);
+        continue;
+      }
+
+      if (_leader_fd == -1) _leader_fd = fd;
+      _fds[counter_id] = fd;
+      _ids[counter_id] = id;
+    }
+  }
+
+  ~ThreadCounterGroup() {
+    for (const auto fd : _fds) {
+      if (fd != -1) close(fd);
+    }
+  }
+
+  ThreadCounterGroup(const ThreadCounterGroup&) = delete;
+  ThreadCounterGroup& operator=(const ThreadCounterGroup&) = delete;
+
+  bool is_available() const { return _leader_fd != -1; }
+
+  std::optional<PerformanceCounters::Sample> sample() const {
+    if (_leader_fd == -1) return std::nullopt;
+
+    // Layout of PERF_FORMAT_GROUP: {nr, time_enabled, time_running, {value, id}[nr]}
+    auto buffer = std::array<uint64_t, 3 + 2 * PerformanceCounters::COUNTER_COUNT>{};
+    if (read(_leader_fd, buffer.data(), sizeof(buffer)) == -1) return std::nullopt;
+
+    auto sample = PerformanceCounters::Sample{};
+    sample.time_enabled = buffer[1];
+    sample.time_running = buffer[2];
+
+    const auto value_count = std::min(static_cast<size_t>(buffer[0]), PerformanceCounters::COUNTER_COUNT);
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      const auto value = buffer[3 + 2 * value_idx];
+      const auto id = buffer[3 + 2 * value_idx + 1];
+      for (auto counter_id = size_t{0}; counter_id < PerformanceCounters::COUNTER_COUNT; ++counter_id) {
+        if (_fds[counter_id] != -1 && _ids[counter_id] == id) sample.counts[counter_id] = value;
+      }
+    }
+
+    return sample;
+  }
+
+ private:
+  int _leader_fd{-1};
+  std::array<int, PerformanceCounters::COUNTER_COUNT> _fds{-1, -1, -1, -1, -1};
+  std::array<uint64_t, PerformanceCounters::COUNTER_COUNT> _ids{};
+};
+
+const ThreadCounterGroup& thread_counter_group() {
+  thread_local const auto counter_group = ThreadCounterGroup{};
+  return counter_group;
+}
+
+std::optional<PerformanceCounters::Sample> sample_thread_counters() { return thread_counter_group().sample(); }
+
+#else
+
+std::optional<PerformanceCounters::Sample> sample_thread_counters() { return std::nullopt; }
+
+#endif
+
+}  // namespace
+
+namespace opossum {
+
+bool PerformanceCounterValues::empty() const {
+  for (const auto member : COUNTER_MEMBERS) {
+    if (this->*member) return false;
+  }
+  return true;
+}
+
+PerformanceCounterValues& PerformanceCounterValues::operator+=(const PerformanceCounterValues& other) {
+  for (const auto member : COUNTER_MEMBERS) {
+    if (!(other.*member)) continue;
+    this->*member = (this->*member).value_or(0) + *(other.*member);
+  }
+  return *this;
+}
+
+std::string PerformanceCounterValues::to_string() const {
+  auto stream = std::stringstream{};
+  auto separator = "";
+
+  const auto append = [&](const std::optional<uint64_t>& count, const char* name) {
+    if (!count) return;
+    stream << separator << *count << " " << name;
+    separator = ", ";
+  };
+
+  append(cycles, "cycles");
+  append(instructions, "instructions");
+  if (cycles && instructions && *cycles > 0) {
+    stream << " (IPC " << std::fixed << std::setprecision(2)
+           << static_cast<double>(*instructions) / static_cast<double>(*cycles) << ")";
+  }
+  append(llc_misses, "LLC misses");
+  append(branch_misses, "branch misses");
+  append(dtlb_misses, "dTLB misses");
+
+  return stream.str();
+}
+
+PerformanceCounters::PerformanceCounters() {
+  if (is_enabled()) _begin = sample_thread_counters();
+}
+
+PerformanceCounterValues PerformanceCounters::lap() {
+  if (!_begin) return {};
+
+  const auto end = sample_thread_counters();
+  if (!end) return {};
+
+  // If the group was not scheduled on the CPU all of the time, the counts are extrapolated to the time it was enabled
+  const auto time_enabled = end->time_enabled - _begin->time_enabled;
+  const auto time_running = end->time_running - _begin->time_running;
+  const auto scale = time_running > 0 && time_running < time_enabled
+                         ? static_cast<double>(time_enabled) / static_cast<double>(time_running)
+                         : 1.0;
+
+  auto values = PerformanceCounterValues{};
+  for (auto counter_id = size_t{0}; counter_id < COUNTER_COUNT; ++counter_id) {
+    const auto& begin_count = _begin->counts[counter_id];
+    const auto& end_count = end->counts[counter_id];
+    if (!begin_count || !end_count) continue;
+
+    values.*COUNTER_MEMBERS[counter_id] =
+        static_cast<uint64_t>(static_cast<double>(*end_count - *begin_count) * scale);
+  }
+
+  _begin = end;
+  return values;
+}
+
+void PerformanceCounters::set_enabled(const bool enabled) { performance_counters_enabled = enabled; }
+
+bool PerformanceCounters::is_enabled() { return performance_counters_enabled; }
+
+bool PerformanceCounters::is_available() {
+#if defined(__linux__)
+  return thread_counter_group().is_available();
+#else
+  return false;
+#endif
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace opossum {
+
+/**
+ * Counts of hardware events. A counter is std::nullopt if it is not available (e.g., because the CPU or the
+ * virtualization layer does not expose it), so that it is not mistaken for an event that did not occur.
+ */
+struct PerformanceCounterValues {
+  std::optional<uint64_t> cycles;
+  std::optional<uint64_t> instructions;
+  std::optional<uint64_t> llc_misses;
+  std::optional<uint64_t> branch_misses;
+  std::optional<uint64_t> dtlb_misses;
+
+  // True if no counter is available
+  bool empty() const;
+
+  // Adds the counters of @param other. A counter is available in the sum if it is available in either summand.
+  PerformanceCounterValues& operator+=(const PerformanceCounterValues& other);
+
+  // E.g., "1234567 cycles, 2345678 instructions (IPC 1.90), 1234 LLC misses, 567 branch misses, 89 dTLB misses"
+  std::string to_string() const;
+};
+
+/**
+ * Reads the hardware performance counters of the calling thread using perf_event_open(2). Like Timer, it starts
+ * counting on construction, and lap() returns the events since the construction or the last call to lap().
+ *
+ * The counters are disabled by default and have to be enabled with set_enabled(). When they are disabled, not
+ * supported by the platform, or not permitted (see /proc/sys/kernel/perf_event_paranoid), lap() returns empty values,
+ * so that callers do not have to distinguish these cases. The events of each thread are opened once as one group,
+ * which is multiplexed as a whole if the CPU has too few counter registers. The counts are scaled accordingly.
+ *
+ * Only user space events of the calling thread are counted. Thus, an operator that is executed with the scheduler
+ * would not count the jobs that it spawns on other workers, but it would count other tasks that its worker processes
+ * while waiting for these jobs. Therefore, operators do not record the counters while a scheduler is set.
+ */
+class PerformanceCounters final {
+ public:
+  PerformanceCounters();
+
+  PerformanceCounterValues lap();
+
+  static void set_enabled(const bool enabled);
+  static bool is_enabled();
+
+  // Whether any counter can be opened for the calling thread
+  static bool is_available();
+
+  static constexpr auto COUNTER_COUNT = size_t{5};
+
+  // The raw counts of the calling thread's counters, as reported by the kernel
+  struct Sample {
+    std::array<std::optional<uint64_t>, COUNTER_COUNT> counts;
+    uint64_t time_enabled{0};
+    uint64_t time_running{0};
+  };
+
+ private:
+  std::optional<Sample> _begin;
+};
+
+}  // namespace opossum
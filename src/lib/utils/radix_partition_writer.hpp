@@ -0,0 +1,189 @@
+#pragma once
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/hardware_info.hpp"
+
+namespace opossum {
+
+enum class RadixPartitionWriteMode {
+  // Each element is written to its partition right away
+  Direct,
+  // Elements are collected in cache-line-sized buffers, which are written to the partitions as whole cache lines
+  WriteCombining
+};
+
+/**
+ * Scatters elements into partitions, as done by radix partitioning after the partition sizes have been determined
+ * from a histogram. Writing each element directly to its partition touches a different cache line and page for each
+ * partition. Once the fan-out exceeds the first level TLB and the line fill buffers, most of these writes stall.
+ *
+ * With RadixPartitionWriteMode::WriteCombining, the elements of each partition are collected in a buffer that mirrors
+ * the cache line of the output that they are written to (software write-combining, see Balkesen et al., "Main-Memory
+ * Hash Joins on Multi-Core CPUs: Tuning to the Underlying Hardware"). The buffers of all partitions fit into the
+ * cache. Once a line is complete, it is written to the output with non-temporal stores, which bypass the cache and do
+ * not have to read the line from memory before overwriting it. The first and the last line of a partition may be
+ * shared with other partitions or writers and are written with regular stores.
+ *
+ * Write-combining is only applied to trivially copyable elements. Elements of other types are written directly.
+ *
+ * The writer is used by a single thread. Multiple writers may write to disjoint ranges of the same partition, as done
+ * when the chunks of a table are partitioned in parallel. flush() has to be called after the last write.
+ */
+template <typename Element>
+class RadixPartitionWriter final {
+ public:
+  static constexpr auto CACHE_LINE_SIZE = size_t{64};
+
+  // @param write_positions holds the position to which the next element of each partition is written
+  RadixPartitionWriter(std::vector<Element*> write_positions, const RadixPartitionWriteMode mode)
+      : _write_positions(std::move(write_positions)),
+        _write_combining(WRITE_COMBINING_SUPPORTED && mode == RadixPartitionWriteMode::WriteCombining) {
+    if (!_write_combining) return;
+
+    const auto partition_count = _write_positions.size();
+    _lines.resize(partition_count);
+    _output_lines.resize(partition_count);
+    _line_begins.resize(partition_count);
+    _line_ends.resize(partition_count);
+
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      const auto address = reinterpret_cast<uintptr_t>(_write_positions[partition_id]);
+      _output_lines[partition_id] = reinterpret_cast<char*>(address & ~uintptr_t{CACHE_LINE_SIZE - 1});
+      _line_begins[partition_id] = address & (CACHE_LINE_SIZE - 1);
+      _line_ends[partition_id] = _line_begins[partition_id];
+    }
+  }
+
+  // Writes the elements of partition i to @param output, beginning at @param output_offsets[i]
+  RadixPartitionWriter(Element* output, const std::vector<size_t>& output_offsets, const RadixPartitionWriteMode mode)
+      : RadixPartitionWriter(_write_positions_from_offsets(output, output_offsets), mode) {}
+
+  RadixPartitionWriter(const RadixPartitionWriter&) = delete;
+  RadixPartitionWriter& operator=(const RadixPartitionWriter&) = delete;
+
+  void write(const size_t partition_id, const Element& element) {
+    DebugAssert(partition_id < _write_positions.size(), "Partition id out of range");
+
+    if constexpr (WRITE_COMBINING_SUPPORTED) {
+      if (_write_combining) {
+        auto* const line = _lines[partition_id].bytes;
+        const auto line_end = _line_ends[partition_id];
+        const auto remaining_size = CACHE_LINE_SIZE - line_end;
+
+        if (sizeof(Element) < remaining_size) {
+          std::memcpy(line + line_end, &element, sizeof(Element));
+          _line_ends[partition_id] = line_end + sizeof(Element);
+          return;
+        }
+
+        // The element completes the line. Its remainder, if any, begins the next line.
+        const auto* const element_bytes = reinterpret_cast<const char*>(&element);
+        std::memcpy(line + line_end, element_bytes, remaining_size);
+        _write_line(partition_id);
+        std::memcpy(line, element_bytes + remaining_size, sizeof(Element) - remaining_size);
+        _line_ends[partition_id] = sizeof(Element) - remaining_size;
+        return;
+      }
+    }
+
+    *_write_positions[partition_id] = element;
+    ++_write_positions[partition_id];
+  }
+
+  // Writes the partially filled lines
+  void flush() {
+    if (!_write_combining) return;
+
+    for (auto partition_id = size_t{0}; partition_id < _write_positions.size(); ++partition_id) {
+      const auto line_begin = _line_begins[partition_id];
+      std::memcpy(_output_lines[partition_id] + line_begin, _lines[partition_id].bytes + line_begin,
+                  _line_ends[partition_id] - line_begin);
+      _line_begins[partition_id] = _line_ends[partition_id];
+    }
+
+#if defined(__SSE2__)
+    // Non-temporal stores are weakly ordered. The fence makes them visible before the stores that follow it (e.g., the
+    // ones that signal the completion of the partitioning job).
+    _mm_sfence();
+#endif
+  }
+
+  /**
+   * Write-combining pays off if the partitions do not fit into the first level TLB (which usually holds 64 entries)
+   * while their buffers take up no more than a quarter of the L2 cache (leaving room for the input and the write
+   * positions), and if the output is too large to stay in the cache until it is read, so that it can bypass the
+   * cache. Otherwise, writing directly is faster.
+   */
+  static RadixPartitionWriteMode choose_mode(const size_t partition_count, const size_t element_count) {
+    const auto& hardware_info = HardwareInfo::get();
+    if (partition_count <= 64 || partition_count * CACHE_LINE_SIZE > hardware_info.l2_cache_size() / 4) {
+      return RadixPartitionWriteMode::Direct;
+    }
+    if (element_count * sizeof(Element) <= hardware_info.l3_cache_size()) return RadixPartitionWriteMode::Direct;
+    return RadixPartitionWriteMode::WriteCombining;
+  }
+
+ private:
+  static constexpr auto WRITE_COMBINING_SUPPORTED =
+      std::is_trivially_copyable_v<Element> && sizeof(Element) <= CACHE_LINE_SIZE;
+
+  struct alignas(CACHE_LINE_SIZE) Line {
+    char bytes[CACHE_LINE_SIZE];
+  };
+
+  static std::vector<Element*> _write_positions_from_offsets(Element* output,
+                                                             const std::vector<size_t>& output_offsets) {
+    auto write_positions = std::vector<Element*>(output_offsets.size());
+    for (auto partition_id = size_t{0}; partition_id < output_offsets.size(); ++partition_id) {
+      write_positions[partition_id] = output + output_offsets[partition_id];
+    }
+    return write_positions;
+  }
+
+  // Writes the complete buffered line of the partition to the output and moves on to the next line
+  void _write_line(const size_t partition_id) {
+    const auto* const line = _lines[partition_id].bytes;
+    auto* const output_line = _output_lines[partition_id];
+    const auto line_begin = _line_begins[partition_id];
+
+    if (line_begin == 0) {
+#if defined(__SSE2__)
+      const auto* const source = reinterpret_cast<const __m128i*>(line);
+      auto* const target = reinterpret_cast<__m128i*>(output_line);
+      _mm_stream_si128(target, _mm_load_si128(source));
+      _mm_stream_si128(target + 1, _mm_load_si128(source + 1));
+      _mm_stream_si128(target + 2, _mm_load_si128(source + 2));
+      _mm_stream_si128(target + 3, _mm_load_si128(source + 3));
+#else
+      std::memcpy(output_line, line, CACHE_LINE_SIZE);
+#endif
+    } else {
+      std::memcpy(output_line + line_begin, line + line_begin, CACHE_LINE_SIZE - line_begin);
+    }
+
+    _output_lines[partition_id] += CACHE_LINE_SIZE;
+    _line_begins[partition_id] = 0;
+  }
+
+  std::vector<Element*> _write_positions;
+  const bool _write_combining;
+
+  // For write-combining: the buffered line of each partition, the line of the output that it mirrors, and the range
+  // of the line that holds buffered bytes
+  std::vector<Line> _lines;
+  std::vector<char*> _output_lines;
+  std::vector<size_t> _line_begins;
+  std::vector<size_t> _line_ends;
+};
+
+}  // namespace opossum
@@ -115,6 +115,8 @@ void PQPVisualizer::_add_operator(const std::shared_ptr<const AbstractOperator>&
   if (op->get_output()) {
     auto total = op->performance_data().walltime;
     label += "\n\n" + format_duration(total);
+    const auto& performance_counters = op->performance_data().performance_counters;
+    if (!performance_counters.empty()) label += "\n" + performance_counters.to_string();
     info.pen_width = std::fmax(1, std::ceil(std::log10(total.count()) / 2));
   }
 
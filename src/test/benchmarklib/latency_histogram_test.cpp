@@ -0,0 +1,110 @@
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "latency_histogram.hpp"
+
+namespace {
+
+std::chrono::nanoseconds::rep to_nanoseconds(const opossum::Duration duration) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+}  // namespace
+
+namespace opossum {
+
+class LatencyHistogramTest : public ::testing::Test {
+ protected:
+  // The value that a histogram reports for a single recorded value
+  static uint64_t reported_value(const uint64_t value) {
+    auto histogram = LatencyHistogram{};
+    histogram.record(std::chrono::nanoseconds{value});
+    return static_cast<uint64_t>(to_nanoseconds(histogram.value_at_percentile(100.0)));
+  }
+};
+
+TEST_F(LatencyHistogramTest, Empty) {
+  const auto histogram = LatencyHistogram{};
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(0.0)), 0);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(50.0)), 0);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(100.0)), 0);
+}
+
+TEST_F(LatencyHistogramTest, SmallValuesAreExact) {
+  for (auto value = uint64_t{0}; value < LatencyHistogram::SUB_BUCKET_COUNT; ++value) {
+    EXPECT_EQ(reported_value(value), value);
+  }
+}
+
+TEST_F(LatencyHistogramTest, PowerOfTwoBoundaries) {
+  for (auto exponent = LatencyHistogram::SUB_BUCKET_BITS; exponent < 62; ++exponent) {
+    const auto power_of_two = uint64_t{1} << exponent;
+
+    // The highest value of a power of two is the upper bound of its bucket
+    EXPECT_EQ(reported_value(power_of_two - 1), power_of_two - 1);
+
+    // The next power of two begins a new bucket, whose width is power_of_two / (SUB_BUCKET_COUNT / 2)
+    const auto bucket_width = power_of_two >> (LatencyHistogram::SUB_BUCKET_BITS - 1);
+    EXPECT_EQ(reported_value(power_of_two), power_of_two + bucket_width - 1);
+  }
+}
+
+TEST_F(LatencyHistogramTest, RelativeErrorBound) {
+  auto random_engine = std::mt19937_64{};
+  auto exponent_distribution = std::uniform_int_distribution<uint64_t>{0, 50};
+
+  for (auto value_idx = 0; value_idx < 10'000; ++value_idx) {
+    const auto exponent = exponent_distribution(random_engine);
+    const auto value = (uint64_t{1} << exponent) + random_engine() % (uint64_t{1} << exponent);
+
+    const auto reported = reported_value(value);
+    EXPECT_GE(reported, value);
+    EXPECT_LT(static_cast<double>(reported - value), 0.02 * static_cast<double>(value));
+  }
+}
+
+TEST_F(LatencyHistogramTest, Percentiles) {
+  auto histogram = LatencyHistogram{};
+  for (auto value = 100; value >= 1; --value) {
+    histogram.record(std::chrono::nanoseconds{value});
+  }
+
+  EXPECT_EQ(histogram.count(), 100u);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(0.0)), 1);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(1.0)), 1);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(50.0)), 50);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(99.0)), 99);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(100.0)), 100);
+
+  // Values beyond SUB_BUCKET_COUNT are reported as the upper bound of their bucket
+  histogram.record(std::chrono::nanoseconds{1'000'000});
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(99.0)), 100);
+  EXPECT_EQ(static_cast<uint64_t>(to_nanoseconds(histogram.value_at_percentile(100.0))), reported_value(1'000'000));
+  EXPECT_GE(reported_value(1'000'000), 1'000'000u);
+}
+
+TEST_F(LatencyHistogramTest, NegativeDurationsAreRecordedAsZero) {
+  auto histogram = LatencyHistogram{};
+  histogram.record(std::chrono::nanoseconds{-5});
+  EXPECT_EQ(histogram.count(), 1u);
+  EXPECT_EQ(to_nanoseconds(histogram.value_at_percentile(100.0)), 0);
+}
+
+TEST_F(LatencyHistogramTest, Copy) {
+  auto histogram = LatencyHistogram{};
+  histogram.record(std::chrono::nanoseconds{10});
+  histogram.record(std::chrono::nanoseconds{20});
+
+  const auto copy = histogram;
+  histogram.record(std::chrono::nanoseconds{30});
+
+  EXPECT_EQ(copy.count(), 2u);
+  EXPECT_EQ(to_nanoseconds(copy.value_at_percentile(100.0)), 20);
+  EXPECT_EQ(histogram.count(), 3u);
+}
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -6,6 +9,7 @@
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
 #include "cache/random_cache.hpp"
+#include "cache/sampled_lfu_cache.hpp"
 
 namespace opossum {
 
@@ -231,7 +235,7 @@ TEST(CachePolicyTest, RandomCacheTest) {
   ASSERT_EQ(53, cache.get(6));  // Hit.
 }
 
-// Test the default cache (uses GDFS).
+// Test the default cache (uses SampledLFU).
 TEST(CachePolicyTest, Iterators) {
   Cache<int, int> cache(2);
 
@@ -253,6 +257,130 @@ TEST(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+// SampledLFU Strategy
+TEST(CachePolicyTest, SampledLFUCacheTest) {
+  SampledLFUCache<int, int> cache(2);
+
+  cache.set(1, 2);  // Miss.
+  ASSERT_EQ(2, cache.get(1));  // Hit.
+  ASSERT_EQ(2, cache.get(1));  // Hit.
+  ASSERT_EQ(cache.frequency(1), 3u);
+
+  cache.set(2, 4);  // Miss, halves the frequencies.
+  ASSERT_EQ(cache.frequency(1), 1u);
+  ASSERT_EQ(2, cache.get(1));  // Hit.
+
+  cache.set(3, 6);  // Miss, evict 2.
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  // The entry that was just set is not evicted, even though it is used least frequently.
+  cache.set(4, 8);  // Miss, evict 1 or 3.
+  ASSERT_EQ(cache.size(), 2u);
+  ASSERT_TRUE(cache.has(4));
+}
+
+TEST(CachePolicyTest, SampledLFUCacheMemoryBudget) {
+  SampledLFUCache<int, int> cache(10, 100.0);
+
+  cache.set(1, 2, 1.0, 60.0);
+  cache.set(2, 4, 1.0, 30.0);
+  ASSERT_EQ(cache.memory_usage(), 90.0);
+
+  cache.set(3, 6, 1.0, 50.0);  // Miss, evict 1 as the larger of the least frequently used entries.
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.memory_usage(), 80.0);
+
+  cache.set(4, 8, 1.0, 101.0);  // Exceeds the budget on its own, not cached.
+  ASSERT_FALSE(cache.has(4));
+  ASSERT_EQ(cache.size(), 2u);
+
+  cache.set(2, 4, 1.0, 70.0);  // Refresh with a larger size, evict 3.
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_FALSE(cache.has(3));
+  ASSERT_EQ(cache.memory_usage(), 70.0);
+
+  cache.set_memory_budget(50.0);
+  ASSERT_EQ(cache.size(), 0u);
+  ASSERT_EQ(cache.memory_usage(), 0.0);
+}
+
+TEST(CachePolicyTest, SampledLFUCacheSampling) {
+  SampledLFUCache<int, int> cache(100);
+
+  // Keys below 50 are used more frequently than the others, so they are much more likely to survive.
+  for (auto key = 0; key < 100; ++key) {
+    cache.set(key, key);
+    for (auto access = 0; access < (key < 50 ? 8 : 1); ++access) cache.get(key);
+  }
+  for (auto key = 100; key < 150; ++key) {
+    cache.set(key, key);
+    cache.get(key);
+  }
+
+  ASSERT_EQ(cache.size(), 100u);
+  auto frequent_key_count = size_t{0};
+  for (auto key = 0; key < 50; ++key) {
+    frequent_key_count += cache.has(key);
+  }
+  ASSERT_GT(frequent_key_count, 40u);
+}
+
+// Small caches are not sharded, so that the underlying implementation decides which entry to evict.
+TEST(CachePolicyTest, Sharding) {
+  Cache<int, int> small_cache(MinCacheShardCapacity);
+  ASSERT_EQ(small_cache.shard_count(), 1u);
+
+  Cache<int, int> cache(MinCacheShardCapacity * 4);
+  ASSERT_EQ(cache.shard_count(), 4u);
+
+  for (auto key = 0; key < 100; ++key) {
+    cache.set(key, key * 2);
+  }
+  ASSERT_EQ(cache.size(), 100u);
+  for (auto key = 0; key < 100; ++key) {
+    ASSERT_EQ(cache.try_get(key), key * 2);
+  }
+
+  auto element_count = size_t{0};
+  for (const auto& [key, value] : cache) {
+    ++element_count;
+    ASSERT_EQ(value, key * 2);
+  }
+  ASSERT_EQ(element_count, 100u);
+
+  cache.resize(MinCacheShardCapacity);
+  ASSERT_LE(cache.size(), MinCacheShardCapacity);
+
+  cache.clear();
+  ASSERT_EQ(cache.size(), 0u);
+  ASSERT_EQ(cache.begin(), cache.end());
+}
+
+TEST(CachePolicyTest, ConcurrentAccess) {
+  Cache<int, int> cache(MinCacheShardCapacity * 4);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0; thread_idx < 8; ++thread_idx) {
+    threads.emplace_back([&cache, thread_idx]() {
+      for (auto access_idx = 0; access_idx < 10'000; ++access_idx) {
+        const auto key = (access_idx * 7 + thread_idx) % 512;
+        if (const auto value = cache.try_get(key)) {
+          ASSERT_EQ(*value, key + 1);
+        } else {
+          cache.set(key, key + 1);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  ASSERT_LE(cache.size(), MinCacheShardCapacity * 4);
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
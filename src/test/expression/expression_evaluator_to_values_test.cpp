@@ -237,6 +237,29 @@ TEST_F(ExpressionEvaluatorToValuesTest, ArithmeticsSeries) {
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CommonSubexpressions) {
+  const auto expressions = expression_vector(mul_(a_plus_b, c), add_(add_(a, b), 1), a, add_(a, 1));
+  const auto common_subexpressions = ExpressionEvaluator::find_common_subexpressions(expressions);
+  ASSERT_EQ(common_subexpressions->size(), 1u);
+  EXPECT_TRUE(common_subexpressions->count(a_plus_b));
+
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}, nullptr, common_subexpressions};
+  const auto a_plus_b_result = evaluator.evaluate_expression_to_result<int32_t>(*add_(a, b));
+  EXPECT_EQ(evaluator.evaluate_expression_to_result<int32_t>(*a_plus_b), a_plus_b_result);
+
+  // Cached results are not modified when they are used as operands
+  const auto mul_result = evaluator.evaluate_expression_to_result<int32_t>(*expressions[0]);
+  const auto add_result = evaluator.evaluate_expression_to_result<int32_t>(*expressions[1]);
+  using Values = std::vector<std::optional<int32_t>>;
+  EXPECT_EQ(normalize_expression_result(*mul_result), Values({99, std::nullopt, 238, std::nullopt}));
+  EXPECT_EQ(normalize_expression_result(*add_result), Values({4, 6, 8, 10}));
+  EXPECT_EQ(normalize_expression_result(*a_plus_b_result), Values({3, 5, 7, 9}));
+
+  // Cached results are only returned for the type they were computed for
+  const auto a_plus_b_float_result = evaluator.evaluate_expression_to_result<float>(*a_plus_b);
+  EXPECT_EQ(normalize_expression_result(*a_plus_b_float_result), std::vector<std::optional<float>>({3, 5, 7, 9}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, PredicatesLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*greater_than_(5, 3.3), {1}));
   EXPECT_TRUE(test_expression<int32_t>(*greater_than_(5, 5.0), {0}));
@@ -463,6 +486,17 @@ TEST_F(ExpressionEvaluatorToValuesTest, InListSeries) {
       test_expression<int32_t>(table_a, *in_(sub_(mul_(a, 2), 2), list_(b, 6, null_(), 0)), {1, std::nullopt, 1, 1}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, InListParameters) {
+  const auto in_expression =
+      in_(a, list_(correlated_parameter_(ParameterID{0}, a), correlated_parameter_(ParameterID{1}, a)));
+
+  expression_set_parameters(in_expression, {{ParameterID{0}, 2}, {ParameterID{1}, 4}});
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_expression, {0, 1, 0, 1}));
+
+  expression_set_parameters(in_expression, {{ParameterID{0}, 1}, {ParameterID{1}, NullValue{}}});
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_expression, {1, std::nullopt, std::nullopt, std::nullopt}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, InArbitraryExpression) {
   // We support `<expression_a> IN <expression_b>`, even though it looks weird, because <expression_b> might be a column
   // storing the pre-computed result a of subquery
@@ -7,7 +7,7 @@ namespace opossum {
 class ExpressionResultTest : public ::testing::Test {
  public:
   template <typename ExpectedViewType>
-  bool check_view(std::vector<typename ExpectedViewType::Type> values, std::vector<bool> nulls) {
+  bool check_view(std::vector<typename ExpectedViewType::Type> values, ExpressionResultNulls nulls) {
     auto match = false;
     ExpressionResult<typename ExpectedViewType::Type>(values, nulls).as_view([&](const auto& view) {
       match = std::is_same_v<std::decay_t<decltype(view)>, ExpectedViewType>;
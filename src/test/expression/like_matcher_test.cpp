@@ -1,4 +1,6 @@
+#include <regex>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -54,4 +56,64 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GeneralPatterns) {
+  EXPECT_TRUE(match("", ""));
+  EXPECT_FALSE(match("a", ""));
+  EXPECT_TRUE(match("Hello", "H_llo"));
+  EXPECT_TRUE(match("Hello", "_____"));
+  EXPECT_FALSE(match("Hello", "______"));
+  EXPECT_TRUE(match("Hello World", "H%W_rld"));
+  EXPECT_TRUE(match("Hello World", "%o_W%"));
+  EXPECT_FALSE(match("Hello World", "%o_w%"));
+  EXPECT_TRUE(match("aab", "%a_"));
+  EXPECT_TRUE(match("abab", "a%b%b"));
+  EXPECT_FALSE(match("abab", "a%b%b%b"));
+  EXPECT_TRUE(match("abcabd", "%ab_%d"));
+  EXPECT_FALSE(match("ab", "a%%b_"));
+  EXPECT_TRUE(match("almond antique blue", "almond%blue"));
+  EXPECT_FALSE(match("almond antique blue", "almond%bluer"));
+  EXPECT_TRUE(match("special packages requests", "%special%_requests"));
+  EXPECT_FALSE(match("abcabd", "%a%b"));
+}
+
+TEST_F(LikeMatcherTest, MatchesLikeRegex) {
+  const auto values = std::vector<std::string>{"",
+                                               "a",
+                                               "aaa",
+                                               "abcabcabc",
+                                               "ironic, even pinto beans sleep carefully",
+                                               "furiously special foxes haggle. special requests",
+                                               "xyzzy xyzzyx zyx"};
+  const auto patterns = std::vector<std::string>{"a",   "a%",    "%a",      "%a%",        "_",          "__%",
+                                                 "%__", "a_c%",  "%b_a%_c", "%c_b%",      "%special%r_quests",
+                                                 "%y_", "x%x%x", "%zz_x%",  "i%e_ %s%ly", "%_a%_e%_e%_",
+                                                 "%a%b", "%s%s"};
+
+  for (const auto& pattern : patterns) {
+    const auto regex = std::regex{LikeMatcher::sql_like_to_regex(pmr_string{pattern})};
+    for (const auto& value : values) {
+      EXPECT_EQ(match(value, pattern), std::regex_match(value, regex)) << value << " LIKE " << pattern;
+    }
+  }
+}
+
+TEST_F(LikeMatcherTest, FindSubstring) {
+  // Long enough to use the block-wise search as well as the search for the remaining positions
+  const auto string = std::string{"abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"};
+
+  EXPECT_EQ(LikeMatcher::find_substring(string, "a"), 0u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "a", 1), 36u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "ab"), 0u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "xyz0"), 23u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "xyz", 24), 59u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "89abc"), 34u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "yz"), 24u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "z0"), 25u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "az"), pmr_string::npos);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "z", 62), pmr_string::npos);
+  EXPECT_EQ(LikeMatcher::find_substring(string, "", 62), 62u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, string), 0u);
+  EXPECT_EQ(LikeMatcher::find_substring(string, string + "a"), pmr_string::npos);
+}
+
 }  // namespace opossum
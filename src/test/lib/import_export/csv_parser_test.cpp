@@ -1,7 +1,9 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "import_export/csv_meta.hpp"
 #include "import_export/csv_parser.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -18,4 +20,48 @@ TEST_F(CsvParserTest, EmptyTableFromMetaFile) {
   EXPECT_TABLE_EQ_UNORDERED(csv_meta_table, expected_table);
 }
 
+TEST_F(CsvParserTest, FileDoesNotExist) {
+  // With the meta information given, a file that cannot be opened is read as empty
+  const auto csv_meta = process_csv_meta_file("resources/test_data/csv/float_int.csv.json");
+  const auto table = CsvParser{}.parse("resources/test_data/csv/not_existing_file.csv", csv_meta);
+  const auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Float}, {"a", DataType::Int}}, TableType::Data);
+
+  EXPECT_EQ(table->row_count(), 0);
+  EXPECT_TABLE_EQ_UNORDERED(table, expected_table);
+}
+
+TEST_F(CsvParserTest, SmallScanBlocks) {
+  // With four-byte blocks, quoted fields and escaped quotes span multiple blocks and windows
+  const auto table = CsvParser{4}.parse("resources/test_data/csv/string_escaped.csv", std::nullopt, 3);
+
+  auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String}}, TableType::Data, 3);
+  expected_table->append({"aa\"\"aa"});
+  expected_table->append({"xx\"x"});
+  expected_table->append({"yy,y"});
+  expected_table->append({"zz\nz"});
+
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  const auto large_table = CsvParser{8}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt, 7);
+  EXPECT_EQ(large_table->chunk_count(), 15u);
+  EXPECT_TABLE_EQ_ORDERED(large_table, CsvParser{}.parse("resources/test_data/csv/float_int_large.csv"));
+}
+
+TEST_F(CsvParserTest, EncodedChunks) {
+  const auto table = CsvParser{}.parse("resources/test_data/csv/float_int.csv", std::nullopt, 2,
+                                       SegmentEncodingSpec{EncodingType::Dictionary});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->has_mvcc_data());
+    EXPECT_NE(std::dynamic_pointer_cast<const DictionarySegment<float>>(chunk->get_segment(ColumnID{0})), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{1})), nullptr);
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(table, load_table("resources/test_data/tbl/float_int.tbl", 2));
+}
+
 }  // namespace opossum
@@ -5,10 +5,15 @@
 
 #include "base_test.hpp"
 
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "storage/storage_manager.hpp"
 
+using namespace opossum::expression_functional;  // NOLINT
+
 namespace opossum {
 
 class StoredTableNodeTest : public BaseTest {
@@ -51,4 +56,48 @@ TEST_F(StoredTableNodeTest, Copy) { EXPECT_EQ(*_stored_table_node->deep_copy(),
 
 TEST_F(StoredTableNodeTest, NodeExpressions) { ASSERT_EQ(_stored_table_node->node_expressions.size(), 0u); }
 
+TEST_F(StoredTableNodeTest, UniqueConstraints) {
+  EXPECT_TRUE(_stored_table_node->unique_constraints().empty());
+  EXPECT_TRUE(_stored_table_node->functional_dependencies().empty());
+
+  StorageManager::get().get_table("t_a")->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+
+  const auto unique_constraints = _stored_table_node->unique_constraints();
+  ASSERT_EQ(unique_constraints.size(), 1u);
+  EXPECT_EQ(unique_constraints.at(0).column_expressions, ExpressionUnorderedSet{lqp_column_(_a)});
+  EXPECT_TRUE(_stored_table_node->has_unique_constraint({lqp_column_(_a), lqp_column_(_b)}));
+  EXPECT_FALSE(_stored_table_node->has_unique_constraint({lqp_column_(_b)}));
+
+  const auto functional_dependencies = _stored_table_node->functional_dependencies();
+  ASSERT_EQ(functional_dependencies.size(), 1u);
+  EXPECT_EQ(functional_dependencies.at(0).determinants, ExpressionUnorderedSet{lqp_column_(_a)});
+  EXPECT_EQ(functional_dependencies.at(0).dependents, ExpressionUnorderedSet{lqp_column_(_b)});
+
+  // Grouping by b makes b unique, grouping by a and b keeps a unique
+  const auto aggregate_node_b = AggregateNode::make(expression_vector(_b), expression_vector(), _stored_table_node);
+  EXPECT_TRUE(aggregate_node_b->has_unique_constraint({lqp_column_(_b)}));
+  EXPECT_FALSE(aggregate_node_b->has_unique_constraint({lqp_column_(_a)}));
+  const auto aggregate_node_ab =
+      AggregateNode::make(expression_vector(_a, _b), expression_vector(), _stored_table_node);
+  EXPECT_TRUE(aggregate_node_ab->has_unique_constraint({lqp_column_(_a)}));
+
+  // Joining on the unique column of t_a keeps the constraints of t_b and vice versa
+  StorageManager::get().get_table("t_b")->add_unique_constraint({ColumnID{1}});
+  const auto stored_table_node_b = StoredTableNode::make("t_b");
+  const auto b_a = stored_table_node_b->get_column("a");
+  const auto b_b = stored_table_node_b->get_column("b");
+
+  const auto join_node_a = JoinNode::make(JoinMode::Inner, equals_(_a, b_a), _stored_table_node, stored_table_node_b);
+  EXPECT_FALSE(join_node_a->has_unique_constraint({lqp_column_(_a)}));
+  EXPECT_TRUE(join_node_a->has_unique_constraint({lqp_column_(b_b)}));
+
+  const auto join_node_b = JoinNode::make(JoinMode::Left, equals_(b_b, _b), _stored_table_node, stored_table_node_b);
+  EXPECT_TRUE(join_node_b->has_unique_constraint({lqp_column_(_a)}));
+  EXPECT_FALSE(join_node_b->has_unique_constraint({lqp_column_(b_b)}));
+
+  const auto semi_join_node =
+      JoinNode::make(JoinMode::Semi, equals_(_b, b_a), _stored_table_node, stored_table_node_b);
+  EXPECT_TRUE(semi_join_node->has_unique_constraint({lqp_column_(_a)}));
+}
+
 }  // namespace opossum
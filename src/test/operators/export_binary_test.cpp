@@ -10,9 +10,11 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -156,13 +158,64 @@ TEST_F(OperatorsExportBinaryTest, FixedStringDictionarySegment) {
 
   ChunkEncoder::encode_all_chunks(table, EncodingType::FixedStringDictionary);
 
-  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
   table_wrapper->execute();
   auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
   ex->execute();
 
   EXPECT_TRUE(file_exists(filename));
-  EXPECT_TRUE(compare_files("resources/test_data/bin/StringDictionarySegment.bin", filename));
+
+  // FixedStringDictionarySegments are written as such and not converted into DictionarySegments
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), table);
+  const auto segment = importer->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const FixedStringDictionarySegment<pmr_string>>(segment));
+}
+
+TEST_F(OperatorsExportBinaryTest, EncodedSegments) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Long);
+  column_definitions.emplace_back("c", DataType::String, true);
+  column_definitions.emplace_back("d", DataType::Double);
+
+  const auto chunk_encoding_specs = std::vector<ChunkEncodingSpec>{
+      {{EncodingType::RunLength}, {EncodingType::RunLength}, {EncodingType::RunLength}, {EncodingType::RunLength}},
+      {{EncodingType::FrameOfReference},
+       {EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
+       {EncodingType::Dictionary, VectorCompressionType::SimdBp128},
+       {EncodingType::Dictionary, VectorCompressionType::SimdBp128}},
+      {{EncodingType::LZ4}, {EncodingType::LZ4}, {EncodingType::LZ4}, {EncodingType::LZ4}}};
+
+  for (const auto& chunk_encoding_spec : chunk_encoding_specs) {
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    table->append({1, int64_t{100}, "one", 1.1});
+    table->append({1, int64_t{100}, "one", 1.1});
+    table->append({opossum::NULL_VALUE, int64_t{-200}, opossum::NULL_VALUE, 2.2});
+    table->append({4, int64_t{400}, "", 4.4});
+    table->append({5, int64_t{500}, "five", 5.5});
+
+    ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+    ex->execute();
+
+    auto importer = std::make_shared<opossum::ImportBinary>(filename);
+    importer->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(importer->get_output(), table);
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto imported_segment = importer->get_output()->get_chunk(ChunkID{1})->get_segment(column_id);
+      const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(imported_segment);
+      ASSERT_TRUE(encoded_segment);
+      EXPECT_EQ(encoded_segment->encoding_type(), chunk_encoding_spec[column_id].encoding_type);
+    }
+  }
 }
 
 TEST_F(OperatorsExportBinaryTest, AllTypesValueSegment) {
@@ -371,4 +424,31 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("resources/test_data/bin/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, FormatVersion) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 5);
+  table->append({1});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+  table_wrapper->execute();
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  EXPECT_TRUE(ImportBinary::has_current_format(filename));
+
+  // Files written in another version of the format are rejected
+  {
+    auto file = std::fstream{filename, std::ios::binary | std::ios::in | std::ios::out};
+    const auto other_version = BINARY_FORMAT_VERSION + 1;
+    file.seekp(sizeof(BINARY_FORMAT_MAGIC_NUMBER));
+    file.write(reinterpret_cast<const char*>(&other_version), sizeof(other_version));
+  }
+  EXPECT_FALSE(ImportBinary::has_current_format(filename));
+  EXPECT_THROW(ImportBinary::read_binary(filename), std::exception);
+
+  // As are files that were not written by ExportBinary
+  EXPECT_FALSE(ImportBinary::has_current_format("resources/test_data/tbl/float.tbl"));
+  EXPECT_THROW(ImportBinary::read_binary("resources/test_data/tbl/float.tbl"), std::exception);
+  EXPECT_FALSE(ImportBinary::has_current_format("not_existing_file"));
+}
+
 }  // namespace opossum
@@ -214,6 +214,23 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, ParameterizedScan) {
+  const auto right_values = std::vector<AllParameterVariant>{ParameterID{0}};
+  const auto right_values2 = std::vector<AllParameterVariant>{ParameterID{1}};
+
+  // Parameters have to be set before the scan is executed
+  auto unbound_scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                                  PredicateCondition::Between, right_values, right_values2);
+  EXPECT_THROW(unbound_scan->execute(), std::logic_error);
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Between, right_values, right_values2);
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{4}}, {ParameterID{1}, AllTypeVariant{9}}});
+  scan->execute();
+
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {104, 106, 108, 104, 106, 108});
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <numeric>
+
 #include "../base_test.hpp"
 
 #include "operators/join_hash/join_hash_steps.hpp"
@@ -183,6 +186,53 @@ TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   }
 }
 
+TEST_F(JoinHashStepsTest, RadixClusteringInTwoPasses) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto i = 0; i < 1'000; ++i) {
+    table->append({i});
+  }
+
+  const auto first_pass_radix_bits = size_t{2};
+  const auto second_pass_radix_bits = size_t{3};
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(table, ColumnID{0}, histograms, first_pass_radix_bits);
+  const auto first_pass_result = partition_radix_parallel<int, int, false>(
+      materialized, determine_chunk_offsets(table), histograms, first_pass_radix_bits);
+  const auto second_pass_result = partition_radix_second_pass<int, int, false>(
+      first_pass_result, first_pass_radix_bits, second_pass_radix_bits);
+
+  ASSERT_EQ(second_pass_result.partition_offsets.size(), 32u);
+  EXPECT_EQ(second_pass_result.partition_offsets.back(), 1'000u);
+  EXPECT_EQ(second_pass_result.elements->size(), 1'000u);
+
+  // Partition p2 of the first pass partition p1 is stored as partition p1 * 2^second_pass_radix_bits + p2
+  const std::hash<int> hash_function;
+  auto partition_begin = size_t{0};
+  auto values = std::vector<int>{};
+  for (auto partition_id = size_t{0}; partition_id < second_pass_result.partition_offsets.size(); ++partition_id) {
+    const auto partition_end = second_pass_result.partition_offsets[partition_id];
+    ASSERT_GE(partition_end, partition_begin);
+
+    for (auto element_idx = partition_begin; element_idx < partition_end; ++element_idx) {
+      const auto value = (*second_pass_result.elements)[element_idx].value;
+      const auto hash = hash_function(value);
+      const auto expected_partition_id =
+          (hash & 0b11) * (size_t{1} << second_pass_radix_bits) + ((hash >> first_pass_radix_bits) & 0b111);
+      EXPECT_EQ(partition_id, expected_partition_id);
+      values.emplace_back(value);
+    }
+    partition_begin = partition_end;
+  }
+
+  // No element is lost or duplicated
+  std::sort(values.begin(), values.end());
+  auto expected_values = std::vector<int>(1'000);
+  std::iota(expected_values.begin(), expected_values.end(), 0);
+  EXPECT_EQ(values, expected_values);
+}
+
 TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   // offset store the start offset for each chunk
   const auto chunk_offsets_nulls = determine_chunk_offsets(_table_with_nulls_and_zeros->get_output());
@@ -191,6 +241,42 @@ TEST_F(JoinHashStepsTest, DetermineChunkOffsets) {
   EXPECT_EQ(chunk_offsets_nulls[1], 10);
 }
 
+TEST_F(JoinHashStepsTest, DynamicChunkPruning) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto i = 0; i < 50; ++i) {
+    table->append({i});
+  }
+  // The last chunk remains mutable and has no statistics
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}});
+
+  EXPECT_TRUE(has_segment_statistics(*table, ColumnID{0}));
+  EXPECT_FALSE(has_segment_statistics(*_table_zero_one, ColumnID{0}));
+
+  const auto prunable_chunks =
+      determine_prunable_chunks<int>(table, ColumnID{0}, std::optional<std::pair<int, int>>{{15, 24}});
+  EXPECT_EQ(prunable_chunks, std::vector<bool>({true, false, false, true, false}));
+
+  // An empty build side does not match anything
+  const auto all_chunks = determine_prunable_chunks<int>(table, ColumnID{0}, std::nullopt);
+  EXPECT_EQ(all_chunks, std::vector<bool>(5, true));
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto radix_container = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 0, prunable_chunks);
+
+  // The slots of skipped chunks remain unused
+  EXPECT_EQ(radix_container.elements->size(), 50u);
+  const auto used_slot_count = std::count_if(radix_container.elements->begin(), radix_container.elements->end(),
+                                             [](const auto& element) { return !(element.row_id == NULL_ROW_ID); });
+  EXPECT_EQ(used_slot_count, 30);
+  EXPECT_EQ(histograms[0][0], 0u);
+  EXPECT_EQ(histograms[1][0], 10u);
+
+  const auto value_range = determine_value_range(radix_container);
+  ASSERT_TRUE(value_range);
+  EXPECT_EQ(*value_range, std::make_pair(10, 49));
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
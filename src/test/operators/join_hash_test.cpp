@@ -39,6 +39,10 @@ class JoinHashTest : public BaseTest {
 
   void SetUp() override {}
 
+  static void force_second_pass_radix_bits(JoinHash& join, const size_t second_pass_radix_bits) {
+    join._second_pass_radix_bits = second_pass_radix_bits;
+  }
+
   inline static std::shared_ptr<TableWrapper> _table_wrapper_small, _table_tpch_orders, _table_tpch_lineitems,
       _table_with_nulls;
   inline static std::shared_ptr<TableScan> _table_tpch_orders_scanned, _table_tpch_lineitems_scanned;
@@ -77,6 +81,62 @@ TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
 }
 
+TEST_F(JoinHashTest, RadixBitsInPerformanceData) {
+  // The input is far too small for the partitions to exceed the TLB, so a single partitioning pass is used
+  auto join = std::make_shared<JoinHash>(_table_with_nulls, _table_with_nulls, JoinMode::Left,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 2);
+  join->execute();
+
+  const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.radix_bits, 2u);
+  EXPECT_EQ(performance_data.radix_passes, 1u);
+
+  auto unpartitioned_join = std::make_shared<JoinHash>(_table_with_nulls, _table_with_nulls, JoinMode::Left,
+                                                       ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                       PredicateCondition::Equals, 0);
+  unpartitioned_join->execute();
+
+  const auto& unpartitioned_performance_data =
+      static_cast<const JoinHash::PerformanceData&>(unpartitioned_join->performance_data());
+  EXPECT_EQ(unpartitioned_performance_data.radix_bits, 0u);
+  EXPECT_EQ(unpartitioned_performance_data.radix_passes, 0u);
+}
+
+TEST_F(JoinHashTest, RadixClusteringInTwoPasses) {
+  // The inputs are far too small for two partitioning passes, which are forced here. Their results have to match those
+  // of a single pass, including the NULLs that outer joins keep on the probe side.
+  const auto test_join = [&](const auto& left, const auto& right, const JoinMode mode, const size_t radix_bits) {
+    auto single_pass_join = std::make_shared<JoinHash>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                       PredicateCondition::Equals, radix_bits);
+    single_pass_join->execute();
+
+    auto two_pass_join = std::make_shared<JoinHash>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                    PredicateCondition::Equals, radix_bits);
+    force_second_pass_radix_bits(*two_pass_join, radix_bits / 2);
+    two_pass_join->execute();
+
+    const auto& performance_data = static_cast<const JoinHash::PerformanceData&>(two_pass_join->performance_data());
+    EXPECT_EQ(performance_data.radix_bits, radix_bits);
+    EXPECT_EQ(performance_data.radix_passes, 2u);
+
+    EXPECT_TABLE_EQ_UNORDERED(two_pass_join->get_output(), single_pass_join->get_output());
+  };
+
+  test_join(_table_with_nulls, _table_with_nulls, JoinMode::Left, 2);
+  test_join(_table_with_nulls, _table_with_nulls, JoinMode::Right, 3);
+  test_join(_table_with_nulls, _table_with_nulls, JoinMode::Inner, 2);
+  test_join(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Inner, 6);
+  test_join(_table_tpch_orders_scanned, _table_tpch_lineitems_scanned, JoinMode::Right, 5);
+
+  // The result of a left outer join on a column with NULLs is known
+  auto join = std::make_shared<JoinHash>(_table_with_nulls, _table_with_nulls, JoinMode::Left,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 2);
+  force_second_pass_radix_bits(*join, 1);
+  join->execute();
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(),
+                            load_table("resources/test_data/tbl/joinoperators/int_with_null_and_zero.tbl", 1));
+}
+
 TEST_F(JoinHashTest, HashJoinNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -13,6 +13,9 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -54,6 +57,34 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, ExecutedOnAllChunksWithScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // `a + b` is a common subexpression and is evaluated only once per chunk
+  const auto projection = std::make_shared<opossum::Projection>(
+      table_wrapper_a, expression_vector(a_a, add_(a_a, a_b), mul_(add_(a_a, a_b), 0)));
+  projection->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  const auto& output_table = projection->get_output();
+  EXPECT_EQ(output_table->chunk_count(), table_wrapper_a->get_output()->chunk_count());
+  EXPECT_FALSE(output_table->column_is_nullable(ColumnID{1}));
+
+  const auto a_plus_b = PQPColumnExpression::from_table(*output_table, "a + b");
+  const auto projection_a_plus_b = std::make_shared<opossum::Projection>(projection, expression_vector(a_plus_b));
+  projection_a_plus_b->execute();
+  EXPECT_TABLE_EQ_UNORDERED(projection_a_plus_b->get_output(),
+                            load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
+
+  for (auto row_idx = size_t{0}; row_idx < output_table->row_count(); ++row_idx) {
+    EXPECT_EQ(output_table->get_value<float>(ColumnID{2}, row_idx), 0.0f);
+  }
+}
+
 TEST_F(OperatorsProjectionTest, ForwardsIfPossibleDataTable) {
   // The Projection will forward segments from its input if all expressions are segment references.
   // Why would you enforce something like this? E.g., Update relies on it.
@@ -236,4 +236,27 @@ TEST_P(OperatorsSortTest, SortAfterOuterJoin) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, DescendingSortOfFilteredColumnWithMultipleBlocks) {
+  // The values of the filtered input are read in blocks of ReferenceSegmentGather::BLOCK_SIZE
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto value = 0; value < 3000; ++value) {
+    table->append({value});
+    expected_result->append({2999 - value});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  auto input = std::make_shared<TableWrapper>(table);
+  input->execute();
+
+  auto scan = create_table_scan(input, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan->execute();
+
+  auto sort = std::make_shared<Sort>(scan, ColumnID{0}, OrderByMode::Descending, 1000u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 }  // namespace opossum
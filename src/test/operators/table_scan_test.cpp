@@ -17,10 +17,12 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_in_table_scan_impl.hpp"
 #include "operators/table_scan/column_is_null_table_scan_impl.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/disjunction_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -739,6 +741,45 @@ TEST_P(OperatorsTableScanTest, ScanWithExcludedFirstChunk) {
   ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksAtRuntime) {
+  // The value of a CorrelatedParameterExpression is only known at execution time, so the ChunkPruningRule cannot use
+  // it. The TableScan uses the ChunkStatistics of the scanned (or, for reference tables, the referenced) chunks.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto i = 0; i < 45; ++i) {
+    data_table->append({i});
+  }
+  // The last, mutable chunk has no statistics and can thus not be pruned
+  ChunkEncoder::encode_chunks(data_table, {ChunkID{0}, ChunkID{1}, ChunkID{2}, ChunkID{3}},
+                              SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(data_table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto parameter = correlated_parameter_(ParameterID{0}, column_a);
+
+  const auto scan_a = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column_a, parameter));
+  scan_a->set_parameters({{ParameterID{0}, AllTypeVariant{28}}});
+  scan_a->execute();
+  EXPECT_EQ(scan_a->get_output()->row_count(), 17u);
+  EXPECT_NE(scan_a->description(DescriptionMode::SingleLine).find("(2 Chunks pruned at runtime)"), std::string::npos);
+
+  // Scan on the output of the first scan, which references single chunks of the data table
+  const auto scan_b = std::make_shared<TableScan>(scan_a, equals_(column_a, parameter));
+  scan_b->set_parameters({{ParameterID{0}, AllTypeVariant{35}}});
+  scan_b->execute();
+  ASSERT_COLUMN_EQ(scan_b->get_output(), ColumnID{0}, {35});
+  EXPECT_NE(scan_b->description(DescriptionMode::SingleLine).find("(1 Chunks pruned at runtime)"), std::string::npos);
+
+  // Values of a different data type are not used for pruning, as the ChunkStatistics would compare truncated values
+  const auto scan_c = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, parameter));
+  scan_c->set_parameters({{ParameterID{0}, AllTypeVariant{int64_t{10}}}});
+  scan_c->execute();
+  EXPECT_EQ(scan_c->get_output()->row_count(), 10u);
+  EXPECT_EQ(scan_c->description(DescriptionMode::SingleLine).find("pruned at runtime"), std::string::npos);
+}
+
 TEST_P(OperatorsTableScanTest, BinaryScanOnNullable) {
   auto predicates = std::vector<std::tuple<ColumnID, PredicateCondition, AllTypeVariant, std::vector<AllTypeVariant>>>{
       {ColumnID{0}, PredicateCondition::Equals, 1234, {1234}},
@@ -800,18 +841,98 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
       TableScan{get_int_string_op(), like_(column_s, "%s%")}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
       TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(
       TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(
+      TableScan{get_int_float_op(), not_in_(column_a, list_(1, 2, 3))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
-      TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+      TableScan{get_int_float_op(), in_(column_a, list_(1, 2.5, 3))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), in_(column_a, list_(1, NullValue{}))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
       TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<DisjunctionTableScanImpl*>(
+      TableScan{get_int_float_op(), or_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));
+  const auto conjunction = and_(less_than_(column_b, 6), equals_(column_a, 1));
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), or_(greater_than_(column_a, 5), conjunction)}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
       TableScan{get_int_float_with_null_op(), is_null_(column_an)}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
       TableScan{get_int_float_with_null_op(), is_not_null_(column_an)}.create_impl().get()));
 }
 
+TEST_P(OperatorsTableScanTest, ScanIn) {
+  const auto column_a = get_column_expression(_int_int_compressed, ColumnID{0});
+  const auto in_list = list_(0, 4, 5, 12);
+
+  for (const auto& table : {_int_int_compressed, _int_int_partly_compressed}) {
+    auto scan_in = std::make_shared<TableScan>(table, in_(column_a, in_list));
+    scan_in->execute();
+    ASSERT_COLUMN_EQ(scan_in->get_output(), ColumnID{1}, {100, 100, 104, 104, 112, 112});
+
+    auto scan_not_in = std::make_shared<TableScan>(table, not_in_(column_a, in_list));
+    scan_not_in->execute();
+    ASSERT_COLUMN_EQ(scan_not_in->get_output(), ColumnID{1}, {102, 102, 106, 106, 108, 108, 110, 110});
+  }
+
+  // Scan on a ReferenceSegment that references multiple chunks
+  auto scan_referenced = std::make_shared<TableScan>(get_table_op_filtered(), in_(column_a, list_(4, 10, 12)));
+  scan_referenced->execute();
+  ASSERT_COLUMN_EQ(scan_referenced->get_output(), ColumnID{1}, {110, 110, 112});
+
+  auto scan_referenced_not_in =
+      std::make_shared<TableScan>(get_table_op_filtered(), not_in_(column_a, list_(4, 10, 12)));
+  scan_referenced_not_in->execute();
+  ASSERT_COLUMN_EQ(scan_referenced_not_in->get_output(), ColumnID{1}, {100, 102, 106, 108});
+}
+
+TEST_P(OperatorsTableScanTest, ScanInWithNull) {
+  const auto table = get_int_float_with_null_op();
+  const auto column_a = get_column_expression(table, ColumnID{0});
+
+  // NULL is neither IN nor NOT IN the list
+  auto scan_in = std::make_shared<TableScan>(table, in_(column_a, list_(123, 1234, 42)));
+  scan_in->execute();
+  ASSERT_COLUMN_EQ(scan_in->get_output(), ColumnID{0}, {123, 1234});
+
+  auto scan_not_in = std::make_shared<TableScan>(table, not_in_(column_a, list_(123, 1234, 42)));
+  scan_not_in->execute();
+  ASSERT_COLUMN_EQ(scan_not_in->get_output(), ColumnID{0}, {12345});
+}
+
+TEST_P(OperatorsTableScanTest, ScanDisjunction) {
+  const auto column_a = get_column_expression(_int_int_compressed, ColumnID{0});
+  const auto column_b = get_column_expression(_int_int_compressed, ColumnID{1});
+
+  // Disjuncts on different columns and of different kinds
+  auto scan = std::make_shared<TableScan>(
+      _int_int_compressed, or_(or_(less_than_(column_a, 2), greater_than_(column_b, 110)), in_(column_a, list_(6))));
+  scan->execute();
+  ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, {100, 100, 106, 106, 112, 112});
+
+  // Rows that match multiple disjuncts are only emitted once, in the order of the input
+  auto scan_overlapping =
+      std::make_shared<TableScan>(_int_int_partly_compressed, or_(less_than_(column_a, 5), less_than_(column_a, 3)));
+  scan_overlapping->execute();
+  ASSERT_COLUMN_EQ(scan_overlapping->get_output(), ColumnID{1}, {100, 100, 102, 102, 104, 104});
+  for (auto chunk_id = ChunkID{0}; chunk_id < scan_overlapping->get_output()->chunk_count(); ++chunk_id) {
+    const auto& segment = *scan_overlapping->get_output()->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto& pos_list = *static_cast<const ReferenceSegment&>(segment).pos_list();
+    EXPECT_TRUE(std::is_sorted(pos_list.begin(), pos_list.end()));
+  }
+
+  // Disjunction on a referencing table with NULL values and a NULL RowID
+  const auto referencing_table = std::make_shared<TableWrapper>(create_referencing_table_w_null_row_id(true));
+  referencing_table->execute();
+  const auto column_a_nullable = get_column_expression(referencing_table, ColumnID{0});
+  const auto column_b_nullable = get_column_expression(referencing_table, ColumnID{1});
+  auto scan_nullable =
+      std::make_shared<TableScan>(referencing_table, or_(is_null_(column_a_nullable), equals_(column_b_nullable, 458)));
+  scan_nullable->execute();
+  EXPECT_EQ(scan_nullable->get_output()->row_count(), 2u);
+}
+
 TEST_P(OperatorsTableScanTest, TwoBigScans) {
   // To stress-test the SIMD scan, which only operates on bigger tables, the generated table holds 1'000 rows.
   // For each fifth row, column a is NULL. Otherwise, a is 100'000 + i, b is the index in the list of non-NULL values.
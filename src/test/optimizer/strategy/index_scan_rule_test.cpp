@@ -168,4 +168,35 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithParameter) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 20));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10, 0, 20));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10'000, 0, 20'000));
+  table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 1'000'000, column_statistics}));
+
+  // Parameters, e.g., the literals of cached plans, are only bound during execution and resolved by the IndexScan
+  auto predicate_node_0 = PredicateNode::make(equals_(c, correlated_parameter_(ParameterID{0}, c)));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanWithColumnOnRightSide) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(less_than_(19'900, c));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,152 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CancellationTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_a = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table_a);
+
+    _cancelled_token = std::make_shared<CancellationToken>();
+    _cancelled_token->cancel();
+  }
+
+  std::shared_ptr<Table> _table_a;
+  std::shared_ptr<CancellationToken> _cancelled_token;
+};
+
+TEST_F(CancellationTest, Cancel) {
+  const auto token = CancellationToken{};
+  EXPECT_FALSE(token.is_cancelled());
+  EXPECT_NO_THROW(token.throw_if_cancelled());
+
+  EXPECT_TRUE(_cancelled_token->is_cancelled());
+  EXPECT_THROW(_cancelled_token->throw_if_cancelled(), QueryCancelledException);
+}
+
+TEST_F(CancellationTest, Timeout) {
+  const auto disabled_token = CancellationToken{std::chrono::milliseconds{0}};
+  const auto token = CancellationToken{std::chrono::milliseconds{1}};
+  std::this_thread::sleep_for(std::chrono::milliseconds{5});
+
+  EXPECT_FALSE(disabled_token.is_cancelled());
+  EXPECT_TRUE(token.is_cancelled());
+
+  try {
+    token.throw_if_cancelled();
+    FAIL() << "Expected QueryCancelledException";
+  } catch (const QueryCancelledException& exception) {
+    EXPECT_NE(std::string{exception.what()}.find("statement timeout"), std::string::npos);
+  }
+}
+
+TEST_F(CancellationTest, JobTasksInheritToken) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto job_is_cancelled = false;
+  const auto task = std::make_shared<JobTask>([&]() {
+    const auto job = std::make_shared<JobTask>([&]() { job_is_cancelled = AbstractTask::is_current_task_cancelled(); });
+    job->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{job});
+    EXPECT_EQ(job->cancellation_token(), _cancelled_token);
+  });
+  task->set_cancellation_token(_cancelled_token);
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{task});
+
+  EXPECT_TRUE(job_is_cancelled);
+  EXPECT_FALSE(AbstractTask::is_current_task_cancelled());
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(CancellationTest, OperatorTasksAreSkipped) {
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto a = PQPColumnExpression::from_table(*_table_a, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_(a, 0));
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(table_scan, CleanupTemporaries::Yes);
+  for (const auto& task : tasks) {
+    task->set_cancellation_token(_cancelled_token);
+    task->schedule();
+  }
+
+  EXPECT_FALSE(table_scan->get_output());
+}
+
+TEST_F(CancellationTest, OperatorsStopEarly) {
+  // Operators that are executed by a task with a cancelled token stop at their next chunk or job boundary
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  const auto a = PQPColumnExpression::from_table(*_table_a, "a");
+  const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+  const auto operators = std::vector<std::shared_ptr<AbstractOperator>>{
+      std::make_shared<TableScan>(get_table, greater_than_(a, 0)),
+      std::make_shared<JoinHash>(get_table, get_table, JoinMode::Inner, column_ids, PredicateCondition::Equals),
+      std::make_shared<JoinSortMerge>(get_table, get_table, JoinMode::Inner, column_ids, PredicateCondition::Equals),
+      std::make_shared<Aggregate>(get_table,
+                                  std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+                                  std::vector<ColumnID>{ColumnID{0}}),
+      std::make_shared<Sort>(get_table, ColumnID{0})};
+
+  for (const auto& op : operators) {
+    const auto task = std::make_shared<JobTask>([&]() { op->execute(); });
+    task->set_cancellation_token(_cancelled_token);
+    task->schedule();
+
+    ASSERT_TRUE(op->get_output()) << op->name();
+    EXPECT_EQ(op->get_output()->row_count(), 0u) << op->name();
+  }
+}
+
+TEST_F(CancellationTest, SQLPipeline) {
+  auto pipeline_statement = SQLPipelineBuilder{"SELECT a, SUM(b) FROM table_a GROUP BY a"}
+                                .with_cancellation_token(_cancelled_token)
+                                .create_pipeline_statement();
+  EXPECT_THROW(pipeline_statement.get_result_table(), QueryCancelledException);
+  EXPECT_FALSE(pipeline_statement.get_physical_plan()->get_output());
+  EXPECT_EQ(pipeline_statement.transaction_context()->phase(), TransactionPhase::RolledBack);
+
+  // A statement that is not cancelled is executed as usual
+  auto token = std::make_shared<CancellationToken>(std::chrono::minutes{1});
+  auto pipeline = SQLPipelineBuilder{"SELECT a, SUM(b) FROM table_a GROUP BY a"}
+                      .with_cancellation_token(token)
+                      .create_pipeline();
+  EXPECT_EQ(pipeline.get_result_table()->row_count(), 3u);
+}
+
+TEST_F(CancellationTest, CancelledInsertIsRolledBack) {
+  auto pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (1, 1.0)"}
+                      .with_cancellation_token(_cancelled_token)
+                      .create_pipeline();
+  EXPECT_THROW(pipeline.get_result_table(), QueryCancelledException);
+
+  EXPECT_EQ(SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline().get_result_table()->row_count(), 3u);
+}
+
+}  // namespace opossum
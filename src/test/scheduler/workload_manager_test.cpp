@@ -0,0 +1,192 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "scheduler/workload_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class WorkloadManagerTest : public BaseTest {
+ protected:
+  // Admits a query to the class on a separate thread, which blocks until the query is admitted
+  std::thread admit_async(const std::string& workload_class_name, std::atomic_bool& admitted) {
+    return std::thread([&, workload_class_name]() {
+      const auto admission = WorkloadManager::get().admit(workload_class_name);
+      admitted = true;
+    });
+  }
+
+  std::vector<std::shared_ptr<AbstractTask>> create_tasks(const std::shared_ptr<QueryGroup>& query_group,
+                                                          const size_t task_count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_idx = size_t{0}; task_idx < task_count; ++task_idx) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+      tasks.back()->set_query_group(query_group);
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkloadManagerTest, DisabledByDefault) {
+  auto& workload_manager = WorkloadManager::get();
+  EXPECT_FALSE(workload_manager.is_enabled());
+
+  const auto admission = workload_manager.admit();
+  EXPECT_EQ(admission->query_group()->workload_class_name(), WorkloadManager::DEFAULT_WORKLOAD_CLASS);
+  EXPECT_EQ(workload_manager.running_query_count(WorkloadManager::DEFAULT_WORKLOAD_CLASS), 1u);
+  EXPECT_THROW(workload_manager.admit("reporting"), std::logic_error);
+
+  workload_manager.add_workload_class(WorkloadClass{"reporting"});
+  EXPECT_TRUE(workload_manager.is_enabled());
+  EXPECT_TRUE(workload_manager.has_workload_class("reporting"));
+}
+
+TEST_F(WorkloadManagerTest, LimitsConcurrentQueries) {
+  auto& workload_manager = WorkloadManager::get();
+  workload_manager.add_workload_class(WorkloadClass{"reporting", 1, 1});
+
+  auto first_admission = workload_manager.admit("reporting");
+
+  // Other classes are not limited
+  const auto default_admission = workload_manager.admit();
+
+  auto admitted = std::atomic_bool{false};
+  auto thread = admit_async("reporting", admitted);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(admitted);
+
+  first_admission.reset();
+  thread.join();
+  EXPECT_TRUE(admitted);
+  EXPECT_EQ(workload_manager.running_query_count("reporting"), 0u);
+}
+
+TEST_F(WorkloadManagerTest, LimitsMemoryUsage) {
+  auto& workload_manager = WorkloadManager::get();
+  workload_manager.add_workload_class(WorkloadClass{"reporting", 1, 4, 1'000});
+
+  // The first query is admitted regardless of the budget
+  auto first_admission = workload_manager.admit("reporting");
+  first_admission->query_group()->increase_memory_usage(2'000);
+  EXPECT_EQ(workload_manager.memory_usage("reporting"), 2'000u);
+
+  auto admitted = std::atomic_bool{false};
+  auto thread = admit_async("reporting", admitted);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(admitted);
+
+  first_admission.reset();
+  thread.join();
+  EXPECT_TRUE(admitted);
+}
+
+TEST_F(WorkloadManagerTest, StrideScheduling) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto reporting_group = std::make_shared<QueryGroup>("reporting", 1);
+  const auto point_query_group = std::make_shared<QueryGroup>("point_queries", 3);
+  const auto reporting_tasks = create_tasks(reporting_group, 8);
+  const auto point_query_tasks = create_tasks(point_query_group, 8);
+
+  for (auto task_idx = size_t{0}; task_idx < 8; ++task_idx) {
+    queue.push(reporting_tasks[task_idx], static_cast<uint32_t>(SchedulePriority::Default));
+    queue.push(point_query_tasks[task_idx], static_cast<uint32_t>(SchedulePriority::Default));
+  }
+
+  // The group with the higher weight gets three times as many tasks pulled
+  auto pulled_point_query_tasks = size_t{0};
+  for (auto pull_idx = size_t{0}; pull_idx < 8; ++pull_idx) {
+    const auto task = queue.pull();
+    ASSERT_TRUE(task);
+    pulled_point_query_tasks += task->query_group() == point_query_group;
+  }
+  EXPECT_EQ(pulled_point_query_tasks, 6u);
+
+  auto remaining_tasks = size_t{0};
+  while (const auto task = queue.pull()) {
+    ++remaining_tasks;
+  }
+  EXPECT_EQ(remaining_tasks, 8u);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(WorkloadManagerTest, NewQueriesAreServedAtTheNextTaskBoundary) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto long_query_group = std::make_shared<QueryGroup>("reporting", 1);
+  const auto short_query_group = std::make_shared<QueryGroup>("reporting", 1);
+
+  const auto long_query_tasks = create_tasks(long_query_group, 100);
+  for (const auto& task : long_query_tasks) {
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+  }
+  EXPECT_EQ(queue.pull(), long_query_tasks[0]);
+  EXPECT_EQ(queue.pull(), long_query_tasks[1]);
+
+  const auto short_query_task = create_tasks(short_query_group, 1).front();
+  queue.push(short_query_task, static_cast<uint32_t>(SchedulePriority::Default));
+  EXPECT_EQ(queue.pull(), short_query_task);
+  EXPECT_EQ(queue.pull(), long_query_tasks[2]);
+
+  // Tasks without a group are pulled first
+  const auto ungrouped_task = std::make_shared<JobTask>([]() {});
+  queue.push(ungrouped_task, static_cast<uint32_t>(SchedulePriority::Default));
+  EXPECT_EQ(queue.pull(), ungrouped_task);
+}
+
+TEST_F(WorkloadManagerTest, JobTasksInheritQueryGroup) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto query_group = std::make_shared<QueryGroup>("reporting", 1);
+  auto job_query_group = std::shared_ptr<QueryGroup>{};
+
+  const auto task = std::make_shared<JobTask>([&]() {
+    const auto job = std::make_shared<JobTask>([]() {});
+    job->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{job});
+    job_query_group = job->query_group();
+  });
+  task->set_query_group(query_group);
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{task});
+
+  EXPECT_EQ(job_query_group, query_group);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(WorkloadManagerTest, SQLPipeline) {
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto& workload_manager = WorkloadManager::get();
+  workload_manager.add_workload_class(WorkloadClass{"reporting", 1, 1});
+
+  auto pipeline_statement = SQLPipelineBuilder{"SELECT a, SUM(b) FROM table_a WHERE a > 1000 GROUP BY a"}
+                                .with_workload_class("reporting")
+                                .create_pipeline_statement();
+  EXPECT_EQ(pipeline_statement.get_result_table()->row_count(), 2u);
+
+  for (const auto& task : pipeline_statement.get_tasks()) {
+    ASSERT_TRUE(task->query_group());
+    EXPECT_EQ(task->query_group()->workload_class_name(), "reporting");
+  }
+
+  // Only the result is still accounted to the query, which is not running anymore
+  EXPECT_EQ(workload_manager.running_query_count("reporting"), 0u);
+  EXPECT_GT(pipeline_statement.get_tasks().back()->query_group()->memory_usage(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
@@ -7,8 +7,8 @@
 #include "gmock/gmock.h"
 
 #include "storage/prepared_plan.hpp"
-#include "tasks/server/bind_server_prepared_statement_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
+#include "tasks/server/encode_server_query_result_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
@@ -19,14 +19,14 @@ namespace opossum {
 class MockTaskRunner {
  public:
   MOCK_METHOD1(dispatch_server_task,
-               boost::future<std::unique_ptr<PreparedPlan>>(std::shared_ptr<ParseServerPreparedStatementTask>));
-  MOCK_METHOD1(dispatch_server_task,
-               boost::future<std::shared_ptr<AbstractOperator>>(std::shared_ptr<BindServerPreparedStatementTask>));
+               boost::future<std::shared_ptr<PreparedPlan>>(std::shared_ptr<ParseServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task,
                boost::future<std::unique_ptr<CreatePipelineResult>>(std::shared_ptr<CreatePipelineTask>));
   MOCK_METHOD1(dispatch_server_task,
-               boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
+               boost::future<std::shared_ptr<AbstractOperator>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<ExecuteServerQueryTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<std::shared_ptr<const std::vector<OutputPacket>>>(
+                                         std::shared_ptr<EncodeServerQueryResultTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<LoadServerFileTask>));
 };
 
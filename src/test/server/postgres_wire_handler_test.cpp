@@ -58,6 +58,24 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
 }
 
+TEST_F(PostgresWireHandlerTest, HandleCancelRequest) {
+  ByteBuffer buffer = {};
+  for (const auto value : {htonl(16), htonl(80877102), htonl(7), htonl(1234)}) {
+    const auto* chars = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+  }
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  ASSERT_EQ(postgres_wire_handler.handle_startup_package(_input_packet), PostgresWireHandler::CANCEL_REQUEST);
+
+  // The header is read again by handle_startup_package, the connection only passes on the remaining bytes
+  _input_packet.offset += 2 * sizeof(uint32_t);
+  const auto cancel_request = postgres_wire_handler.handle_cancel_request_packet(_input_packet);
+  EXPECT_EQ(cancel_request.process_id, 7u);
+  EXPECT_EQ(cancel_request.secret_key, 1234u);
+}
+
 TEST_F(PostgresWireHandlerTest, WriteString) {
   std::string value("Response");
 
@@ -67,4 +85,26 @@ TEST_F(PostgresWireHandlerTest, WriteString) {
   // string should be terminated
   ASSERT_EQ(_output_packet.data[value.length()], '\0');
 }
+
+TEST_F(PostgresWireHandlerTest, WriteDataRows) {
+  postgres_wire_handler.write_data_row(_output_packet, {"1", "abc"});
+  postgres_wire_handler.write_data_row(_output_packet, {});
+
+  // Type (1 byte), size (4), column count (2) and, per value, its length (4) and the value without a terminator
+  const auto first_row_size = 1u + 4u + 2u + (4u + 1u) + (4u + 3u);
+  ASSERT_EQ(_output_packet.data.size(), first_row_size + 1u + 4u + 2u);
+
+  _input_packet.data = _output_packet.data;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto first_header = postgres_wire_handler.handle_header(_input_packet);
+  EXPECT_EQ(first_header.message_type, NetworkMessageType::DataRow);
+  EXPECT_EQ(first_header.payload_length, first_row_size - 5u);
+
+  _input_packet.offset += first_row_size;
+  const auto second_header = postgres_wire_handler.handle_header(_input_packet);
+  EXPECT_EQ(second_header.message_type, NetworkMessageType::DataRow);
+  EXPECT_EQ(second_header.payload_length, 2u);
+}
+
 }  // namespace opossum
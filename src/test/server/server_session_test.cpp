@@ -6,6 +6,8 @@
 #include "base_test.hpp"
 #include "mock_connection.hpp"
 #include "mock_task_runner.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "server/cancel_request_registry.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -60,6 +62,9 @@ class ServerSessionTest : public BaseTest {
     // (i.e. don't throw an exception)
     ON_CALL(*_connection, send_ssl_denied()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
     ON_CALL(*_connection, send_auth()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, send_backend_key_data(_, _)).WillByDefault(Invoke([](uint32_t, uint32_t) {
+      return boost::make_ready_future();
+    }));
     ON_CALL(*_connection, send_parameter_status(_, _)).WillByDefault(Invoke([](const std::string&, const std::string&) {
       return boost::make_ready_future();
     }));
@@ -76,14 +81,47 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_rows(_))
+        .WillByDefault(Invoke([](const std::shared_ptr<const std::vector<OutputPacket>>&) {
+          return boost::make_ready_future();
+        }));
+    ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
+    ON_CALL(*_connection, flush()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, discard_packet_body(_)).WillByDefault(Invoke([](uint32_t) {
       return boost::make_ready_future();
     }));
   }
 
+  // Execute the tasks instead of scheduling them
+  static boost::future<std::shared_ptr<const std::vector<OutputPacket>>> _execute_encode_task(
+      const std::shared_ptr<EncodeServerQueryResultTask>& task) {
+    task->execute();
+    return task->get_future();
+  }
+
+  static boost::future<std::shared_ptr<PreparedPlan>> _execute_parse_task(
+      const std::shared_ptr<ParseServerPreparedStatementTask>& task) {
+    task->execute();
+    return task->get_future();
+  }
+
+  // Returns the number of DataRow messages in the packets
+  static size_t _count_data_rows(const std::vector<OutputPacket>& packets) {
+    auto data_row_count = size_t{0};
+    for (const auto& packet : packets) {
+      auto input_packet = InputPacket{packet.data};
+      for (auto message_offset = size_t{0}; message_offset < packet.data.size(); ++data_row_count) {
+        input_packet.offset = input_packet.data.cbegin() + message_offset;
+        const auto header = PostgresWireHandler::handle_header(input_packet);
+        EXPECT_EQ(header.message_type, NetworkMessageType::DataRow);
+        message_offset += 5 + header.payload_length;
+      }
+    }
+    return data_row_count;
+  }
+
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
     // We don't mock the SQL Pipeline, so we have to provide a query that executes successfully
     auto t = load_table("resources/test_data/tbl/int.tbl", 10);
@@ -115,6 +153,7 @@ TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Expect that the session sends out an authentication response and an initial ReadyForQuery
   EXPECT_CALL(*_connection, send_auth());
   EXPECT_CALL(*_connection, send_parameter_status(_, _)).Times(2);
+  EXPECT_CALL(*_connection, send_backend_key_data(_, _));
   EXPECT_CALL(*_connection, send_ready_for_query());
 
   // Actually run the session: googlemock will record which Connection methods are called in which order
@@ -229,8 +268,14 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   // It sends the result schema...
   EXPECT_CALL(*_connection, send_row_description(_));
 
-  // ... as well as the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // ... as well as the row data, which is encoded by another scheduled task (one message per row)
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<EncodeServerQueryResultTask>>()))
+      .WillOnce(Invoke(_execute_encode_task));
+  EXPECT_CALL(*_connection, send_data_rows(_))
+      .WillOnce(Invoke([](const std::shared_ptr<const std::vector<OutputPacket>>& data_rows) {
+        EXPECT_EQ(_count_data_rows(*data_rows), 3u);
+        return boost::make_ready_future();
+      }));
 
   // Finally, the session completes the command...
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -245,6 +290,57 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionSendsLargeResultsInBatches) {
+  // Three chunks, of which the first two form the first batch
+  const auto chunk_size = EncodeServerQueryResultTask::BATCH_ROW_COUNT * 3 / 5;
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, chunk_size);
+  for (auto row_idx = size_t{0}; row_idx < 3 * chunk_size; ++row_idx) {
+    table->append({static_cast<int32_t>(row_idx)});
+  }
+  StorageManager::get().add_table("large", table);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM large;")))));
+
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->sql_pipeline =
+      std::make_shared<SQLPipeline>(SQLPipelineBuilder{"SELECT * FROM large;"}.create_pipeline());
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, send_row_description(_));
+
+  // The second batch is encoded before the first one is sent
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<EncodeServerQueryResultTask>>()))
+      .Times(2)
+      .WillRepeatedly(Invoke(_execute_encode_task));
+  EXPECT_CALL(*_connection, send_data_rows(_))
+      .WillOnce(Invoke([&](const std::shared_ptr<const std::vector<OutputPacket>>& data_rows) {
+        EXPECT_EQ(data_rows->size(), 2u);
+        EXPECT_EQ(_count_data_rows(*data_rows), 2 * chunk_size);
+        return boost::make_ready_future();
+      }))
+      .WillOnce(Invoke([&](const std::shared_ptr<const std::vector<OutputPacket>>& data_rows) {
+        EXPECT_EQ(data_rows->size(), 1u);
+        EXPECT_EQ(_count_data_rows(*data_rows), chunk_size);
+        return boost::make_ready_future();
+      }));
+
+  EXPECT_CALL(*_connection, send_command_complete(_));
+  EXPECT_CALL(*_connection, send_notice(_));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   InSequence s;
 
@@ -262,7 +358,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   // The session creates a SQLPipeline using a scheduled task (we're providing a 'real' SQLPipeline in the result)
   auto sql_pipeline = _create_working_sql_pipeline();
   auto parse_server_prepared_plan_result =
-      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+      std::make_shared<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
 
@@ -276,12 +372,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
-  // The session schedules a task to derive a Query Plan from the SQL Pipeline
-  const auto placeholder_plan = sql_pipeline->get_physical_plans().front();
-
-  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
-      .WillOnce(Return(ByMove(boost::make_ready_future(placeholder_plan->deep_copy()))));
-
+  // The parameters are bound when the portal is executed, so no task is scheduled here
   EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
 
   // Next: Execute command
@@ -292,12 +383,21 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   EXPECT_CALL(*_connection, receive_execute_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::string("")))));
 
-  // The session executes the SQLPipeline using another scheduled task
+  // The session binds the parameters and executes the plan using a single scheduled task, which returns the executed
+  // plan
+  sql_pipeline->get_result_table();
+  const auto executed_plan = sql_pipeline->get_physical_plans().front();
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
-      .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(executed_plan))));
 
-  // It sends the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // It sends the row data, which is encoded by another scheduled task (one message per row)
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<EncodeServerQueryResultTask>>()))
+      .WillOnce(Invoke(_execute_encode_task));
+  EXPECT_CALL(*_connection, send_data_rows(_))
+      .WillOnce(Invoke([](const std::shared_ptr<const std::vector<OutputPacket>>& data_rows) {
+        EXPECT_EQ(_count_data_rows(*data_rows), 3u);
+        return boost::make_ready_future();
+      }));
 
   // ... and completes the command
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -358,7 +458,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   // For this test, we don't actually have to set the SQL Pipeline in the result
   auto sql_pipeline = _create_working_sql_pipeline();
   auto parse_server_prepared_plan_result =
-      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+      std::make_shared<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
 
@@ -372,7 +472,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   EXPECT_CALL(*_connection,
               send_error("Named prepared statements must be explicitly closed before they can be redefined."));
 
-  EXPECT_CALL(*_connection, send_ready_for_query());
+  // Errors in the extended query protocol are followed by ReadyForQuery only once the client sends Sync
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -392,7 +492,6 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingUnknownNamedStatement) {
 
   EXPECT_CALL(*_connection, send_error("The specified statement does not exist."));
 
-  EXPECT_CALL(*_connection, send_ready_for_query());
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -414,7 +513,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
 
   auto sql_pipeline = _create_working_sql_pipeline();
   auto parse_server_prepared_plan_result =
-      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+      std::make_shared<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
 
@@ -428,11 +527,6 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
   EXPECT_CALL(*_connection, receive_bind_packet_body(42))
       .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
 
-  const auto placeholder_plan = sql_pipeline->get_physical_plans().front();
-
-  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
-      .WillOnce(Return(ByMove(boost::make_ready_future(placeholder_plan->deep_copy()))));
-
   EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
 
   // Send the same Bind command again
@@ -442,10 +536,157 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
 
   EXPECT_CALL(*_connection, send_error("Named portals must be explicitly closed before they can be redefined."));
 
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionSkipsMessagesUntilSyncAfterError) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  // The client pipelines Bind, Execute, and Sync. Binding fails...
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"my_named_statement", "", {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  EXPECT_CALL(*_connection, send_error("The specified statement does not exist."));
+
+  // ... so the Execute message is discarded instead of being processed
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 23};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+  EXPECT_CALL(*_connection, discard_packet_body(23));
+  EXPECT_CALL(*_connection, receive_execute_packet_body(_)).Times(0);
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
+      .Times(0);
+
+  // The Sync message ends the skipping
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 4};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+  EXPECT_CALL(*_connection, receive_sync_packet_body(4)).WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionsSharePreparedPlans) {
+  _create_working_sql_pipeline();
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  ParsePacket parse_packet = {"my_named_statement", "SELECT * FROM foo WHERE a > ?;"};
+
+  {
+    InSequence s;
+
+    // The first session that prepares the query translates it in a scheduled task, which caches the plan
+    EXPECT_CALL(*_connection, send_ready_for_query());
+    EXPECT_CALL(*_connection, receive_packet_header())
+        .WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+    EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+        .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+    EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+        .WillOnce(Invoke(_execute_parse_task));
+    EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+    EXPECT_CALL(*_connection, receive_packet_header());
+
+    _session->start().wait();
+  }
+
+  const auto cached_prepared_plan = SQLPreparedPlanCache::get().try_get(parse_packet.query);
+  ASSERT_TRUE(cached_prepared_plan);
+  EXPECT_EQ((*cached_prepared_plan)->parameter_ids.size(), 1u);
+
+  {
+    InSequence s;
+
+    // Another session that prepares the same query uses the cached plan without scheduling a task
+    auto other_session = std::make_shared<TestServerSession>(_connection, _task_runner);
+    EXPECT_CALL(*_connection, send_ready_for_query());
+    EXPECT_CALL(*_connection, receive_packet_header())
+        .WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+    EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+        .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+    EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+        .Times(0);
+    EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+    EXPECT_CALL(*_connection, receive_packet_header());
+
+    other_session->start().wait();
+  }
+}
+
+TEST_F(ServerSessionTest, ParseSetStatementTimeout) {
+  EXPECT_EQ(parse_set_statement_timeout("SET statement_timeout = 100;"), std::chrono::milliseconds{100});
+  EXPECT_EQ(parse_set_statement_timeout("set STATEMENT_TIMEOUT to '5s'"), std::chrono::seconds{5});
+  // The SQL string of a SimpleQueryCommand is terminated by a \0-byte
+  const auto terminated_sql = std::string("SET statement_timeout = '2min';") + '\0';
+  EXPECT_EQ(parse_set_statement_timeout(terminated_sql), std::chrono::minutes{2});
+  EXPECT_EQ(parse_set_statement_timeout("SET statement_timeout = 0"), std::chrono::milliseconds{0});
+  EXPECT_FALSE(parse_set_statement_timeout("SET statement_timeout = 'abc'"));
+  EXPECT_FALSE(parse_set_statement_timeout("SELECT * FROM foo"));
+}
+
+TEST_F(ServerSessionTest, SessionHandlesSetStatementTimeout) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SET statement_timeout = 1000;")))));
+
+  // The setting is handled by the session itself, no SQLPipeline is created
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>())).Times(0);
+  EXPECT_CALL(*_connection, send_command_complete("SET"));
+
   EXPECT_CALL(*_connection, send_ready_for_query());
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionHandlesCancelRequest) {
+  auto& registry = CancelRequestRegistry::get();
+  const auto backend_key = registry.register_session();
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  registry.set_running_statement(backend_key.process_id, cancellation_token);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, receive_startup_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(PostgresWireHandler::CANCEL_REQUEST))));
+
+  // A wrong secret key is ignored
+  const auto wrong_key = CancelRequestPacket{backend_key.process_id, backend_key.secret_key + 1};
+  EXPECT_CALL(*_connection, receive_cancel_request_body())
+      .WillOnce(Return(ByMove(boost::make_ready_future(wrong_key))));
+
+  // The connection is closed without a response
+  EXPECT_CALL(*_connection, send_auth()).Times(0);
+  EXPECT_CALL(*_connection, receive_packet_header()).Times(0);
+
+  _session->start().wait();
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+
+  auto cancel_session = std::make_shared<TestServerSession>(_connection, _task_runner);
+  EXPECT_CALL(*_connection, receive_startup_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(PostgresWireHandler::CANCEL_REQUEST))));
+  const auto correct_key = CancelRequestPacket{backend_key.process_id, backend_key.secret_key};
+  EXPECT_CALL(*_connection, receive_cancel_request_body())
+      .WillOnce(Return(ByMove(boost::make_ready_future(correct_key))));
+
+  cancel_session->start().wait();
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+
+  registry.unregister_session(backend_key.process_id);
+}
+
 }  // namespace opossum
@@ -0,0 +1,119 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "sql/explain_analyze.hpp"
+#include "sql/query_result_cache.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ExplainAnalyzeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  // Returns the index of the first row whose operator column (without its indentation) equals @param name
+  size_t find_operator_row(const Table& table, const std::string& name) {
+    for (auto row_idx = size_t{0}; row_idx < table.row_count(); ++row_idx) {
+      const auto operator_name = table.get_value<pmr_string>(ColumnID{0}, row_idx);
+      if (operator_name.substr(operator_name.find_first_not_of(' ')) == pmr_string{name}) return row_idx;
+    }
+    ADD_FAILURE() << "No row for operator " << name;
+    return 0;
+  }
+
+  AllTypeVariant get_value(const Table& table, const std::string& column_name, const size_t row_idx) {
+    const auto chunk = table.get_chunk(ChunkID{0});
+    return (*chunk->get_segment(table.column_id_by_name(column_name)))[row_idx];
+  }
+};
+
+TEST_F(ExplainAnalyzeTest, StripPrefix) {
+  EXPECT_EQ(strip_explain_analyze_prefix("EXPLAIN ANALYZE SELECT 1"), "SELECT 1");
+  EXPECT_EQ(strip_explain_analyze_prefix("  explain\n  Analyze SELECT 1"), "SELECT 1");
+  EXPECT_FALSE(strip_explain_analyze_prefix("SELECT 1"));
+  EXPECT_FALSE(strip_explain_analyze_prefix("EXPLAIN SELECT 1"));
+  EXPECT_FALSE(strip_explain_analyze_prefix("EXPLAIN ANALYZED SELECT 1"));
+  EXPECT_FALSE(strip_explain_analyze_prefix("EXPLAIN"));
+}
+
+TEST_F(ExplainAnalyzeTest, Aggregate) {
+  auto pipeline_statement =
+      SQLPipelineBuilder{"EXPLAIN ANALYZE SELECT a, SUM(b) FROM table_a WHERE a > 1000 GROUP BY a"}
+          .create_pipeline_statement();
+  EXPECT_EQ(pipeline_statement.get_sql_string(), "SELECT a, SUM(b) FROM table_a WHERE a > 1000 GROUP BY a");
+
+  const auto table = pipeline_statement.get_result_table();
+  ASSERT_TRUE(table);
+  EXPECT_EQ(table->column_count(), 9u);
+  EXPECT_EQ(table->row_count(), pipeline_statement.get_tasks().size());
+
+  // The root operator is not indented, its inputs are
+  EXPECT_NE(table->get_value<pmr_string>(ColumnID{0}, 0).front(), ' ');
+  EXPECT_EQ(table->get_value<pmr_string>(ColumnID{0}, 1).substr(0, 2), "  ");
+
+  const auto get_table_row = find_operator_row(*table, "GetTable");
+  EXPECT_EQ(get_value(*table, "rows_in", get_table_row), AllTypeVariant{int64_t{0}});
+  EXPECT_EQ(get_value(*table, "rows_out", get_table_row), AllTypeVariant{int64_t{3}});
+  EXPECT_EQ(get_value(*table, "chunks_out", get_table_row), AllTypeVariant{int64_t{2}});
+  EXPECT_TRUE(variant_is_null(get_value(*table, "output_bytes", get_table_row)));
+  EXPECT_EQ(get_value(*table, "estimated_rows", get_table_row), AllTypeVariant{3.0});
+
+  const auto table_scan_row = find_operator_row(*table, "TableScan");
+  EXPECT_EQ(get_value(*table, "rows_in", table_scan_row), AllTypeVariant{int64_t{3}});
+  EXPECT_EQ(get_value(*table, "rows_out", table_scan_row), AllTypeVariant{int64_t{2}});
+  EXPECT_FALSE(variant_is_null(get_value(*table, "estimated_rows", table_scan_row)));
+  EXPECT_NE(table->get_value<pmr_string>(ColumnID{8}, table_scan_row).find("chunks scanned"), pmr_string::npos);
+
+  const auto aggregate_row = find_operator_row(*table, "Aggregate");
+  EXPECT_EQ(get_value(*table, "rows_out", aggregate_row), AllTypeVariant{int64_t{2}});
+  EXPECT_FALSE(variant_is_null(get_value(*table, "output_bytes", aggregate_row)));
+  EXPECT_NE(table->get_value<pmr_string>(ColumnID{8}, aggregate_row).find("groupby"), pmr_string::npos);
+}
+
+TEST_F(ExplainAnalyzeTest, JoinHash) {
+  auto pipeline = SQLPipelineBuilder{"EXPLAIN ANALYZE SELECT * FROM table_a AS t1 JOIN table_a AS t2 ON t1.a = t2.a"}
+                      .create_pipeline();
+  const auto table = pipeline.get_result_table();
+
+  const auto join_row = find_operator_row(*table, "JoinHash");
+  EXPECT_EQ(get_value(*table, "rows_in", join_row), AllTypeVariant{int64_t{6}});
+  EXPECT_EQ(get_value(*table, "rows_out", join_row), AllTypeVariant{int64_t{3}});
+
+  const auto details = table->get_value<pmr_string>(ColumnID{8}, join_row);
+  EXPECT_NE(details.find("materialization"), pmr_string::npos);
+  EXPECT_NE(details.find("probe"), pmr_string::npos);
+
+  EXPECT_EQ(pipeline.get_sql_strings().front(), "SELECT * FROM table_a AS t1 JOIN table_a AS t2 ON t1.a = t2.a");
+}
+
+TEST_F(ExplainAnalyzeTest, NotTakenFromQueryResultCache) {
+  QueryResultCache::get().resize(16);
+
+  const auto sql = std::string{"SELECT * FROM table_a"};
+  SQLPipelineBuilder{sql}.create_pipeline_statement().get_result_table();
+
+  auto pipeline_statement = SQLPipelineBuilder{"EXPLAIN ANALYZE " + sql}.create_pipeline_statement();
+  const auto table = pipeline_statement.get_result_table();
+  EXPECT_FALSE(pipeline_statement.metrics()->query_result_cache_hit);
+  EXPECT_EQ(table->column_name(ColumnID{0}), "operator");
+}
+
+TEST_F(ExplainAnalyzeTest, StatementWithoutResult) {
+  auto pipeline_statement =
+      SQLPipelineBuilder{"EXPLAIN ANALYZE INSERT INTO table_a VALUES (1, 1.0)"}.create_pipeline_statement();
+  const auto table = pipeline_statement.get_result_table();
+  ASSERT_TRUE(table);
+  find_operator_row(*table, "Insert");
+}
+
+TEST_F(ExplainAnalyzeTest, MultipleStatements) {
+  EXPECT_THROW(SQLPipelineBuilder{"EXPLAIN ANALYZE SELECT 1; SELECT 2"}.create_pipeline(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/normalize_sql_literals.hpp"
+
+namespace opossum {
+
+class NormalizeSQLLiteralsTest : public BaseTest {};
+
+TEST_F(NormalizeSQLLiteralsTest, ReplacesPredicateLiterals) {
+  const auto normalized_sql = normalize_sql_literals("SELECT a FROM t WHERE a > 5 AND b = 'x' AND c < 2.5");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "SELECT a FROM t WHERE a > ? AND b = ? AND c < ?");
+  EXPECT_EQ(normalized_sql->literals,
+            (std::vector<AllTypeVariant>{int32_t{5}, AllTypeVariant{pmr_string{"x"}}, double{2.5}}));
+  EXPECT_EQ(normalized_sql->cache_key, "[int, string, double] SELECT a FROM t WHERE a > ? AND b = ? AND c < ?");
+}
+
+TEST_F(NormalizeSQLLiteralsTest, SameShapeSameKey) {
+  const auto normalized_sql_a = normalize_sql_literals("SELECT a FROM t WHERE a > 5;");
+  const auto normalized_sql_b = normalize_sql_literals("select a from t   -- comment\n where a > 17");
+  const auto normalized_sql_c = normalize_sql_literals("SELECT a FROM t WHERE a > 17.0");
+  const auto normalized_sql_d = normalize_sql_literals("SELECT a FROM t WHERE a > 5000000000");
+  ASSERT_TRUE(normalized_sql_a && normalized_sql_b && normalized_sql_c && normalized_sql_d);
+
+  EXPECT_EQ(normalized_sql_a->cache_key, "[int] SELECT a FROM t WHERE a > ?");
+  EXPECT_EQ(normalized_sql_b->cache_key, "[int] select a from t where a > ?");
+  EXPECT_EQ(normalized_sql_c->cache_key, "[double] SELECT a FROM t WHERE a > ?");
+  EXPECT_EQ(normalized_sql_d->cache_key, "[long] SELECT a FROM t WHERE a > ?");
+  EXPECT_EQ(normalized_sql_d->literals, (std::vector<AllTypeVariant>{int64_t{5'000'000'000}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, Signs) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a BETWEEN -5 AND b - 3 AND c = -(2)");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a BETWEEN ? AND b - ? AND c = -(?)");
+  EXPECT_EQ(normalized_sql->literals, (std::vector<AllTypeVariant>{int32_t{-5}, int32_t{3}, int32_t{2}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsStructuralLiterals) {
+  const auto normalized_sql = normalize_sql_literals(
+      "SELECT a + 1, 'x' FROM t1 JOIN t2 ON t1.a = t2.a AND t2.b = 2 WHERE EXTRACT(YEAR FROM d) = 1995 AND "
+      "e < DATE '1995-01-01' AND f IN (SELECT f FROM t3 WHERE g = 3) GROUP BY a HAVING COUNT(*) > 4 ORDER BY 1 "
+      "LIMIT 10");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql,
+            "SELECT a + 1, 'x' FROM t1 JOIN t2 ON t1.a = t2.a AND t2.b = 2 WHERE EXTRACT(YEAR FROM d) = ? AND "
+            "e < DATE '1995-01-01' AND f IN (SELECT f FROM t3 WHERE g = 3) GROUP BY a HAVING COUNT(*) > ? ORDER BY 1 "
+            "LIMIT 10");
+  EXPECT_EQ(normalized_sql->literals, (std::vector<AllTypeVariant>{int32_t{1995}, int32_t{4}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, NotNormalized) {
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT a, 5 FROM t ORDER BY a LIMIT 3"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = ?"));
+  EXPECT_FALSE(normalize_sql_literals("INSERT INTO t VALUES (1, 2)"));
+  EXPECT_FALSE(normalize_sql_literals("UPDATE t SET a = 1 WHERE b = 2"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = 1; SELECT * FROM t WHERE a = 2"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = 'it''s'"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = 'unterminated"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a > 1e5"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE (a > 1"));
+}
+
+}  // namespace opossum
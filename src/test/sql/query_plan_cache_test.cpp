@@ -8,6 +8,8 @@
 #include "cache/gdfs_cache.hpp"
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
+#include "cache/sampled_lfu_cache.hpp"
+#include "sql/normalize_sql_literals.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -26,22 +28,28 @@ class QueryPlanCacheTest : public BaseTest {
 
     _query_plan_cache_hits = 0;
 
+    SQLLogicalPlanCache::get().clear();
     SQLPhysicalPlanCache::get().clear();
   }
 
-  void execute_query(const std::string& query) {
+  std::shared_ptr<const Table> execute_query(const std::string& query) {
     auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
-    pipeline_statement.get_result_table();
+    const auto result_table = pipeline_statement.get_result_table();
 
     if (pipeline_statement.metrics()->query_plan_cache_hit) {
       _query_plan_cache_hits++;
     }
+
+    return result_table;
   }
 
   const std::string Q1 = "SELECT * FROM table_a;";
   const std::string Q2 = "SELECT * FROM table_b;";
   const std::string Q3 = "SELECT * FROM table_a WHERE a > 1;";
 
+  // Q3 is cached under its normalized form
+  const std::string Q3_CACHE_KEY = normalize_sql_literals(Q3)->cache_key;
+
   size_t _query_plan_cache_hits;
 };
 
@@ -83,7 +91,7 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRU) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(Q3_CACHE_KEY));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
@@ -113,7 +121,7 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheGDFS) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(Q3_CACHE_KEY));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
@@ -140,11 +148,85 @@ TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
 
   EXPECT_TRUE(cache.has(Q1));
   EXPECT_FALSE(cache.has(Q2));
-  EXPECT_TRUE(cache.has(Q3));
+  EXPECT_TRUE(cache.has(Q3_CACHE_KEY));
   EXPECT_FALSE(cache.has("SELECT * FROM test;"));
 
   // Check for the expected number of hits.
   EXPECT_EQ(5u, _query_plan_cache_hits);
 }
 
+TEST_F(QueryPlanCacheTest, StatementsWithDifferentLiteralsSharePlans) {
+  auto& cache = SQLPhysicalPlanCache::get();
+
+  const auto result_a = execute_query("SELECT a FROM table_a WHERE a > 200 AND b < 458.0");  // Miss.
+  const auto result_b = execute_query("SELECT a FROM table_a WHERE a > 1000 AND b < 500.0");  // Hit.
+  const auto result_c = execute_query("SELECT a FROM table_a WHERE a > 1000 AND b < 500");  // Miss, b < Int.
+  const auto result_d = execute_query("SELECT a FROM table_a WHERE a > 100000 AND b < 500");  // Hit.
+
+  EXPECT_EQ(2u, _query_plan_cache_hits);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.has("[int, double] SELECT a FROM table_a WHERE a > ? AND b < ?"));
+  EXPECT_TRUE(cache.has("[int, int] SELECT a FROM table_a WHERE a > ? AND b < ?"));
+  EXPECT_TRUE(SQLLogicalPlanCache::get().has("[int, double] SELECT a FROM table_a WHERE a > ? AND b < ?"));
+
+  // The literals are bound to the copies of the cached plan
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto expected_result_a = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result_a->append({1234});
+  const auto expected_result_b = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result_b->append({12345});
+  expected_result_b->append({1234});
+
+  EXPECT_TABLE_EQ_UNORDERED(result_a, expected_result_a);
+  EXPECT_TABLE_EQ_UNORDERED(result_b, expected_result_b);
+  EXPECT_TABLE_EQ_UNORDERED(result_c, expected_result_b);
+  EXPECT_EQ(result_d->row_count(), 0u);
+}
+
+TEST_F(QueryPlanCacheTest, LiteralsInCorrelatedSubqueries) {
+  // The literal is allocated a ParameterID after the correlated parameter of the subquery. Such plans are not cached,
+  // but the literal is still bound correctly.
+  const auto query =
+      "SELECT a FROM table_a WHERE b > (SELECT MIN(table_b.b) FROM table_b WHERE table_b.a = table_a.a) OR a = 123";
+  const auto result = execute_query(query);
+  execute_query(query);
+
+  EXPECT_EQ(0u, _query_plan_cache_hits);
+
+  const auto expected_result =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  expected_result->append({12345});
+  expected_result->append({123});
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_result);
+}
+
+TEST_F(QueryPlanCacheTest, BoundedByMemory) {
+  auto& cache = SQLPhysicalPlanCache::get();
+  cache.replace_cache_impl<SampledLFUCache<std::string, std::shared_ptr<AbstractOperator>>>(DefaultCacheCapacity);
+
+  // Plans with more operators and expressions are estimated to use more memory
+  auto q1_pipeline_statement = SQLPipelineBuilder{Q1}.create_pipeline_statement();
+  const auto q1_memory_usage = estimate_plan_memory_usage(q1_pipeline_statement.get_physical_plan());
+  auto q3_pipeline_statement = SQLPipelineBuilder{Q3}.create_pipeline_statement();
+  const auto q3_memory_usage = estimate_plan_memory_usage(q3_pipeline_statement.get_physical_plan());
+  EXPECT_GT(q1_memory_usage, 0u);
+  EXPECT_GT(q3_memory_usage, q1_memory_usage);
+  EXPECT_GT(estimate_plan_memory_usage(q3_pipeline_statement.get_optimized_logical_plan()), 0u);
+
+  // The budget is split between the shards. Q3 exceeds the budget of a shard, Q1 does not.
+  cache.clear();
+  cache.set_memory_budget(cache.shard_count() * (q1_memory_usage + q3_memory_usage) / 2);
+
+  execute_query(Q1);  // Miss.
+  execute_query(Q3);  // Miss, not cached.
+  execute_query(Q1);  // Hit.
+  execute_query(Q3);  // Miss, not cached.
+
+  EXPECT_EQ(1u, _query_plan_cache_hits);
+  EXPECT_TRUE(cache.has(Q1));
+  EXPECT_FALSE(cache.has(Q3_CACHE_KEY));
+
+  cache.set_memory_budget(DefaultCacheMemoryBudget);
+}
+
 }  // namespace opossum
@@ -0,0 +1,161 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "sql/query_result_cache.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class QueryResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_a = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table_a);
+
+    QueryResultCache::get().resize(16);
+  }
+
+  std::shared_ptr<const Table> execute_query(const std::string& query) {
+    auto pipeline_statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    const auto result_table = pipeline_statement.get_result_table();
+    _query_result_cache_hits += pipeline_statement.metrics()->query_result_cache_hit;
+    return result_table;
+  }
+
+  const std::string Q1 = "SELECT * FROM table_a WHERE a > 1000";
+
+  std::shared_ptr<Table> _table_a;
+  size_t _query_result_cache_hits{0};
+};
+
+TEST_F(QueryResultCacheTest, RepeatedStatementsAreNotExecuted) {
+  const auto result = execute_query(Q1);  // Miss.
+  EXPECT_EQ(result->row_count(), 2u);
+
+  auto pipeline_statement = SQLPipelineBuilder{Q1}.create_pipeline_statement();
+  EXPECT_EQ(pipeline_statement.get_result_table(), result);  // Hit.
+  EXPECT_TRUE(pipeline_statement.metrics()->query_result_cache_hit);
+  EXPECT_FALSE(pipeline_statement.get_physical_plan()->get_output());
+
+  EXPECT_EQ(QueryResultCache::get().size(), 1u);
+}
+
+TEST_F(QueryResultCacheTest, LiteralsArePartOfTheKey) {
+  execute_query("SELECT * FROM table_a WHERE a > 1000");  // Miss.
+  execute_query("SELECT * FROM table_a WHERE a > 100");  // Miss.
+  const auto result = execute_query("SELECT * FROM table_a WHERE a > 100");  // Hit.
+
+  EXPECT_EQ(_query_result_cache_hits, 1u);
+  EXPECT_EQ(result->row_count(), 3u);
+}
+
+TEST_F(QueryResultCacheTest, InvalidatedByCommits) {
+  execute_query(Q1);  // Miss.
+  const auto version = _table_a->version();
+
+  execute_query("INSERT INTO table_a VALUES (5000, 1.0)");
+  EXPECT_GT(_table_a->version(), version);
+  EXPECT_EQ(execute_query(Q1)->row_count(), 3u);  // Miss.
+
+  execute_query("DELETE FROM table_a WHERE a = 5000");
+  EXPECT_EQ(execute_query(Q1)->row_count(), 2u);  // Miss.
+
+  execute_query("UPDATE table_a SET a = 6000 WHERE a = 1234");
+  EXPECT_EQ(execute_query(Q1)->row_count(), 2u);  // Miss.
+  EXPECT_EQ(execute_query(Q1)->row_count(), 2u);  // Hit.
+
+  EXPECT_EQ(_query_result_cache_hits, 1u);
+}
+
+TEST_F(QueryResultCacheTest, UncommittedWritesDoNotInvalidate) {
+  execute_query(Q1);  // Miss.
+
+  // An uncommitted insert neither changes the version nor the result of other transactions
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (5000, 1.0)"}
+                      .with_transaction_context(transaction_context)
+                      .create_pipeline();
+  pipeline.get_result_table();
+
+  execute_query(Q1);  // Hit.
+  transaction_context->rollback();
+  execute_query(Q1);  // Hit.
+
+  EXPECT_EQ(_query_result_cache_hits, 2u);
+}
+
+TEST_F(QueryResultCacheTest, InvalidatedByEncoding) {
+  execute_query(Q1);  // Miss.
+  ChunkEncoder::encode_all_chunks(_table_a, SegmentEncodingSpec{EncodingType::Dictionary});
+  execute_query(Q1);  // Miss.
+  execute_query(Q1);  // Hit.
+
+  EXPECT_EQ(_query_result_cache_hits, 1u);
+}
+
+TEST_F(QueryResultCacheTest, InvalidatedByReplacedTable) {
+  execute_query(Q1);  // Miss.
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  execute_query(Q1);  // Miss, the version of the new table is the same.
+
+  EXPECT_EQ(_query_result_cache_hits, 0u);
+}
+
+TEST_F(QueryResultCacheTest, OnlyForAutoCommitReadOnlyStatements) {
+  // Statements in a transaction might see their own uncommitted writes
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{Q1}.with_transaction_context(transaction_context).create_pipeline().get_result_table();
+  SQLPipelineBuilder{Q1}.disable_mvcc().create_pipeline().get_result_table();
+  EXPECT_EQ(QueryResultCache::get().size(), 0u);
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  EXPECT_TRUE(QueryResultCache::create_key("key", {}, get_table));
+  const auto insert = std::make_shared<Insert>("table_a", get_table);
+  EXPECT_FALSE(QueryResultCache::create_key("key", {}, insert));
+}
+
+TEST_F(QueryResultCacheTest, Snapshots) {
+  const auto result = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data);
+  const auto result_key = *QueryResultCache::create_key("key", {int32_t{1}}, std::make_shared<GetTable>("table_a"));
+  EXPECT_EQ(result_key.tables.size(), 1u);
+
+  _table_a->register_commit(CommitID{3});
+  QueryResultCache::get().set(result_key, result, CommitID{5});
+
+  // Valid for all snapshots that include the last commit to the table
+  EXPECT_EQ(QueryResultCache::get().try_get(result_key, CommitID{5}), result);
+  EXPECT_EQ(QueryResultCache::get().try_get(result_key, CommitID{7}), result);
+  EXPECT_EQ(QueryResultCache::get().try_get(result_key, CommitID{3}), result);
+  EXPECT_FALSE(QueryResultCache::get().try_get(result_key, CommitID{2}));
+
+  // A commit after the snapshot of the result
+  _table_a->register_commit(CommitID{6});
+  EXPECT_FALSE(QueryResultCache::get().try_get(result_key, CommitID{7}));
+  EXPECT_EQ(_table_a->last_commit_id(), CommitID{6});
+
+  // Commits are registered out of order
+  _table_a->register_commit(CommitID{4});
+  EXPECT_EQ(_table_a->last_commit_id(), CommitID{6});
+}
+
+TEST_F(QueryResultCacheTest, DisabledByDefault) {
+  QueryResultCache::get().resize(0);
+  EXPECT_FALSE(QueryResultCache::get().is_enabled());
+
+  execute_query(Q1);
+  execute_query(Q1);
+
+  EXPECT_EQ(_query_result_cache_hits, 0u);
+  EXPECT_EQ(QueryResultCache::get().size(), 0u);
+}
+
+}  // namespace opossum
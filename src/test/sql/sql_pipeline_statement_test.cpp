@@ -19,6 +19,8 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace {
@@ -531,6 +533,20 @@ TEST_F(SQLPipelineStatementTest, GetTimes) {
   EXPECT_GT(metrics->execution_time_nanos, zero_duration);
 }
 
+TEST_F(SQLPipelineStatementTest, PeakMemoryUsage) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  const auto& metrics = sql_pipeline.metrics();
+  EXPECT_EQ(metrics->peak_memory_usage, 0u);
+
+  sql_pipeline.get_result_table();
+
+  // The peak covers at least the result, whose output is not released
+  const auto& root_performance_data = sql_pipeline.get_physical_plan()->performance_data();
+  ASSERT_TRUE(root_performance_data.output_memory_usage);
+  EXPECT_GE(metrics->peak_memory_usage, *root_performance_data.output_memory_usage);
+  EXPECT_GT(metrics->peak_memory_usage, 0u);
+}
+
 TEST_F(SQLPipelineStatementTest, ParseErrorDebugMessage) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -579,4 +595,37 @@ TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   EXPECT_TABLE_EQ_UNORDERED(second_subquery_result, expected_second_result);
 }
 
+TEST_F(SQLPipelineStatementTest, CachedPlanOnIndexedTable) {
+  // Large enough for the IndexScanRule to consider the index. The literals of the statements are replaced by
+  // parameters, which the IndexScan of the cached plan resolves when it is executed.
+  auto indexed_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 500);
+  for (auto value = 0; value < 2000; ++value) {
+    indexed_table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(indexed_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  indexed_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  StorageManager::get().add_table("indexed_table", indexed_table);
+
+  for (const auto value : {42, 1234}) {
+    const auto sql = "SELECT a FROM indexed_table WHERE a = " + std::to_string(value);
+    auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline_statement();
+    const auto result_table = sql_pipeline.get_result_table();
+
+    auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data);
+    expected_table->append({value});
+    EXPECT_TABLE_EQ_UNORDERED(result_table, expected_table);
+    EXPECT_EQ(sql_pipeline.metrics()->query_plan_cache_hit, value != 42);
+
+    auto uses_index_scan = false;
+    const auto visit_operator = [&](const auto& visit, const std::shared_ptr<const AbstractOperator>& op) -> void {
+      if (!op) return;
+      if (op->type() == OperatorType::IndexScan) uses_index_scan = true;
+      visit(visit, op->input_left());
+      visit(visit, op->input_right());
+    };
+    visit_operator(visit_operator, sql_pipeline.get_physical_plan());
+    EXPECT_TRUE(uses_index_scan);
+  }
+}
+
 }  // namespace opossum
@@ -458,6 +458,20 @@ TEST_F(SQLPipelineTest, GetTimes) {
   EXPECT_GT(statement_metrics->execution_time_nanos, zero_duration);
 }
 
+TEST_F(SQLPipelineTest, QueryPlanCacheHitRate) {
+  auto sql_pipeline = SQLPipelineBuilder{
+      "SELECT * FROM table_a WHERE a = 123; SELECT * FROM table_a WHERE a = 1234; SELECT * FROM table_a WHERE b > 1;"
+      "SELECT * FROM table_a WHERE a = 12345"}
+                          .create_pipeline();
+  sql_pipeline.get_result_tables();
+
+  // The second and the fourth statement only differ from the first one in their literal
+  const auto& metrics = sql_pipeline.metrics();
+  EXPECT_DOUBLE_EQ(metrics.query_plan_cache_hit_rate(), 0.5);
+  EXPECT_NE(metrics.to_string().find("QUERY PLAN CACHE HITS: 2/4 statement(s) (50 %)"), std::string::npos);
+  EXPECT_NE(metrics.to_string().find("PEAK MEMORY: "), std::string::npos);
+}
+
 TEST_F(SQLPipelineTest, RequiresExecutionVariations) {
   EXPECT_FALSE(SQLPipelineBuilder{_select_query_a}.create_pipeline().requires_execution());
   EXPECT_FALSE(SQLPipelineBuilder{_join_query}.create_pipeline().requires_execution());
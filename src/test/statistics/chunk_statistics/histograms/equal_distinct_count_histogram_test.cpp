@@ -762,4 +762,42 @@ TEST_F(EqualDistinctCountHistogramTest, StringLikeEdgePruning) {
   EXPECT_FALSE(hist->can_prune(PredicateCondition::Like, "z%"));
 }
 
+TEST_F(EqualDistinctCountHistogramTest, FromDistribution) {
+  const auto value_counts = std::vector<std::pair<int32_t, HistogramCountType>>{{1, 90}, {2, 1}, {3, 1}, {4, 2}};
+  const auto hist = EqualDistinctCountHistogram<int32_t>::from_distribution(value_counts, 2u);
+
+  ASSERT_TRUE(hist);
+  EXPECT_EQ(hist->bin_count(), 2u);
+  EXPECT_EQ(hist->total_count(), 94u);
+  EXPECT_EQ(hist->total_distinct_count(), 4u);
+  EXPECT_FLOAT_EQ(hist->estimate_cardinality(PredicateCondition::LessThanEquals, 2), 91.f);
+
+  EXPECT_FALSE(EqualDistinctCountHistogram<int32_t>::from_distribution({}, 2u));
+}
+
+TEST_F(EqualDistinctCountHistogramTest, EstimateEquiJoinCardinality) {
+  const auto left_hist = EqualDistinctCountHistogram<int32_t>::from_distribution({{1, 90}, {2, 1}, {3, 1}}, 3u);
+  const auto right_hist = EqualDistinctCountHistogram<int32_t>::from_distribution({{2, 4}, {3, 1}, {4, 1}}, 3u);
+  const auto disjoint_hist = EqualDistinctCountHistogram<int32_t>::from_distribution({{10, 5}, {11, 5}}, 2u);
+
+  // 1 * 4 pairs for the value 2, 1 * 1 pair for the value 3
+  EXPECT_FLOAT_EQ(left_hist->estimate_equi_join_cardinality(*right_hist), 5.f);
+  EXPECT_FLOAT_EQ(right_hist->estimate_equi_join_cardinality(*left_hist), 5.f);
+  EXPECT_FLOAT_EQ(left_hist->estimate_equi_join_cardinality(*disjoint_hist), 0.f);
+
+  // The single bin of wide_hist is split by the bins of disjoint_hist, each part is estimated to hold 5 values
+  const auto wide_hist = EqualDistinctCountHistogram<int32_t>::from_distribution({{10, 5}, {11, 5}}, 1u);
+  EXPECT_FLOAT_EQ(wide_hist->estimate_equi_join_cardinality(*disjoint_hist), 50.f);
+}
+
+TEST_F(EqualDistinctCountHistogramTest, SupportsValue) {
+  const auto int_hist = EqualDistinctCountHistogram<int32_t>::from_distribution({{1, 1}}, 1u);
+  EXPECT_TRUE(int_hist->supports_value(1));
+  EXPECT_FALSE(int_hist->supports_value(NULL_VALUE));
+
+  const auto string_hist = EqualDistinctCountHistogram<pmr_string>::from_distribution({{"abc", 1}}, 1u, "abc", 4u);
+  EXPECT_TRUE(string_hist->supports_value("cab"));
+  EXPECT_FALSE(string_hist->supports_value("abd"));
+}
+
 }  // namespace opossum
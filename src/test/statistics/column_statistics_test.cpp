@@ -18,8 +18,10 @@ namespace opossum {
 class ColumnStatisticsTest : public BaseTest {
  protected:
   void SetUp() override {
+    // Most tests cover the estimation from min, max and distinct count, so the statistics are generated without
+    // histograms
     _table_with_different_column_types = load_table("resources/test_data/tbl/int_float_double_string.tbl");
-    auto table_statistics1 = generate_table_statistics(*_table_with_different_column_types);
+    auto table_statistics1 = generate_table_statistics(*_table_with_different_column_types, std::nullopt);
     _column_statistics_int = std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(
         std::const_pointer_cast<BaseColumnStatistics>(table_statistics1.column_statistics()[0]));
     _column_statistics_float = std::dynamic_pointer_cast<ColumnStatistics<float>>(
@@ -30,7 +32,7 @@ class ColumnStatisticsTest : public BaseTest {
         std::const_pointer_cast<BaseColumnStatistics>(table_statistics1.column_statistics()[3]));
 
     _table_uniform_distribution = load_table("resources/test_data/tbl/int_equal_distribution.tbl");
-    auto table_statistics2 = generate_table_statistics(*_table_uniform_distribution);
+    auto table_statistics2 = generate_table_statistics(*_table_uniform_distribution, std::nullopt);
     _column_statistics_uniform_columns = table_statistics2.column_statistics();
   }
 
@@ -493,4 +495,67 @@ TEST_F(ColumnStatisticsTest, TwoColumnsNonOverlappingDomains) {
   }
 }
 
+TEST_F(ColumnStatisticsTest, HistogramSkewedDistribution) {
+  // 90 times the value 1 and the values 2..11 once each
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10);
+  for (auto row_idx = 0; row_idx < 90; ++row_idx) table->append({1});
+  for (auto value = 2; value <= 11; ++value) table->append({value});
+
+  const auto column_statistics = std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(
+      generate_table_statistics(*table).column_statistics()[0]);
+  ASSERT_TRUE(column_statistics->histogram());
+  EXPECT_EQ(column_statistics->histogram()->total_count(), 100u);
+
+  EXPECT_FLOAT_EQ(column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, 1).selectivity, 0.9f);
+  EXPECT_FLOAT_EQ(column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, 5).selectivity, 0.01f);
+  EXPECT_FLOAT_EQ(column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, 50).selectivity, 0.f);
+  EXPECT_FLOAT_EQ(column_statistics->estimate_predicate_with_value(PredicateCondition::NotEquals, 1).selectivity,
+                  0.1f);
+  EXPECT_FLOAT_EQ(column_statistics->estimate_predicate_with_value(PredicateCondition::LessThan, 2).selectivity, 0.9f);
+  EXPECT_FLOAT_EQ(
+      column_statistics->estimate_predicate_with_value(PredicateCondition::Between, 2, AllTypeVariant{11}).selectivity,
+      0.1f);
+
+  // Without a histogram, the values are assumed to be distributed uniformly
+  const auto uniform_column_statistics = std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(
+      generate_table_statistics(*table, std::nullopt).column_statistics()[0]);
+  EXPECT_FALSE(uniform_column_statistics->histogram());
+  EXPECT_FLOAT_EQ(uniform_column_statistics->estimate_predicate_with_value(PredicateCondition::Equals, 1).selectivity,
+                  1.f / 11.f);
+}
+
+TEST_F(ColumnStatisticsTest, HistogramEquiJoin) {
+  auto left_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10);
+  for (auto row_idx = 0; row_idx < 90; ++row_idx) left_table->append({1});
+  for (auto value = 2; value <= 11; ++value) left_table->append({value});
+
+  auto right_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10);
+  for (auto value = 2; value <= 11; ++value) right_table->append({value});
+
+  const auto left_column_statistics = generate_table_statistics(*left_table).column_statistics()[0];
+  const auto right_column_statistics = generate_table_statistics(*right_table).column_statistics()[0];
+
+  // Only the 10 rows with the values 2..11 find a join partner
+  EXPECT_FLOAT_EQ(
+      left_column_statistics->estimate_predicate_with_column(PredicateCondition::Equals, *right_column_statistics)
+          .selectivity,
+      0.01f);
+  EXPECT_FLOAT_EQ(
+      left_column_statistics->estimate_predicate_with_column(PredicateCondition::NotEquals, *right_column_statistics)
+          .selectivity,
+      0.99f);
+}
+
+TEST_F(ColumnStatisticsTest, HistogramUnsupportedStrings) {
+  // Strings with characters that are not supported by string histograms do not get a histogram
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String}}, TableType::Data);
+  table->append({"abc"});
+  table->append({"a\tb"});
+
+  const auto column_statistics = std::dynamic_pointer_cast<const ColumnStatistics<pmr_string>>(
+      generate_table_statistics(*table).column_statistics()[0]);
+  EXPECT_FALSE(column_statistics->histogram());
+  EXPECT_FLOAT_EQ(column_statistics->distinct_count(), 2.f);
+}
+
 }  // namespace opossum
@@ -0,0 +1,128 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/numa_placement_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class NUMAPlacementManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Topology::use_fake_numa_topology(4, 1);
+    _node_count = Topology::get().nodes().size();
+
+    _table = _create_table();
+    _expected_table = _create_table();
+  }
+
+  void TearDown() override { Topology::use_default_topology(); }
+
+  // Five chunks of which the last one is still mutable
+  static std::shared_ptr<Table> _create_table() {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    for (auto value = 0; value < 9; ++value) {
+      table->append({value, value % 3 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{pmr_string{"v"}}});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count() - 1; ++chunk_id) {
+      table->get_chunk(chunk_id)->mark_immutable();
+    }
+    return table;
+  }
+
+  size_t _node_count;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(NUMAPlacementManagerTest, NoPlacementByDefault) {
+  StorageManager::get().add_table("table", _table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->node_id(), INVALID_NODE_ID);
+    EXPECT_EQ(NUMAPlacementManager::home_node_id(*_table, chunk_id), CURRENT_NODE_ID);
+  }
+}
+
+TEST_F(NUMAPlacementManagerTest, RoundRobin) {
+  NUMAPlacementManager::get().set_policy(NUMAPlacementPolicy::RoundRobin, ChunkID{2});
+  StorageManager::get().add_table("table", _table);
+
+  if (_node_count > 1) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{4}; ++chunk_id) {
+      EXPECT_EQ(_table->get_chunk(chunk_id)->node_id(), NodeID{static_cast<uint32_t>(chunk_id % _node_count)});
+    }
+  }
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->node_id(), INVALID_NODE_ID);
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(NUMAPlacementManagerTest, Range) {
+  NUMAPlacementManager::get().set_policy(NUMAPlacementPolicy::Range, ChunkID{2});
+  StorageManager::get().add_table("table", _table);
+
+  if (_node_count > 1) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{4}; ++chunk_id) {
+      EXPECT_EQ(_table->get_chunk(chunk_id)->node_id(), NodeID{static_cast<uint32_t>(chunk_id * _node_count / 5)});
+    }
+  }
+  EXPECT_EQ(_table->get_chunk(ChunkID{4})->node_id(), INVALID_NODE_ID);
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(NUMAPlacementManagerTest, SmallTablesStayInPlace) {
+  NUMAPlacementManager::get().set_policy(NUMAPlacementPolicy::RoundRobin, ChunkID{6});
+  StorageManager::get().add_table("table", _table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(_table->get_chunk(chunk_id)->node_id(), INVALID_NODE_ID);
+  }
+}
+
+TEST_F(NUMAPlacementManagerTest, ScanJobsRunOnHomeNode) {
+  if (_node_count < 2) return;
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  NUMAPlacementManager::get().set_policy(NUMAPlacementPolicy::RoundRobin, ChunkID{2});
+  StorageManager::get().add_table("table", _table);
+
+  const auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(get_table, greater_than_equals_(column_a, 0));
+  table_scan->execute();
+
+  // Output chunks of the scan inherit the home node of the chunk they reference
+  const auto& output_table = *table_scan->get_output();
+  ASSERT_EQ(output_table.chunk_count(), 5u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table.chunk_count(); ++chunk_id) {
+    const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(
+                                output_table.get_chunk(chunk_id)->get_segment(ColumnID{0}))->pos_list();
+    EXPECT_EQ(NUMAPlacementManager::home_node_id(output_table, chunk_id),
+              NUMAPlacementManager::home_node_id(*_table, pos_list[0].chunk_id));
+  }
+
+  // Only the four placed chunks are counted. Whether a job is local depends on work stealing.
+  const auto counters = NUMAPlacementManager::get().access_counters();
+  EXPECT_EQ(counters.local_accesses + counters.remote_accesses, 4u);
+
+  NUMAPlacementManager::get().reset_access_counters();
+  EXPECT_EQ(NUMAPlacementManager::get().access_counters().local_accesses, 0u);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+}  // namespace opossum
@@ -1,4 +1,7 @@
 #include <memory>
+#include <optional>
+#include <random>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,6 +9,7 @@
 #include "storage/base_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_gather.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -128,4 +132,68 @@ TEST_F(SegmentAccessorTest, TestSingleChunkReferenceSegmentAccessorNull) {
   EXPECT_FALSE(rc_single_chunk_accessor->access(ChunkOffset{0}).has_value());
 }
 
+TEST_F(SegmentAccessorTest, TestMultipleChunkReferenceSegmentAccessor) {
+  tbl->append_chunk(Segments{{dc_int, vc_str}});
+
+  auto pos_list = std::make_shared<PosList>(PosList{{
+      RowID{ChunkID{1}, ChunkOffset{0}},
+      RowID{ChunkID{0}, ChunkOffset{1}},
+      NULL_ROW_ID,
+      RowID{ChunkID{1}, ChunkOffset{3}},
+      RowID{ChunkID{1}, ChunkOffset{2}},
+  }});
+  const auto rc_multiple_chunks = std::make_shared<ReferenceSegment>(tbl, ColumnID{0}, pos_list);
+
+  auto rc_multiple_chunks_accessor = create_segment_accessor<int>(rc_multiple_chunks);
+  ASSERT_NE(rc_multiple_chunks_accessor, nullptr);
+  EXPECT_EQ(rc_multiple_chunks_accessor->access(ChunkOffset{0}), 4);
+  EXPECT_EQ(rc_multiple_chunks_accessor->access(ChunkOffset{1}), 6);
+  EXPECT_FALSE(rc_multiple_chunks_accessor->access(ChunkOffset{2}).has_value());
+  EXPECT_FALSE(rc_multiple_chunks_accessor->access(ChunkOffset{3}).has_value());
+  EXPECT_EQ(rc_multiple_chunks_accessor->access(ChunkOffset{4}), 3);
+
+  // Accessing a chunk that was added after the accessor was created
+  tbl->append_chunk(Segments{{vc_int, dc_str}});
+  (*pos_list)[0] = RowID{ChunkID{2}, ChunkOffset{2}};
+  EXPECT_EQ(rc_multiple_chunks_accessor->access(ChunkOffset{0}), 3);
+}
+
+TEST_F(SegmentAccessorTest, TestReferenceSegmentGather) {
+  tbl->append_chunk(Segments{{dc_int, vc_str}});
+
+  // More positions than fit into a single block, in random order and with NULLs
+  auto random_engine = std::default_random_engine{};
+  auto pos_list = std::make_shared<PosList>();
+  for (auto position_idx = size_t{0}; position_idx < 3 * ReferenceSegmentGather<int>::BLOCK_SIZE; ++position_idx) {
+    const auto chunk_offset = ChunkOffset{static_cast<ChunkOffset>(random_engine() % 5)};
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(random_engine() % 2)};
+    // Offset 4 does not exist, use it for NULL positions
+    pos_list->emplace_back(chunk_offset == 4 ? NULL_ROW_ID : RowID{chunk_id, chunk_offset});
+  }
+
+  for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+    const auto rc = std::make_shared<ReferenceSegment>(tbl, column_id, pos_list);
+
+    resolve_data_type(tbl->column_data_type(column_id), [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto accessor = create_segment_accessor<ColumnDataType>(rc);
+      auto gather = ReferenceSegmentGather<ColumnDataType>{*rc};
+
+      // Gather all positions, then a range that does not start at the first position
+      auto values = std::vector<std::optional<ColumnDataType>>(rc->size());
+      gather.gather(ChunkOffset{0}, static_cast<ChunkOffset>(rc->size()), values.data());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < rc->size(); ++chunk_offset) {
+        ASSERT_EQ(values[chunk_offset], accessor->access(chunk_offset));
+      }
+
+      auto range_values = std::vector<std::optional<ColumnDataType>>(10);
+      gather.gather(ChunkOffset{1500}, ChunkOffset{1510}, range_values.data());
+      for (auto value_idx = ChunkOffset{0}; value_idx < 10; ++value_idx) {
+        EXPECT_EQ(range_values[value_idx], accessor->access(static_cast<ChunkOffset>(1500 + value_idx)));
+      }
+    });
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,203 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_index.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_index/base_table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three chunks, the first two are encoded, the last one is mutable
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 3,
+                                     UseMvcc::Yes);
+    for (const auto value : {5, 3, 7, 3, 9, 1}) {
+      _table->append({value});
+    }
+    _table->append({NullValue{}});
+    _table->append({3});
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  PosList _lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                  const std::optional<AllTypeVariant>& value2 = std::nullopt) const {
+    auto matches = PosList{};
+    _table->get_table_index(ColumnID{0})->append_matches(predicate_condition, value, value2, matches);
+    return matches;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, CreateAndLookup) {
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}), nullptr);
+
+  _table->create_table_index(ColumnID{0});
+  ASSERT_NE(_table->get_table_index(ColumnID{0}), nullptr);
+  EXPECT_EQ(_table->table_indexes().size(), 1u);
+  EXPECT_THROW(_table->create_table_index(ColumnID{0}), std::logic_error);
+
+  // NULLs are not indexed
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->size(), 7u);
+
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3),
+            PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 1}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 4), PosList{});
+  EXPECT_EQ(_lookup(PredicateCondition::LessThan, 3), PosList({RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(_lookup(PredicateCondition::GreaterThanEquals, 7),
+            PosList({RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Between, 4, AllTypeVariant{7}),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Between, 7, AllTypeVariant{4}), PosList{});
+  EXPECT_EQ(_lookup(PredicateCondition::NotEquals, 3).size(), 4u);
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, NullValue{}), PosList{});
+}
+
+TEST_F(TableIndexTest, MaintainedByInsert) {
+  _table->create_table_index(ColumnID{0});
+
+  const auto values = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  values->append({3});
+  values->append({4});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 4), PosList({RowID{ChunkID{3}, 0}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3).size(), 4u);
+
+  // Rows of rolled-back inserts are removed from the index
+  auto rolled_back_insert = std::make_shared<Insert>("table_a", table_wrapper);
+  auto rolled_back_context = TransactionManager::get().new_transaction_context();
+  rolled_back_insert->set_transaction_context(rolled_back_context);
+  rolled_back_insert->execute();
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 4).size(), 2u);
+  rolled_back_context->rollback();
+
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 4), PosList({RowID{ChunkID{3}, 0}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3).size(), 4u);
+}
+
+TEST_F(TableIndexTest, IndexScanCoversMutableChunk) {
+  _table->create_table_index(ColumnID{0});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  // No chunk indexes exist, so without the table index, the IndexScan would fail
+  auto index_scan = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::GroupKey,
+                                                std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                std::vector<AllTypeVariant>{3});
+  index_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}},
+                                                      TableType::Data);
+  for (auto i = 0; i < 3; ++i) {
+    expected_table->append({3});
+  }
+  EXPECT_TABLE_EQ_UNORDERED(index_scan->get_output(), expected_table);
+
+  // Only rows in included chunks are returned
+  auto index_scan_included = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::GroupKey,
+                                                         std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                         std::vector<AllTypeVariant>{3});
+  index_scan_included->set_included_chunk_ids({ChunkID{2}});
+  index_scan_included->execute();
+  EXPECT_EQ(index_scan_included->get_output()->row_count(), 1u);
+}
+
+TEST_F(TableIndexTest, IndexScanOnPrunedGetTable) {
+  _table->create_table_index(ColumnID{0});
+
+  // GetTable drops the pruned chunk 0 and renumbers the chunks 1 and 2 to 0 and 1. The table index refers to the
+  // original chunk ids and cannot be used on its output.
+  const auto translate_and_execute = [&]() {
+    const auto stored_table_node = StoredTableNode::make("table_a");
+    stored_table_node->set_excluded_chunk_ids({ChunkID{0}});
+    const auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("a"), 3), stored_table_node);
+    predicate_node->scan_type = ScanType::IndexScan;
+
+    const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::No));
+    return pqp;
+  };
+
+  const auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}},
+                                                      TableType::Data);
+  expected_table->append({3});
+  expected_table->append({3});
+
+  // Without chunk indexes, the predicate is answered by a TableScan
+  const auto table_scan = translate_and_execute();
+  EXPECT_TRUE(std::dynamic_pointer_cast<TableScan>(table_scan));
+  EXPECT_TABLE_EQ_UNORDERED(table_scan->get_output(), expected_table);
+
+  // The chunk index of the stored chunk 1 is used for chunk 0 of the pruned table
+  _table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  const auto union_positions = translate_and_execute();
+  ASSERT_TRUE(std::dynamic_pointer_cast<UnionPositions>(union_positions));
+  const auto index_scan = std::dynamic_pointer_cast<const IndexScan>(union_positions->input_left());
+  ASSERT_TRUE(index_scan);
+  EXPECT_EQ(index_scan->get_output()->row_count(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(union_positions->get_output(), expected_table);
+}
+
+TEST_F(TableIndexTest, JoinIndexUsesTableIndex) {
+  _table->create_table_index(ColumnID{0});
+
+  const auto left = std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, false}}, TableType::Data);
+  left->append({3});
+  left->append({9});
+  left->append({4});
+  const auto left_wrapper = std::make_shared<TableWrapper>(left);
+  const auto right_wrapper = std::make_shared<TableWrapper>(_table);
+  left_wrapper->execute();
+  right_wrapper->execute();
+
+  auto join = std::make_shared<JoinIndex>(left_wrapper, right_wrapper, JoinMode::Left,
+                                          ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Int, false}, {"a", DataType::Int, true}}, TableType::Data);
+  expected_table->append({3, 3});
+  expected_table->append({3, 3});
+  expected_table->append({3, 3});
+  expected_table->append({9, 9});
+  expected_table->append({4, NullValue{}});
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_table);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 3u);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+}
+
+}  // namespace opossum
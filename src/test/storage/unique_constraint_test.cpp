@@ -0,0 +1,144 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class UniqueConstraintTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    _table->append({1, 10});
+    _table->append({2, NullValue{}});
+    _table->append({3, NullValue{}});
+    StorageManager::get().add_table("table_a", _table);
+
+    _table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    _table->add_unique_constraint({ColumnID{1}});
+  }
+
+  // Returns whether the insert succeeded
+  bool _insert(const std::vector<std::vector<AllTypeVariant>>& rows,
+               const std::shared_ptr<TransactionContext>& context) {
+    const auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    for (const auto& row : rows) {
+      values->append(row);
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return !insert->execute_failed();
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(UniqueConstraintTest, AddConstraints) {
+  const auto expected_constraints = TableConstraintDefinitions{{{ColumnID{0}}, IsPrimaryKey::Yes}, {{ColumnID{1}}}};
+  EXPECT_EQ(_table->get_unique_constraints(), expected_constraints);
+
+  // Only one primary key, which must not be nullable
+  EXPECT_THROW(_table->add_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes), std::logic_error);
+  EXPECT_THROW(_table->add_unique_constraint({ColumnID{0}, ColumnID{0}}), std::logic_error);
+
+  // Existing duplicates
+  _table->append({1, 11});
+  EXPECT_THROW(_table->add_unique_constraint({ColumnID{0}}), std::logic_error);
+  _table->add_unique_constraint({ColumnID{0}, ColumnID{1}});
+}
+
+TEST_F(UniqueConstraintTest, InsertChecksConstraints) {
+  // Duplicate primary key
+  auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_insert({{1, 11}}, context));
+  context->rollback();
+
+  // Duplicate unique value
+  context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_insert({{4, 10}}, context));
+  context->rollback();
+
+  // Duplicate within the inserted rows
+  context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_insert({{5, 20}, {5, 21}}, context));
+  context->rollback();
+
+  // NULLs do not violate a unique constraint
+  context = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(_insert({{4, NullValue{}}, {5, 20}}, context));
+  context->commit();
+
+  context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_insert({{6, 20}}, context));
+  context->rollback();
+}
+
+TEST_F(UniqueConstraintTest, UncommittedRowsConflict) {
+  auto first_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(_insert({{4, 40}}, first_context));
+
+  // The first writer wins
+  auto second_context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_insert({{4, 41}}, second_context));
+  second_context->rollback();
+
+  // Once the first insert is rolled back, the key is available again
+  first_context->rollback();
+  auto third_context = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(_insert({{4, 41}}, third_context));
+  third_context->commit();
+}
+
+TEST_F(UniqueConstraintTest, UpdateKeepsKey) {
+  const auto update_row = [&](const int32_t key) {
+    const auto context = TransactionManager::get().new_transaction_context();
+
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    const auto validate = std::make_shared<Validate>(get_table);
+    const auto table_scan =
+        std::make_shared<TableScan>(validate, equals_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), key));
+    validate->set_transaction_context(context);
+    get_table->execute();
+    validate->execute();
+    table_scan->execute();
+
+    // Replace the row with itself
+    const auto update = std::make_shared<Update>("table_a", table_scan, table_scan);
+    update->set_transaction_context(context);
+    update->execute();
+    EXPECT_FALSE(update->execute_failed());
+    context->commit();
+  };
+
+  update_row(1);
+  update_row(1);
+  update_row(2);
+
+  // After the updates, the keys are still taken
+  auto context = TransactionManager::get().new_transaction_context();
+  EXPECT_FALSE(_insert({{1, 11}}, context));
+  context->rollback();
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#include "base_test.hpp"
+
+#include "storage/prepared_plan.hpp"
+#include "tasks/server/execute_server_prepared_statement_task.hpp"
+#include "tasks/server/parse_server_prepared_statement_task.hpp"
+
+namespace opossum {
+
+class ExecuteServerPreparedStatementTaskTest : public BaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+
+    auto parse_task = std::make_shared<ParseServerPreparedStatementTask>("SELECT * FROM int_float WHERE a > ?");
+    auto parse_future = parse_task->get_future();
+    parse_task->execute();
+    prepared_plan = parse_future.get();
+  }
+
+  std::shared_ptr<const Table> execute(const AllTypeVariant& param) {
+    auto task = std::make_shared<ExecuteServerPreparedStatementTask>(
+        "SELECT * FROM int_float WHERE a > ?", prepared_plan, std::vector<AllTypeVariant>{param},
+        TransactionManager::get().new_transaction_context());
+    auto future = task->get_future();
+    task->execute();
+    return future.get()->get_output();
+  }
+
+  std::shared_ptr<PreparedPlan> prepared_plan;
+};
+
+TEST_F(ExecuteServerPreparedStatementTaskTest, TranslatesOncePerParameterDataTypes) {
+  EXPECT_EQ(execute(1000)->row_count(), 2u);
+  EXPECT_EQ(SQLPhysicalPlanCache::get().size(), 1u);
+
+  // The cached plan is reused with another value, which shows that it was not bound by the previous execution
+  EXPECT_EQ(execute(10000)->row_count(), 1u);
+  EXPECT_EQ(SQLPhysicalPlanCache::get().size(), 1u);
+
+  // Parameters of another data type need another plan
+  EXPECT_EQ(execute(int64_t{100})->row_count(), 3u);
+  EXPECT_EQ(SQLPhysicalPlanCache::get().size(), 2u);
+}
+
+TEST_F(ExecuteServerPreparedStatementTaskTest, NullParameter) {
+  EXPECT_EQ(execute(NULL_VALUE)->row_count(), 0u);
+  EXPECT_EQ(SQLPhysicalPlanCache::get().size(), 0u);
+}
+
+}  // namespace opossum
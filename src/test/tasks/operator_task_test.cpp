@@ -12,6 +12,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/query_memory_usage.hpp"
 #include "storage/storage_manager.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -123,4 +124,64 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, ReleaseOutputAfterLastConsumer) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto b = PQPColumnExpression::from_table(*_test_table_a, "b");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+  auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(b, 1000));
+  auto scan_c = std::make_shared<TableScan>(scan_a, greater_than_(b, 2000));
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions, CleanupTemporaries::Yes);
+  ASSERT_EQ(tasks.size(), 5u);
+
+  EXPECT_EQ(gt_a->consumer_count(), 1u);
+  EXPECT_EQ(scan_a->consumer_count(), 2u);
+  EXPECT_EQ(scan_b->consumer_count(), 1u);
+  EXPECT_EQ(union_positions->consumer_count(), 0u);
+
+  const auto query_memory_usage = std::make_shared<QueryMemoryUsage>();
+  for (const auto& task : tasks) {
+    task->set_query_memory_usage(query_memory_usage);
+  }
+
+  tasks[0]->schedule();
+  tasks[1]->schedule();
+  tasks[2]->schedule();
+
+  // scan_c has not consumed the output of scan_a yet
+  EXPECT_EQ(gt_a->get_output(), nullptr);
+  EXPECT_NE(scan_a->get_output(), nullptr);
+  EXPECT_EQ(scan_a->consumer_count(), 1u);
+  EXPECT_GT(query_memory_usage->current(), 0u);
+
+  tasks[3]->schedule();
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+  EXPECT_EQ(scan_a->consumer_count(), 0u);
+
+  tasks[4]->schedule();
+  ASSERT_NE(union_positions->get_output(), nullptr);
+
+  // Only the result is still accounted, but the peak includes the outputs of scan_b and scan_c, which were held at the
+  // same time
+  EXPECT_EQ(query_memory_usage->current(), *union_positions->performance_data().output_memory_usage);
+  EXPECT_GE(query_memory_usage->peak(), *scan_b->performance_data().output_memory_usage +
+                                            *scan_c->performance_data().output_memory_usage);
+}
+
+TEST_F(OperatorTaskTest, NoConsumersWithoutCleanup) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, greater_than_equals_(a, 1234));
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_a, CleanupTemporaries::No);
+  EXPECT_EQ(gt_a->consumer_count(), 0u);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+  EXPECT_NE(gt_a->get_output(), nullptr);
+}
 }  // namespace opossum
@@ -1,7 +1,13 @@
 #include "gtest/gtest.h"
 
+#include "benchmark_config.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
 #include "storage/storage_manager.hpp"
 #include "testing_assert.hpp"
+#include "tpch/tpch_refresh_functions.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/load_table.hpp"
 
@@ -48,6 +54,32 @@ TEST(TpchDbGeneratorTest, TableContents) {
                           load_table("resources/test_data/tbl/tpch/sf-0.001/region.tbl", chunk_size));
 }
 
+TEST(TpchDbGeneratorTest, TableContentsInParallel) {
+  /**
+   * Generate the tables in many small ranges on multiple workers. Each range skips to its first row using dbgen's seed
+   * skipping, so the data has to be the exact same as for sequential generation.
+   */
+  const auto scale_factor = 0.001f;
+  const auto chunk_size = ChunkOffset{10};
+  const auto sequential_table_info_by_name = TpchTableGenerator(scale_factor, 100'000).generate();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto table_info_by_name = TpchTableGenerator(scale_factor, chunk_size).generate();
+  CurrentScheduler::set(nullptr);
+
+  for (const auto& [table_name, table_info] : table_info_by_name) {
+    EXPECT_EQ(table_info.table->max_chunk_size(), chunk_size);
+    EXPECT_TABLE_EQ_ORDERED(table_info.table, sequential_table_info_by_name.at(table_name).table);
+  }
+
+  // All chunks but the last are full, even though a range of orders has a varying number of lineitems
+  const auto& lineitem_table = table_info_by_name.at("lineitem").table;
+  for (auto chunk_id = ChunkID{0}; chunk_id + 1 < lineitem_table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(lineitem_table->get_chunk(chunk_id)->size(), chunk_size);
+  }
+}
+
 TEST(TpchDbGeneratorTest, GenerateAndStore) {
   EXPECT_FALSE(StorageManager::get().has_table("part"));
   EXPECT_FALSE(StorageManager::get().has_table("supplier"));
@@ -70,4 +102,36 @@ TEST(TpchDbGeneratorTest, GenerateAndStore) {
 
   StorageManager::reset();
 }
+
+TEST(TpchDbGeneratorTest, RefreshFunctions) {
+  auto benchmark_config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  benchmark_config->use_mvcc = UseMvcc::Yes;
+  TpchTableGenerator(0.01f, benchmark_config).generate_and_store();
+
+  // Only counts the rows that are visible to new transactions
+  const auto valid_row_count = [](const std::string& table_name) {
+    auto pipeline = SQLPipelineBuilder{"SELECT COUNT(*) FROM " + table_name}.with_mvcc(UseMvcc::Yes).create_pipeline();
+    return pipeline.get_result_table()->get_value<int64_t>(ColumnID{0}, 0);
+  };
+
+  const auto order_count = valid_row_count("orders");
+  const auto lineitem_count = valid_row_count("lineitem");
+
+  auto refresh_functions = TpchRefreshFunctions{0.01f, Chunk::DEFAULT_SIZE};
+
+  // RF1 inserts SF * 1500 orders with at least one lineitem each, RF2 deletes them again. Repeating them has the same
+  // effect, because the new orders do not collide with the existing ones.
+  for (auto run = 0; run < 2; ++run) {
+    refresh_functions.rf1();
+    EXPECT_EQ(valid_row_count("orders"), order_count + 15);
+    EXPECT_GE(valid_row_count("lineitem"), lineitem_count + 15);
+
+    refresh_functions.rf2();
+    EXPECT_EQ(valid_row_count("orders"), order_count);
+    EXPECT_EQ(valid_row_count("lineitem"), lineitem_count);
+  }
+
+  StorageManager::reset();
+}
+
 }  // namespace opossum
@@ -0,0 +1,19 @@
+#include "gtest/gtest.h"
+
+#include "utils/hardware_info.hpp"
+
+namespace opossum {
+
+TEST(HardwareInfoTest, Sizes) {
+  // Whether they were detected or not, the sizes have to be usable for sizing data structures
+  const auto& hardware_info = HardwareInfo::get();
+  EXPECT_GT(hardware_info.l1_data_cache_size(), 0u);
+  EXPECT_GE(hardware_info.l2_cache_size(), hardware_info.l1_data_cache_size());
+  EXPECT_GT(hardware_info.l3_cache_size(), 0u);
+  EXPECT_GT(hardware_info.tlb_entries(), 0u);
+  EXPECT_EQ(hardware_info.page_size() % 4096, 0u);
+  EXPECT_EQ(hardware_info.tlb_reach(), hardware_info.tlb_entries() * hardware_info.page_size());
+  EXPECT_FALSE(hardware_info.to_string().empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#include <system_error>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/mapped_file.hpp"
+
+namespace opossum {
+
+class MappedFileTest : public BaseTest {};
+
+TEST_F(MappedFileTest, Content) {
+  const auto file = MappedFile{"resources/test_data/csv/float.csv"};
+  EXPECT_EQ(file.content().substr(0, 8), "1.1\n2.2\n");
+}
+
+TEST_F(MappedFileTest, FileDoesNotExist) {
+  EXPECT_THROW(MappedFile{"not_existing_file"}, std::system_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,78 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+class PerformanceCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { PerformanceCounters::set_enabled(false); }
+};
+
+TEST_F(PerformanceCountersTest, DisabledByDefault) {
+  EXPECT_FALSE(PerformanceCounters::is_enabled());
+
+  auto performance_counters = PerformanceCounters{};
+  EXPECT_TRUE(performance_counters.lap().empty());
+}
+
+TEST_F(PerformanceCountersTest, LapIfAvailable) {
+  PerformanceCounters::set_enabled(true);
+
+  auto performance_counters = PerformanceCounters{};
+  auto sum = uint64_t{0};
+  for (auto value = uint64_t{0}; value < 1'000'000; ++value) {
+    sum += value * value;
+  }
+  const auto values = performance_counters.lap();
+  EXPECT_GT(sum, uint64_t{0});
+
+  // Counters are not available in many virtual machines and containers, which has to be handled gracefully
+  if (!PerformanceCounters::is_available()) {
+    EXPECT_TRUE(values.empty());
+    return;
+  }
+
+  EXPECT_FALSE(values.empty());
+}
+
+TEST_F(PerformanceCountersTest, AddValues) {
+  auto values = PerformanceCounterValues{};
+  EXPECT_TRUE(values.empty());
+
+  values += PerformanceCounterValues{100, 200, std::nullopt, 3, std::nullopt};
+  values += PerformanceCounterValues{100, 200, 4, std::nullopt, std::nullopt};
+
+  EXPECT_FALSE(values.empty());
+  EXPECT_EQ(values.cycles, 200);
+  EXPECT_EQ(values.instructions, 400);
+  EXPECT_EQ(values.llc_misses, 4);
+  EXPECT_EQ(values.branch_misses, 3);
+  EXPECT_EQ(values.dtlb_misses, std::nullopt);
+  EXPECT_EQ(values.to_string(), "200 cycles, 400 instructions (IPC 2.00), 4 LLC misses, 3 branch misses");
+}
+
+TEST_F(PerformanceCountersTest, NotRecordedByOperatorsWithScheduler) {
+  PerformanceCounters::set_enabled(true);
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The counters of the calling thread do not include the jobs that an operator spawns on other workers
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  EXPECT_TRUE(table_wrapper->performance_data().performance_counters.empty());
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/radix_partition_writer.hpp"
+
+namespace opossum {
+
+namespace {
+
+struct Element {
+  RowID row_id;
+  int32_t value;
+};
+
+}  // namespace
+
+class RadixPartitionWriterTest : public ::testing::TestWithParam<RadixPartitionWriteMode> {};
+
+TEST_P(RadixPartitionWriterTest, WritesEachPartitionContiguously) {
+  const auto partition_count = size_t{8};
+
+  // Partition i holds the values v < 1'000 with v % 8 == i, i.e., 125 values
+  auto output = std::vector<Element>(1'000);
+  auto output_offsets = std::vector<size_t>(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    output_offsets[partition_id] = partition_id * 125;
+  }
+
+  auto writer = RadixPartitionWriter<Element>{output.data(), output_offsets, GetParam()};
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    writer.write(value % partition_count, Element{RowID{ChunkID{0}, ChunkOffset{static_cast<uint32_t>(value)}}, value});
+  }
+  writer.flush();
+
+  for (auto offset = size_t{0}; offset < output.size(); ++offset) {
+    const auto partition_id = offset / 125;
+    const auto expected_value = static_cast<int32_t>((offset % 125) * partition_count + partition_id);
+    EXPECT_EQ(output[offset].value, expected_value);
+    EXPECT_EQ(output[offset].row_id.chunk_offset, static_cast<ChunkOffset>(expected_value));
+  }
+}
+
+TEST_P(RadixPartitionWriterTest, ElementsThatAreNotTriviallyCopyable) {
+  // Strings are never write-combined, but written directly
+  auto first_partition = std::vector<std::string>(2);
+  auto second_partition = std::vector<std::string>(1);
+
+  auto writer =
+      RadixPartitionWriter<std::string>{std::vector<std::string*>{first_partition.data(), second_partition.data()},
+                                        GetParam()};
+  writer.write(1, "c");
+  writer.write(0, "a");
+  writer.write(0, "b");
+  writer.flush();
+
+  EXPECT_EQ(first_partition, std::vector<std::string>({"a", "b"}));
+  EXPECT_EQ(second_partition, std::vector<std::string>({"c"}));
+}
+
+TEST(RadixPartitionWriterModeTest, ChooseMode) {
+  // Few partitions fit into the TLB and are written directly
+  EXPECT_EQ(RadixPartitionWriter<Element>::choose_mode(16, 1'000'000'000), RadixPartitionWriteMode::Direct);
+
+  // An output that fits into the cache should not bypass it
+  EXPECT_EQ(RadixPartitionWriter<Element>::choose_mode(256, 1'000), RadixPartitionWriteMode::Direct);
+}
+
+INSTANTIATE_TEST_CASE_P(RadixPartitionWriterTestInstances, RadixPartitionWriterTest,
+                        ::testing::Values(RadixPartitionWriteMode::Direct, RadixPartitionWriteMode::WriteCombining),
+                        );  // NOLINT
+
+}  // namespace opossum
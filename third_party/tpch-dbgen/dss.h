@@ -218,6 +218,16 @@ void	dump_seeds(int t);
 
 void		dbg_text PROTO((char * t, int min, int max, int s));
 
+/**
+ * HYRISE: The random number streams are thread-local so that multiple threads can generate disjoint row ranges of a
+ * table concurrently. Each thread resets the streams (dbgen_reset_seeds()) and skips to the first row of its range.
+ */
+#ifdef __cplusplus
+#define DBGEN_THREAD_LOCAL thread_local
+#else
+#define DBGEN_THREAD_LOCAL _Thread_local
+#endif
+
 #ifdef DECLARER
 #define EXTERN
 #else
@@ -55,4 +55,4 @@ extern double dM;
  * preferred solution, but not initializing correctly
  */
 #define VSTR_MAX(len)	(long)(len / 5 + (len % 5 == 0)?0:1 + 1)
-extern seed_t     Seed[MAX_STREAM + 1];
\ No newline at end of file
+extern DBGEN_THREAD_LOCAL seed_t     Seed[MAX_STREAM + 1];
\ No newline at end of file
@@ -59,7 +59,7 @@
 #include "rng64.h"
 extern double dM;
 
-extern seed_t Seed[];
+extern DBGEN_THREAD_LOCAL seed_t Seed[];
 
 void
 dss_random64(DSS_HUGE *tgt, DSS_HUGE nLow, DSS_HUGE nHigh, long nStream)